@@ -0,0 +1,659 @@
+/*=======================================================================================
+** File Name:  mpu6050_bench.c
+**
+** Title:  Processing Benchmark for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To time the per-sample processing of the app on the build host, for a
+**           range of batch sizes and device counts, and report it as JSON.
+**
+** Usage:
+**    mpu6050_bench [-b batches] [-d devices] [-t sec] [-o out.json]
+**                  [-B baseline.json] [-T pct]
+**
+**    -b  Comma separated samples per read, each 1 to MPU6050_BENCH_MAX_BATCH
+**        (default 1,10,50,255)
+**    -d  Comma separated device counts, each 1 to MPU6050_BENCH_MAX_DEVICES
+**        (default 1,4)
+**    -t  Least time spent on each case (default 0.2)
+**    -o  Write the results here instead of to stdout
+**    -B  Compare with the results of an earlier run; exit 1 if any case got slower
+**    -T  Slowdown in percent a case may show before it counts (default 10)
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Input is taken from the register-map simulator ("sine" profile, 8 kHz), one
+**    set of samples per device, decoded as MPU6050_UnpackSample does.
+** 2: Each case runs the same function calls the app makes per read, on every
+**    device in turn, so the working set grows with the device count.
+** 3: Each result is on a line of its own; -B relies on that.
+** 4: "fuse" is not part of "pipeline", as the fused stream only runs with peers.  Its
+**    members are the device itself at other offsets into its samples, so every
+**    voting path but the fault one is taken.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "mpu6050_attitude.h"
+#include "mpu6050_compress.h"
+#include "mpu6050_conv.h"
+#include "mpu6050_diag.h"
+#include "mpu6050_fixed.h"
+#include "mpu6050_motion.h"
+#include "mpu6050_sim.h"
+#include "mpu6050_timing.h"
+#include "mpu6050_vote.h"
+
+/*
+** Local Defines
+*/
+#define MPU6050_BENCH_MAX_BATCH    MPU6050_COMP_MAX_SAMPLES
+#define MPU6050_BENCH_MAX_DEVICES  16
+#define MPU6050_BENCH_MAX_LIST     16
+#define MPU6050_BENCH_MAX_RESULTS  256
+#define MPU6050_BENCH_RATE_HZ      8000.0
+#define MPU6050_BENCH_MOTION_WIN   100
+#define MPU6050_BENCH_VOTE_STRIDE  37  /* Sample offset between voting members */
+
+/*
+** Local Structure Declarations
+*/
+
+/* Everything one device's processing touches */
+typedef struct
+{
+    MPU6050_RawSample_t   aRaw[MPU6050_BENCH_MAX_BATCH];
+    MPU6050_Sample_t      aCal[MPU6050_BENCH_MAX_BATCH];
+    MPU6050_Calibration_t Cal;
+    MPU6050_Attitude_t    Att;
+    double                adQuat[4];
+    MPU6050_Motion_t      Motion;
+    MPU6050_FixedCal_t    FixedCal;
+    MPU6050_SampleQ_t     aSampleQ[MPU6050_BENCH_MAX_BATCH];
+    int32                 aiQuat[4];
+    MPU6050_MotionQ_t     MotionQ;
+    MPU6050_TimeModel_t   TimeModel;
+    double                dReadTime;
+    int16                 aiPacked[MPU6050_BENCH_MAX_BATCH * MPU6050_COMP_CHANNELS];
+    double                adPacked[MPU6050_BENCH_MAX_BATCH * 6];
+    uint8                 aucBlock[MPU6050_COMP_MAX_BLOCK_BYTES(MPU6050_BENCH_MAX_BATCH)];
+    MPU6050_Vote_t        Vote;
+    uint64                uiVoteTime;
+    MPU6050_VoteOut_t     aVoteOut[MPU6050_BENCH_MAX_BATCH];
+} MPU6050_BenchDev_t;
+
+/* One stage of processing a read of BatchSize samples */
+typedef struct
+{
+    const char *Name;
+    uint32    (*Run)(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize);
+} MPU6050_BenchCase_t;
+
+typedef struct
+{
+    const char *Name;
+    uint32      uiBatch;
+    uint32      uiDevices;
+    uint64      uiSamples;
+    double      dNsPerSample;
+} MPU6050_BenchResult_t;
+
+/*
+** Local Variables
+*/
+static MPU6050_BenchDev_t    MPU6050_BenchDev[MPU6050_BENCH_MAX_DEVICES];
+static MPU6050_BenchResult_t MPU6050_BenchResult[MPU6050_BENCH_MAX_RESULTS];
+static uint32                MPU6050_BenchResultCnt;
+
+/* Folds in every case's output so none of the work can be optimized away */
+static volatile uint32 MPU6050_BenchSink;
+
+/*
+** Local Function Definitions
+*/
+
+/* Raw to engineering units, as MPU6050_ConvertSample */
+static uint32 MPU6050_Bench_Convert(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize)
+{
+    float  geeScale  = MPU6050_AccelFullScale(MPU6050_ACCELSCALE_2G);
+    float  rateScale = MPU6050_GyroFullScale(MPU6050_GYROSCALE_250DPS);
+    uint32 i;
+
+    for (i = 0; i < BatchSize; i++)
+    {
+        MPU6050_ConvertRaw(&DevPtr->aRaw[i], MPU6050_CHAN_ALL, geeScale, rateScale,
+                           &DevPtr->Cal, &DevPtr->aCal[i]);
+    }
+
+    return (uint32) DevPtr->aCal[BatchSize - 1].gyroZDegsSec;
+}
+
+/* Quaternion propagation, as MPU6050_AppMain but on every sample */
+static uint32 MPU6050_Bench_Attitude(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize)
+{
+    double gyro[3];
+    double delta[3];
+    uint32 i;
+
+    for (i = 0; i < BatchSize; i++)
+    {
+        gyro[0] = DevPtr->aCal[i].gyroXDegsSec;
+        gyro[1] = DevPtr->aCal[i].gyroYDegsSec;
+        gyro[2] = DevPtr->aCal[i].gyroZDegsSec;
+        MPU6050_Attitude_Increment(gyro, 1.0 / MPU6050_BENCH_RATE_HZ, delta);
+        MPU6050_Attitude_QuatPropagate(DevPtr->adQuat, delta);
+        MPU6050_Attitude_QuatToEuler(DevPtr->adQuat, &DevPtr->Att);
+    }
+
+    return (uint32) (DevPtr->Att.psi * 1000.0);
+}
+
+/* Motion metrics, as MPU6050_AdaptRate */
+static uint32 MPU6050_Bench_Motion(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize)
+{
+    double gyro[3];
+    double accel[3];
+    uint32 windows = 0;
+    uint32 i;
+
+    for (i = 0; i < BatchSize; i++)
+    {
+        gyro[0]  = DevPtr->aCal[i].gyroXDegsSec;
+        gyro[1]  = DevPtr->aCal[i].gyroYDegsSec;
+        gyro[2]  = DevPtr->aCal[i].gyroZDegsSec;
+        accel[0] = DevPtr->aCal[i].accelXGees;
+        accel[1] = DevPtr->aCal[i].accelYGees;
+        accel[2] = DevPtr->aCal[i].accelZGees;
+        windows += MPU6050_Motion_Add(&DevPtr->Motion, gyro, accel);
+    }
+
+    return windows;
+}
+
+/* The three cases above in fixed point, as a MPU6050_FIXED_POINT build */
+static uint32 MPU6050_Bench_ConvertQ(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize)
+{
+    uint32 i;
+
+    for (i = 0; i < BatchSize; i++)
+    {
+        MPU6050_Fixed_Convert(&DevPtr->FixedCal, &DevPtr->aRaw[i], MPU6050_CHAN_ALL, &DevPtr->aSampleQ[i]);
+    }
+
+    return (uint32) DevPtr->aSampleQ[BatchSize - 1].aiGyro[2];
+}
+
+static uint32 MPU6050_Bench_AttitudeQ(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize)
+{
+    int32  delta[3];
+    int32  euler[3];
+    uint32 i;
+
+    for (i = 0; i < BatchSize; i++)
+    {
+        MPU6050_Fixed_Increment(DevPtr->aSampleQ[i].aiGyro, (uint32) (1e9 / MPU6050_BENCH_RATE_HZ), delta);
+        MPU6050_Fixed_QuatPropagate(DevPtr->aiQuat, delta);
+        MPU6050_Fixed_QuatToEuler(DevPtr->aiQuat, euler);
+    }
+
+    return (uint32) euler[2];
+}
+
+static uint32 MPU6050_Bench_MotionQ(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize)
+{
+    uint32 windows = 0;
+    uint32 i;
+
+    for (i = 0; i < BatchSize; i++)
+    {
+        windows += MPU6050_Fixed_MotionAdd(&DevPtr->MotionQ, &DevPtr->aSampleQ[i]);
+    }
+
+    return windows;
+}
+
+/* Sample time fit, once per read as MPU6050_ReadDevice */
+static uint32 MPU6050_Bench_TimeModel(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize)
+{
+    DevPtr->dReadTime += BatchSize / MPU6050_BENCH_RATE_HZ;
+
+    return (uint32) MPU6050_TimeModel_Update(&DevPtr->TimeModel, BatchSize, DevPtr->dReadTime);
+}
+
+/* Raw stream and recorder entries */
+static uint32 MPU6050_Bench_PackRaw(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize)
+{
+    int16 *dstPtr = DevPtr->aiPacked;
+    uint32 i;
+
+    for (i = 0; i < BatchSize; i++)
+    {
+        dstPtr += MPU6050_PackRaw(&DevPtr->aRaw[i], MPU6050_CHAN_ALL, dstPtr);
+    }
+
+    return (uint32) (dstPtr - DevPtr->aiPacked);
+}
+
+/* Calibrated stream entries */
+static uint32 MPU6050_Bench_PackCalibrated(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize)
+{
+    double *dstPtr = DevPtr->adPacked;
+    uint32  i;
+
+    for (i = 0; i < BatchSize; i++)
+    {
+        dstPtr += MPU6050_PackCalibrated(&DevPtr->aCal[i], MPU6050_CHAN_ALL, dstPtr);
+    }
+
+    return (uint32) (dstPtr - DevPtr->adPacked);
+}
+
+/* Compressed stream packet, one block per read */
+static uint32 MPU6050_Bench_Compress(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize)
+{
+    return MPU6050_CompressBlock((const int16 (*)[MPU6050_COMP_CHANNELS]) DevPtr->aRaw, BatchSize,
+                                 DevPtr->aucBlock, sizeof(DevPtr->aucBlock));
+}
+
+/* All of the above, as one cycle with every stream configured */
+static uint32 MPU6050_Bench_Pipeline(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize)
+{
+    return MPU6050_Bench_TimeModel(DevPtr, BatchSize) +
+           MPU6050_Bench_Convert(DevPtr, BatchSize) +
+           MPU6050_Bench_Motion(DevPtr, BatchSize) +
+           MPU6050_Bench_Attitude(DevPtr, BatchSize) +
+           MPU6050_Bench_PackRaw(DevPtr, BatchSize) +
+           MPU6050_Bench_PackCalibrated(DevPtr, BatchSize) +
+           MPU6050_Bench_Compress(DevPtr, BatchSize);
+}
+
+/* Fused stream, with MPU6050_VOTE_MAX_MEMBERS members each taking a sample of the
+** device at the same time as the reference */
+static uint32 MPU6050_Bench_Fuse(MPU6050_BenchDev_t *DevPtr, uint32 BatchSize)
+{
+    uint32 i;
+    uint32 m;
+
+    for (i = 0; i < BatchSize; i++)
+    {
+        DevPtr->uiVoteTime += (uint64) (1e9 / MPU6050_BENCH_RATE_HZ);
+        for (m = 0; m < MPU6050_VOTE_MAX_MEMBERS; m++)
+        {
+            MPU6050_Vote_Add(&DevPtr->Vote, m, DevPtr->uiVoteTime, MPU6050_CHAN_ALL,
+                             &DevPtr->aCal[(i + m * MPU6050_BENCH_VOTE_STRIDE) % MPU6050_BENCH_MAX_BATCH]);
+        }
+    }
+
+    return MPU6050_Vote_Fuse(&DevPtr->Vote, DevPtr->uiVoteTime, DevPtr->aVoteOut, BatchSize);
+}
+
+static const MPU6050_BenchCase_t MPU6050_BenchCase[] =
+{
+    {"convert",         MPU6050_Bench_Convert},
+    {"attitude",        MPU6050_Bench_Attitude},
+    {"motion",          MPU6050_Bench_Motion},
+    {"convert_q",       MPU6050_Bench_ConvertQ},
+    {"attitude_q",      MPU6050_Bench_AttitudeQ},
+    {"motion_q",        MPU6050_Bench_MotionQ},
+    {"time_model",      MPU6050_Bench_TimeModel},
+    {"pack_raw",        MPU6050_Bench_PackRaw},
+    {"pack_calibrated", MPU6050_Bench_PackCalibrated},
+    {"compress",        MPU6050_Bench_Compress},
+    {"pipeline",        MPU6050_Bench_Pipeline},
+    {"fuse",            MPU6050_Bench_Fuse},
+};
+
+#define MPU6050_BENCH_CASE_CNT  (sizeof(MPU6050_BenchCase) / sizeof(MPU6050_BenchCase[0]))
+
+/* Fill a device's raw samples from a simulated device at 8 kHz */
+static int32 MPU6050_Bench_InitDev(MPU6050_BenchDev_t *DevPtr, uint32 DevNum)
+{
+    static const uint8 wake[] = {RegPowerManagment1, 0x00};
+    static const uint8 rate[] = {RegSampleRateDiv, 0x00, 0x00};  /* and CONFIG: DLPF off */
+    MPU6050_VoteCfg_t voteCfg;
+    uint8  buffer[MPU6050_SAMPLE_BYTES];
+    int16 *channel;
+    int    fd;
+    uint32 i;
+    uint32 c;
+
+    fd = MPU6050_Sim_Open("sine");
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    MPU6050_Sim_Get(fd)->Cfg.dTimeScale = 0.0;
+    MPU6050_Sim_Get(fd)->uiRng = 0x9E3779B9u * (DevNum + 1);
+    MPU6050_Sim_Write(fd, wake, sizeof(wake));
+    MPU6050_Sim_Write(fd, rate, sizeof(rate));
+
+    for (i = 0; i < MPU6050_BENCH_MAX_BATCH; i++)
+    {
+        MPU6050_Sim_Advance(fd, (uint64) (1e9 / MPU6050_BENCH_RATE_HZ));
+        buffer[0] = RegAccelX;
+        MPU6050_Sim_Write(fd, buffer, 1);
+        MPU6050_Sim_Read(fd, buffer, sizeof(buffer));
+
+        channel = (int16*) &DevPtr->aRaw[i];
+        for (c = 0; c < MPU6050_COMP_CHANNELS; c++)
+        {
+            channel[c] = (int16) ((buffer[2 * c] << 8) | buffer[2 * c + 1]);
+        }
+    }
+
+    MPU6050_Sim_Close(fd);
+
+    memset(&DevPtr->Cal, 0x00, sizeof(DevPtr->Cal));
+    for (i = 0; i < 3; i++)
+    {
+        DevPtr->Cal.accelBias[i]      = 0.01;
+        DevPtr->Cal.gyroBias[i]       = 0.5;
+        DevPtr->Cal.accelMatrix[i][i] = 1.0;
+        DevPtr->Cal.gyroMatrix[i][i]  = 1.0;
+    }
+
+    memset(&DevPtr->Att, 0x00, sizeof(DevPtr->Att));
+    memset(DevPtr->adQuat, 0x00, sizeof(DevPtr->adQuat));
+    memset(DevPtr->aiQuat, 0x00, sizeof(DevPtr->aiQuat));
+    DevPtr->adQuat[0] = 1.0;
+    DevPtr->aiQuat[0] = MPU6050_Q30_ONE;
+    MPU6050_Motion_Init(&DevPtr->Motion, MPU6050_BENCH_MOTION_WIN);
+    MPU6050_Fixed_MotionInit(&DevPtr->MotionQ, MPU6050_BENCH_MOTION_WIN);
+    MPU6050_Fixed_Prepare(&DevPtr->FixedCal, MPU6050_AccelFullScale(MPU6050_ACCELSCALE_2G),
+                          MPU6050_GyroFullScale(MPU6050_GYROSCALE_250DPS), &DevPtr->Cal);
+    MPU6050_TimeModel_Init(&DevPtr->TimeModel, 1.0 / MPU6050_BENCH_RATE_HZ);
+    DevPtr->dReadTime = 1.0;
+    voteCfg.dAccelTolG       = 0.05;
+    voteCfg.dGyroTolDps      = 2.0;
+    voteCfg.uiMaxGapNsec     = 100000000;
+    voteCfg.uiLatencyNsec    = 200000000;
+    voteCfg.usFaultPersist   = 10;
+    voteCfg.usRecoverPersist = 100;
+    MPU6050_Vote_Init(&DevPtr->Vote, MPU6050_VOTE_MAX_MEMBERS, &voteCfg);
+    DevPtr->uiVoteTime = 1000000000;
+
+    /* Later cases start from calibrated samples */
+    MPU6050_Bench_Convert(DevPtr, MPU6050_BENCH_MAX_BATCH);
+    MPU6050_Bench_ConvertQ(DevPtr, MPU6050_BENCH_MAX_BATCH);
+
+    return 0;
+}
+
+/* Time one case until MinNsec have passed */
+static void MPU6050_Bench_Run(const MPU6050_BenchCase_t *CasePtr, uint32 BatchSize, uint32 DevCnt,
+                              uint64 MinNsec)
+{
+    MPU6050_BenchResult_t *resultPtr;
+    uint64 start;
+    uint64 elapsed;
+    uint64 reps = 0;
+    uint32 sink = 0;
+    uint32 d;
+
+    /* Warm the caches and branch predictors */
+    for (d = 0; d < DevCnt; d++)
+    {
+        sink += CasePtr->Run(&MPU6050_BenchDev[d], BatchSize);
+    }
+
+    start = MPU6050_DiagNow();
+    do
+    {
+        for (d = 0; d < DevCnt; d++)
+        {
+            sink += CasePtr->Run(&MPU6050_BenchDev[d], BatchSize);
+        }
+        reps++;
+        elapsed = MPU6050_DiagNow() - start;
+    } while (elapsed < MinNsec);
+
+    MPU6050_BenchSink += sink;
+
+    if (MPU6050_BenchResultCnt < MPU6050_BENCH_MAX_RESULTS)
+    {
+        resultPtr = &MPU6050_BenchResult[MPU6050_BenchResultCnt++];
+        resultPtr->Name         = CasePtr->Name;
+        resultPtr->uiBatch      = BatchSize;
+        resultPtr->uiDevices    = DevCnt;
+        resultPtr->uiSamples    = reps * DevCnt * BatchSize;
+        resultPtr->dNsPerSample = (double) elapsed / (double) resultPtr->uiSamples;
+    }
+}
+
+static void MPU6050_Bench_WriteJson(FILE *FilePtr, double MinSec)
+{
+    const MPU6050_BenchResult_t *resultPtr;
+    uint32 i;
+
+    fprintf(FilePtr, "{\n");
+    fprintf(FilePtr, "  \"benchmark\": \"mpu6050\",\n");
+    fprintf(FilePtr, "  \"min_time_sec\": %g,\n", MinSec);
+    fprintf(FilePtr, "  \"results\": [\n");
+    for (i = 0; i < MPU6050_BenchResultCnt; i++)
+    {
+        resultPtr = &MPU6050_BenchResult[i];
+        fprintf(FilePtr, "    {\"case\": \"%s\", \"batch\": %u, \"devices\": %u, \"samples\": %llu, "
+                "\"ns_per_sample\": %.3f, \"samples_per_sec\": %.0f}%s\n",
+                resultPtr->Name, resultPtr->uiBatch, resultPtr->uiDevices,
+                (unsigned long long) resultPtr->uiSamples, resultPtr->dNsPerSample,
+                1e9 / resultPtr->dNsPerSample, (i + 1 < MPU6050_BenchResultCnt) ? "," : "");
+    }
+    fprintf(FilePtr, "  ]\n");
+    fprintf(FilePtr, "}\n");
+}
+
+/* Number following "Key": on a line, or -1 */
+static double MPU6050_Bench_JsonNumber(const char *Line, const char *Key)
+{
+    const char *valPtr = strstr(Line, Key);
+
+    return (valPtr != NULL) ? strtod(valPtr + strlen(Key), NULL) : -1.0;
+}
+
+/* Count the cases slower than in BaselinePath by more than TolerancePct */
+static int32 MPU6050_Bench_Compare(const char *BaselinePath, double TolerancePct)
+{
+    const MPU6050_BenchResult_t *resultPtr;
+    FILE  *filePtr;
+    char   line[512];
+    char   name[64];
+    const char *namePtr;
+    double baseNs;
+    int32  regressions = 0;
+    uint32 batch;
+    uint32 devices;
+    uint32 i;
+
+    filePtr = fopen(BaselinePath, "r");
+    if (filePtr == NULL)
+    {
+        perror(BaselinePath);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), filePtr) != NULL)
+    {
+        namePtr = strstr(line, "\"case\": \"");
+        if (namePtr == NULL || sscanf(namePtr + 9, "%63[^\"]", name) != 1)
+        {
+            continue;
+        }
+
+        batch   = (uint32) MPU6050_Bench_JsonNumber(line, "\"batch\":");
+        devices = (uint32) MPU6050_Bench_JsonNumber(line, "\"devices\":");
+        baseNs  = MPU6050_Bench_JsonNumber(line, "\"ns_per_sample\":");
+
+        for (i = 0; i < MPU6050_BenchResultCnt; i++)
+        {
+            resultPtr = &MPU6050_BenchResult[i];
+            if (strcmp(resultPtr->Name, name) == 0 && resultPtr->uiBatch == batch &&
+                resultPtr->uiDevices == devices && baseNs > 0.0 &&
+                resultPtr->dNsPerSample > baseNs * (1.0 + TolerancePct / 100.0))
+            {
+                fprintf(stderr, "REGRESSION %s batch %u devices %u: %.3f -> %.3f ns/sample (+%.1f%%)\n",
+                        name, batch, devices, baseNs, resultPtr->dNsPerSample,
+                        (resultPtr->dNsPerSample / baseNs - 1.0) * 100.0);
+                regressions++;
+            }
+        }
+    }
+
+    fclose(filePtr);
+
+    return regressions;
+}
+
+/* Parse "1,10,50" into List; the count, or 0 if any entry is out of 1..Max */
+static uint32 MPU6050_Bench_ParseList(const char *Arg, uint32 *List, uint32 Max)
+{
+    char  *endPtr;
+    uint32 cnt = 0;
+    long   val;
+
+    while (*Arg != '\0' && cnt < MPU6050_BENCH_MAX_LIST)
+    {
+        val = strtol(Arg, &endPtr, 10);
+        if (endPtr == Arg || val < 1 || (unsigned long) val > Max)
+        {
+            return 0;
+        }
+        if (*endPtr != ',' && *endPtr != '\0')
+        {
+            return 0;
+        }
+        List[cnt++] = (uint32) val;
+        Arg = (*endPtr == ',') ? endPtr + 1 : endPtr;
+    }
+
+    return cnt;
+}
+
+/*
+** Function Definitions
+*/
+
+int main(int argc, char *argv[])
+{
+    uint32 batches[MPU6050_BENCH_MAX_LIST] = {1, 10, 50, MPU6050_BENCH_MAX_BATCH};
+    uint32 devices[MPU6050_BENCH_MAX_LIST] = {1, 4};
+    uint32 batchCnt     = 4;
+    uint32 deviceCnt    = 2;
+    uint32 maxDevices   = 0;
+    double minSec       = 0.2;
+    double tolerancePct = 10.0;
+    const char *outPath      = NULL;
+    const char *baselinePath = NULL;
+    FILE  *outPtr = stdout;
+    int32  regressions = 0;
+    uint32 c;
+    uint32 b;
+    uint32 d;
+    int    opt;
+
+    while ((opt = getopt(argc, argv, "b:d:t:o:B:T:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'b':
+                batchCnt = MPU6050_Bench_ParseList(optarg, batches, MPU6050_BENCH_MAX_BATCH);
+                break;
+            case 'd':
+                deviceCnt = MPU6050_Bench_ParseList(optarg, devices, MPU6050_BENCH_MAX_DEVICES);
+                break;
+            case 't':
+                minSec = atof(optarg);
+                break;
+            case 'o':
+                outPath = optarg;
+                break;
+            case 'B':
+                baselinePath = optarg;
+                break;
+            case 'T':
+                tolerancePct = atof(optarg);
+                break;
+            default:
+                batchCnt = 0;
+                break;
+        }
+    }
+
+    if (batchCnt == 0 || deviceCnt == 0 || minSec <= 0.0)
+    {
+        fprintf(stderr, "usage: %s [-b batches] [-d devices] [-t sec] [-o out.json] "
+                "[-B baseline.json] [-T pct]\n", argv[0]);
+        return 2;
+    }
+
+    for (d = 0; d < deviceCnt; d++)
+    {
+        maxDevices = (devices[d] > maxDevices) ? devices[d] : maxDevices;
+    }
+
+    for (d = 0; d < maxDevices; d++)
+    {
+        if (MPU6050_Bench_InitDev(&MPU6050_BenchDev[d], d) != 0)
+        {
+            fprintf(stderr, "Could not open a simulated device\n");
+            return 2;
+        }
+    }
+
+    for (c = 0; c < MPU6050_BENCH_CASE_CNT; c++)
+    {
+        for (b = 0; b < batchCnt; b++)
+        {
+            for (d = 0; d < deviceCnt; d++)
+            {
+                MPU6050_Bench_Run(&MPU6050_BenchCase[c], batches[b], devices[d], (uint64) (minSec * 1e9));
+            }
+        }
+    }
+
+    if (outPath != NULL)
+    {
+        outPtr = fopen(outPath, "w");
+        if (outPtr == NULL)
+        {
+            perror(outPath);
+            return 2;
+        }
+    }
+
+    MPU6050_Bench_WriteJson(outPtr, minSec);
+
+    if (outPtr != stdout)
+    {
+        fclose(outPtr);
+    }
+
+    if (baselinePath != NULL)
+    {
+        regressions = MPU6050_Bench_Compare(baselinePath, tolerancePct);
+        if (regressions < 0)
+        {
+            return 2;
+        }
+    }
+
+    return (regressions > 0) ? 1 : 0;
+}
+
+/*=======================================================================================
+** End of file mpu6050_bench.c
+**=====================================================================================*/
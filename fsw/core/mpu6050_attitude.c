@@ -0,0 +1,90 @@
+/*=======================================================================================
+** File Name:  mpu6050_attitude.c
+**
+** Title:  Attitude Propagation for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To propagate the attitude from the calibrated gyro rates, once per cycle.
+**
+** Functions Defined:
+**    MPU6050_Attitude_Increment     - Angle increments of a sample over an interval
+**    MPU6050_Attitude_QuatPropagate - Rotate the attitude quaternion by increments
+**    MPU6050_Attitude_QuatToEuler   - Euler angles of the attitude quaternion
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Split out of MPU6050_AppMain, so it can be benchmarked without cFE.
+** 2: The attitude is carried as a unit quaternion [w x y z] from body to reference
+**    and integrated to first order; it used to be Euler angles, which lose an axis at
+**    90 degrees of pitch.  The Euler angles are roll, pitch and yaw in Z-Y-X order,
+**    roll and yaw in (-pi, pi] and pitch in [-pi/2, pi/2].
+** 3: MPU6050_Fixed_QuatPropagate is the same integration in fixed point; keep the
+**    two in step.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <math.h>
+
+#include "mpu6050_attitude.h"
+
+/*
+** Local Function Definitions
+*/
+
+void MPU6050_Attitude_Increment(const double GyroDps[3], double Dt, double Delta[3])
+{
+    Delta[0] = 2.0 * M_PI * GyroDps[0] * Dt / 180.0;
+    Delta[1] = 2.0 * M_PI * GyroDps[1] * Dt / 180.0;
+    Delta[2] = 2.0 * M_PI * GyroDps[2] * Dt / 180.0;
+}
+
+void MPU6050_Attitude_QuatPropagate(double Quat[4], const double Delta[3])
+{
+    double w = Quat[0];
+    double x = Quat[1];
+    double y = Quat[2];
+    double z = Quat[3];
+    double norm;
+
+    /* q += q (x) (0, Delta) / 2, then back to unit length */
+    Quat[0] = w + 0.5 * (-x * Delta[0] - y * Delta[1] - z * Delta[2]);
+    Quat[1] = x + 0.5 * ( w * Delta[0] + y * Delta[2] - z * Delta[1]);
+    Quat[2] = y + 0.5 * ( w * Delta[1] - x * Delta[2] + z * Delta[0]);
+    Quat[3] = z + 0.5 * ( w * Delta[2] + x * Delta[1] - y * Delta[0]);
+
+    norm = sqrt(Quat[0] * Quat[0] + Quat[1] * Quat[1] + Quat[2] * Quat[2] + Quat[3] * Quat[3]);
+    Quat[0] /= norm;
+    Quat[1] /= norm;
+    Quat[2] /= norm;
+    Quat[3] /= norm;
+}
+
+void MPU6050_Attitude_QuatToEuler(const double Quat[4], MPU6050_Attitude_t *AttPtr)
+{
+    double w = Quat[0];
+    double x = Quat[1];
+    double y = Quat[2];
+    double z = Quat[3];
+    double sinPhi = 2.0 * (w * x + y * z);
+    double cosPhi = 1.0 - 2.0 * (x * x + y * y);
+
+    /* cos(theta) is the length of the roll arguments; unlike asin this keeps its
+    ** precision near +-90 degrees */
+    AttPtr->phi   = atan2(sinPhi, cosPhi);
+    AttPtr->theta = atan2(2.0 * (w * y - z * x), sqrt(sinPhi * sinPhi + cosPhi * cosPhi));
+    AttPtr->psi   = atan2(2.0 * (w * z + x * y), 1.0 - 2.0 * (y * y + z * z));
+}
+
+/*=======================================================================================
+** End of file mpu6050_attitude.c
+**=====================================================================================*/
@@ -0,0 +1,45 @@
+/*=======================================================================================
+** File Name:  mpu6050_attitude.h
+**
+** Title:  Attitude Propagation Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the attitude propagation from gyro rates.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_ATTITUDE_H_
+#define _MPU6050_ATTITUDE_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "mpu6050_core_types.h"
+
+/*
+** Function Prototypes
+*/
+
+/* Angle increments (rad) about X/Y/Z of gyro rates held for Dt seconds */
+void MPU6050_Attitude_Increment(const double GyroDps[3], double Dt, double Delta[3]);
+
+/* Rotate the attitude quaternion [w x y z] by the increments and renormalize */
+void MPU6050_Attitude_QuatPropagate(double Quat[4], const double Delta[3]);
+
+/* Roll, pitch and yaw of the attitude quaternion */
+void MPU6050_Attitude_QuatToEuler(const double Quat[4], MPU6050_Attitude_t *AttPtr);
+
+#endif /* _MPU6050_ATTITUDE_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_attitude.h
+**=====================================================================================*/
@@ -0,0 +1,277 @@
+/*=======================================================================================
+** File Name:  mpu6050_compress.c
+**
+** Title:  Sample Stream Compression for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To code blocks of raw samples losslessly with per-channel prediction and
+**           Rice codes, and to decode them again on the ground.
+**
+** Functions Defined:
+**    MPU6050_CompressBlock   - Code one block of samples
+**    MPU6050_DecompressBlock - Reference decoder for one block
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Block layout, MSB first:
+**        8 bits   sample count N
+**        then for each of the 7 channels:
+**            16 bits  first sample, verbatim
+**            1 bit    predictor: 0 = previous sample, 1 = linear extrapolation
+**                     from the two previous samples (the second sample of a block
+**                     always uses the previous sample)
+**            5 bits   Rice parameter k
+**            N-1 residuals, zigzag mapped to unsigned, each coded as
+**                q = u >> k in unary (q ones and a zero) followed by the low k bits
+**                of u, or, when q >= MPU6050_COMP_ESCAPE_Q, as MPU6050_COMP_ESCAPE_Q
+**                ones followed by u in MPU6050_COMP_ESCAPE_BITS bits
+**    The final byte is zero padded.
+** 2: The encoder makes two passes over each channel, touches no memory other than its
+**    arguments and never codes a residual in more than MPU6050_COMP_MAX_CODE_BITS bits,
+**    so its run time and output size are bounded by the sample count.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include "mpu6050_compress.h"
+
+/*
+** Local Defines
+*/
+#define MPU6050_COMP_MAX_K  18
+
+/*
+** Local Structure Declarations
+*/
+typedef struct
+{
+    uint8  *BufPtr;
+    uint32  BufSize;
+    uint32  ByteCnt;
+    uint64  Acc;      /* Pending bits, right aligned */
+    uint32  AccBits;
+} MPU6050_BitWriter_t;
+
+typedef struct
+{
+    const uint8 *BufPtr;
+    uint32       BufSize;
+    uint32       BitPos;
+} MPU6050_BitReader_t;
+
+/*
+** Local Function Definitions
+*/
+
+static uint32 MPU6050_ZigZag(int32 r)
+{
+    return (((uint32) r) << 1) ^ ((uint32) (r >> 31));
+}
+
+static int32 MPU6050_UnZigZag(uint32 u)
+{
+    return ((int32) (u >> 1)) ^ -((int32) (u & 1));
+}
+
+/* Prediction residual of sample n of channel c */
+static int32 MPU6050_Residual(const int16 Samples[][MPU6050_COMP_CHANNELS], uint32 n, uint32 c, uint32 Order)
+{
+    if (Order == 0 || n < 2)
+    {
+        return (int32) Samples[n][c] - (int32) Samples[n - 1][c];
+    }
+
+    return (int32) Samples[n][c] - (2 * (int32) Samples[n - 1][c] - (int32) Samples[n - 2][c]);
+}
+
+/* Append the low Bits bits of Value (Bits <= 32); false once the buffer is full */
+static bool MPU6050_PutBits(MPU6050_BitWriter_t *Writer, uint32 Value, uint32 Bits)
+{
+    Writer->Acc      = (Writer->Acc << Bits) | (Value & (uint32) ((((uint64) 1) << Bits) - 1));
+    Writer->AccBits += Bits;
+
+    while (Writer->AccBits >= 8)
+    {
+        if (Writer->ByteCnt >= Writer->BufSize)
+        {
+            return false;
+        }
+        Writer->AccBits -= 8;
+        Writer->BufPtr[Writer->ByteCnt++] = (uint8) (Writer->Acc >> Writer->AccBits);
+    }
+
+    return true;
+}
+
+static bool MPU6050_GetBits(MPU6050_BitReader_t *Reader, uint32 Bits, uint32 *Value)
+{
+    uint32 i;
+
+    if (Reader->BitPos + Bits > Reader->BufSize * 8)
+    {
+        return false;
+    }
+
+    *Value = 0;
+    for (i = 0; i < Bits; i++)
+    {
+        *Value = (*Value << 1) |
+                 ((Reader->BufPtr[Reader->BitPos >> 3] >> (7 - (Reader->BitPos & 7))) & 1);
+        Reader->BitPos++;
+    }
+
+    return true;
+}
+
+uint32 MPU6050_CompressBlock(const int16 Samples[][MPU6050_COMP_CHANNELS], uint32 SampleCnt,
+                             uint8 *BufPtr, uint32 BufSize)
+{
+    MPU6050_BitWriter_t writer = {BufPtr, BufSize, 0, 0, 0};
+    bool   ok;
+    uint64 sum[2];
+    uint64 best;
+    uint32 order, k, u, q;
+    uint32 c, n;
+
+    if (SampleCnt == 0 || SampleCnt > MPU6050_COMP_MAX_SAMPLES)
+    {
+        return 0;
+    }
+
+    ok = MPU6050_PutBits(&writer, SampleCnt, 8);
+
+    for (c = 0; c < MPU6050_COMP_CHANNELS && ok; c++)
+    {
+        /* Pick the predictor with the smaller residuals, and k to match their mean */
+        sum[0] = 0;
+        sum[1] = 0;
+        for (n = 1; n < SampleCnt; n++)
+        {
+            sum[0] += MPU6050_ZigZag(MPU6050_Residual(Samples, n, c, 0));
+            sum[1] += MPU6050_ZigZag(MPU6050_Residual(Samples, n, c, 1));
+        }
+
+        order = (sum[1] < sum[0]) ? 1 : 0;
+        best  = sum[order];
+
+        k = 0;
+        while (k < MPU6050_COMP_MAX_K && (((uint64) (SampleCnt - 1)) << (k + 1)) <= best)
+        {
+            k++;
+        }
+
+        ok = MPU6050_PutBits(&writer, (uint16) Samples[0][c], 16) &&
+             MPU6050_PutBits(&writer, order, 1) &&
+             MPU6050_PutBits(&writer, k, 5);
+
+        for (n = 1; n < SampleCnt && ok; n++)
+        {
+            u = MPU6050_ZigZag(MPU6050_Residual(Samples, n, c, order));
+            q = u >> k;
+
+            if (q < MPU6050_COMP_ESCAPE_Q)
+            {
+                /* q ones, a zero, then the k low bits */
+                ok = MPU6050_PutBits(&writer, ((1u << q) - 1) << 1, q + 1) &&
+                     MPU6050_PutBits(&writer, u, k);
+            }
+            else
+            {
+                ok = MPU6050_PutBits(&writer, (1u << MPU6050_COMP_ESCAPE_Q) - 1, MPU6050_COMP_ESCAPE_Q) &&
+                     MPU6050_PutBits(&writer, u, MPU6050_COMP_ESCAPE_BITS);
+            }
+        }
+    }
+
+    /* Pad out the last byte */
+    if (ok && writer.AccBits > 0)
+    {
+        ok = MPU6050_PutBits(&writer, 0, 8 - writer.AccBits);
+    }
+
+    return ok ? writer.ByteCnt : 0;
+}
+
+int32 MPU6050_DecompressBlock(const uint8 *BufPtr, uint32 BufSize,
+                              int16 Samples[][MPU6050_COMP_CHANNELS], uint32 MaxSamples)
+{
+    MPU6050_BitReader_t reader = {BufPtr, BufSize, 0};
+    uint32 sampleCnt, first, order, k, bit, low, u, q;
+    uint32 c, n;
+    int32  value;
+
+    if (!MPU6050_GetBits(&reader, 8, &sampleCnt) || sampleCnt == 0 || sampleCnt > MaxSamples)
+    {
+        return -1;
+    }
+
+    for (c = 0; c < MPU6050_COMP_CHANNELS; c++)
+    {
+        if (!MPU6050_GetBits(&reader, 16, &first) ||
+            !MPU6050_GetBits(&reader, 1, &order) ||
+            !MPU6050_GetBits(&reader, 5, &k) || k > MPU6050_COMP_MAX_K)
+        {
+            return -1;
+        }
+
+        Samples[0][c] = (int16) first;
+
+        for (n = 1; n < sampleCnt; n++)
+        {
+            q = 0;
+            do
+            {
+                if (!MPU6050_GetBits(&reader, 1, &bit))
+                {
+                    return -1;
+                }
+                q += bit;
+            } while (bit == 1 && q < MPU6050_COMP_ESCAPE_Q);
+
+            if (q < MPU6050_COMP_ESCAPE_Q)
+            {
+                if (!MPU6050_GetBits(&reader, k, &low))
+                {
+                    return -1;
+                }
+                u = (q << k) | low;
+            }
+            else if (!MPU6050_GetBits(&reader, MPU6050_COMP_ESCAPE_BITS, &u))
+            {
+                return -1;
+            }
+
+            value = MPU6050_UnZigZag(u);
+            if (order == 0 || n < 2)
+            {
+                value += Samples[n - 1][c];
+            }
+            else
+            {
+                value += 2 * (int32) Samples[n - 1][c] - (int32) Samples[n - 2][c];
+            }
+
+            if (value < -32768 || value > 32767)
+            {
+                return -1;
+            }
+
+            Samples[n][c] = (int16) value;
+        }
+    }
+
+    return (int32) sampleCnt;
+}
+
+/*=======================================================================================
+** End of file mpu6050_compress.c
+**=====================================================================================*/
@@ -0,0 +1,72 @@
+/*=======================================================================================
+** File Name:  mpu6050_compress.h
+**
+** Title:  Sample Stream Compression Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the lossless block coder for raw sample streams and its
+**           reference decoder.  Only common_types.h is needed, so ground software can
+**           build mpu6050_compress.c on its own.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_COMPRESS_H_
+#define _MPU6050_COMPRESS_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*
+** Local Defines
+*/
+
+/* Channels per sample: accel X/Y/Z, temperature, gyro X/Y/Z (MPU6050_RawSample_t order) */
+#define MPU6050_COMP_CHANNELS        7
+
+/* Most samples one block can hold (the sample count is coded in 8 bits) */
+#define MPU6050_COMP_MAX_SAMPLES     255
+
+/* Residual quotients at or above this are escaped to a fixed-width code */
+#define MPU6050_COMP_ESCAPE_Q        16
+#define MPU6050_COMP_ESCAPE_BITS     18
+
+/* Bits of block and channel headers, and the worst case bits of one coded residual */
+#define MPU6050_COMP_BLOCK_HDR_BITS  8
+#define MPU6050_COMP_CHAN_HDR_BITS   (16 + 1 + 5)
+#define MPU6050_COMP_MAX_CODE_BITS   (MPU6050_COMP_ESCAPE_Q + MPU6050_COMP_ESCAPE_BITS)
+
+/* Buffer size that always holds a block of n samples */
+#define MPU6050_COMP_MAX_BLOCK_BYTES(n) \
+    ((MPU6050_COMP_BLOCK_HDR_BITS + MPU6050_COMP_CHANNELS * \
+      (MPU6050_COMP_CHAN_HDR_BITS + ((n) - 1) * MPU6050_COMP_MAX_CODE_BITS) + 7) / 8)
+
+/*
+** Function Prototypes
+*/
+
+/* Code SampleCnt samples of MPU6050_COMP_CHANNELS interleaved int16 channels into one
+** self-contained block.  Returns the block length in bytes, or 0 if SampleCnt is out
+** of range or the block does not fit in BufSize. */
+uint32 MPU6050_CompressBlock(const int16 Samples[][MPU6050_COMP_CHANNELS], uint32 SampleCnt,
+                             uint8 *BufPtr, uint32 BufSize);
+
+/* Reference decoder.  Returns the number of samples decoded into Samples, or -1 if the
+** block is malformed or holds more than MaxSamples samples. */
+int32  MPU6050_DecompressBlock(const uint8 *BufPtr, uint32 BufSize,
+                               int16 Samples[][MPU6050_COMP_CHANNELS], uint32 MaxSamples);
+
+#endif /* _MPU6050_COMPRESS_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_compress.h
+**=====================================================================================*/
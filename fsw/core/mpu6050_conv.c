@@ -0,0 +1,286 @@
+/*=======================================================================================
+** File Name:  mpu6050_conv.c
+**
+** Title:  Sample Conversion for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To convert raw samples to engineering units, for the app and for consumers
+**           of the raw output packets.
+**
+** Functions Defined:
+**    MPU6050_AccelFullScale   - Accelerometer range of a scale code
+**    MPU6050_GyroFullScale    - Gyro range of a scale code
+**    MPU6050_RawTempToDegC    - Die temperature of a raw reading
+**    MPU6050_ConvertRaw       - Raw sample to calibrated engineering units
+**    MPU6050_ChannelCnt       - Channels in a channel mask
+**    MPU6050_PackRaw          - Raw sample to the channels in a mask, back to back
+**    MPU6050_UnpackRaw        - The reverse, with the channels not in the mask 0
+**    MPU6050_PackCalibrated   - Calibrated sample to the axes in a mask, back to back
+**    MPU6050_UnpackCalibrated - The reverse, with the axes not in the mask 0
+**    MPU6050_UnpackSample     - Raw sample from the big endian bytes of a device read
+**    MPU6050_FifoChannels     - Channels the FIFO queues for a channel mask
+**    MPU6050_RegisterSpan     - Channels of the data register burst covering a mask
+**    MPU6050_GetSampleRateHz  - Output data rate of SMPLRT_DIV and DLPF_CFG
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Counts are scaled in single precision exactly as the flight code always has, then
+**    calibrated in double precision.  Do not "simplify" the arithmetic; receivers rely
+**    on bit-identical results.
+** 2: An axis outside the channel mask converts to 0.  The other axes of its sensor are
+**    calibrated as if it read 0, so a misalignment term through it is lost.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <string.h>
+
+#include "mpu6050_registers.h"
+#include "mpu6050_conv.h"
+
+/*
+** Local Function Definitions
+*/
+
+/* Calibrated = Matrix * (Scaled - Bias) */
+static void MPU6050_ApplyCal(const double Bias[3], const double Matrix[3][3], const double In[3], double Out[3])
+{
+    double x = In[0] - Bias[0];
+    double y = In[1] - Bias[1];
+    double z = In[2] - Bias[2];
+
+    Out[0] = Matrix[0][0] * x + Matrix[0][1] * y + Matrix[0][2] * z;
+    Out[1] = Matrix[1][0] * x + Matrix[1][1] * y + Matrix[1][2] * z;
+    Out[2] = Matrix[2][0] * x + Matrix[2][1] * y + Matrix[2][2] * z;
+}
+
+float MPU6050_AccelFullScale(uint8 AccelScale)
+{
+    switch (AccelScale)
+    {
+        case MPU6050_ACCELSCALE_2G:
+            return 2.0;
+        case MPU6050_ACCELSCALE_4G:
+            return 4.0;
+        case MPU6050_ACCELSCALE_8G:
+            return 8.0;
+        case MPU6050_ACCELSCALE_16G:
+            return 16.0;
+        default:
+            return 0.0;
+    }
+}
+
+float MPU6050_GyroFullScale(uint8 GyroScale)
+{
+    switch (GyroScale)
+    {
+        case MPU6050_GYROSCALE_250DPS:
+            return 250.0;
+        case MPU6050_GYROSCALE_500DPS:
+            return 500.0;
+        case MPU6050_GYROSCALE_1000DPS:
+            return 1000.0;
+        case MPU6050_GYROSCALE_2000DPS:
+            return 2000.0;
+        default:
+            return 0.0;
+    }
+}
+
+double MPU6050_RawTempToDegC(int16 RawTemp)
+{
+    /* Register map rev 4.2, section 4.18 */
+    return ((double) RawTemp) / 340.0 + 36.53;
+}
+
+void MPU6050_ConvertRaw(const MPU6050_RawSample_t *RawPtr, uint8 Channels, float GeeScale, float RateScale,
+                        const MPU6050_Calibration_t *CalPtr, MPU6050_Sample_t *SamplePtr)
+{
+    double scaled[3];
+    double calibrated[3];
+
+    memset(SamplePtr, 0x00, sizeof(*SamplePtr));
+
+    float readingAccelX = (float) RawPtr->accel[0] / 65535.0;
+    float readingAccelY = (float) RawPtr->accel[1] / 65535.0;
+    float readingAccelZ = (float) RawPtr->accel[2] / 65535.0;
+
+    float readingGyroX  = (float) RawPtr->gyro[0] / 65535.0;
+    float readingGyroY  = (float) RawPtr->gyro[1] / 65535.0;
+    float readingGyroZ  = (float) RawPtr->gyro[2] / 65535.0;
+
+    if (Channels & MPU6050_CHAN_ACCEL)
+    {
+        scaled[0] = GeeScale * readingAccelX;
+        scaled[1] = GeeScale * readingAccelY;
+        scaled[2] = GeeScale * readingAccelZ;
+        MPU6050_ApplyCal(CalPtr->accelBias, CalPtr->accelMatrix, scaled, calibrated);
+
+        SamplePtr->accelXGees = (Channels & MPU6050_CHAN_ACCEL_X) ? calibrated[0] : 0.0;
+        SamplePtr->accelYGees = (Channels & MPU6050_CHAN_ACCEL_Y) ? calibrated[1] : 0.0;
+        SamplePtr->accelZGees = (Channels & MPU6050_CHAN_ACCEL_Z) ? calibrated[2] : 0.0;
+    }
+
+    if (Channels & MPU6050_CHAN_GYRO)
+    {
+        scaled[0] = RateScale * readingGyroX;
+        scaled[1] = RateScale * readingGyroY;
+        scaled[2] = RateScale * readingGyroZ;
+        MPU6050_ApplyCal(CalPtr->gyroBias, CalPtr->gyroMatrix, scaled, calibrated);
+
+        SamplePtr->gyroXDegsSec = (Channels & MPU6050_CHAN_GYRO_X) ? calibrated[0] : 0.0;
+        SamplePtr->gyroYDegsSec = (Channels & MPU6050_CHAN_GYRO_Y) ? calibrated[1] : 0.0;
+        SamplePtr->gyroZDegsSec = (Channels & MPU6050_CHAN_GYRO_Z) ? calibrated[2] : 0.0;
+    }
+}
+
+uint32 MPU6050_ChannelCnt(uint8 Channels)
+{
+    return (uint32) __builtin_popcount(Channels & MPU6050_CHAN_ALL);
+}
+
+uint32 MPU6050_PackRaw(const MPU6050_RawSample_t *RawPtr, uint8 Channels, int16 *Packed)
+{
+    /* MPU6050_RawSample_t is the channels in mask bit order */
+    const int16 *channel = (const int16*) RawPtr;
+    uint32       cnt     = 0;
+    uint32       c;
+
+    if ((Channels & MPU6050_CHAN_ALL) == MPU6050_CHAN_ALL)
+    {
+        memcpy(Packed, RawPtr, sizeof(*RawPtr));
+        return sizeof(*RawPtr) / sizeof(int16);
+    }
+
+    for (c = 0; c < sizeof(*RawPtr) / sizeof(int16); c++)
+    {
+        if (Channels & (1 << c))
+        {
+            Packed[cnt++] = channel[c];
+        }
+    }
+
+    return cnt;
+}
+
+uint32 MPU6050_UnpackRaw(const int16 *Packed, uint8 Channels, MPU6050_RawSample_t *RawPtr)
+{
+    int16  *channel = (int16*) RawPtr;
+    uint32  cnt     = 0;
+    uint32  c;
+
+    for (c = 0; c < sizeof(*RawPtr) / sizeof(int16); c++)
+    {
+        channel[c] = (Channels & (1 << c)) ? Packed[cnt++] : 0;
+    }
+
+    return cnt;
+}
+
+uint32 MPU6050_PackCalibrated(const MPU6050_Sample_t *SamplePtr, uint8 Channels, double *Packed)
+{
+    uint32 cnt = 0;
+
+    if (Channels & MPU6050_CHAN_ACCEL_X) Packed[cnt++] = SamplePtr->accelXGees;
+    if (Channels & MPU6050_CHAN_ACCEL_Y) Packed[cnt++] = SamplePtr->accelYGees;
+    if (Channels & MPU6050_CHAN_ACCEL_Z) Packed[cnt++] = SamplePtr->accelZGees;
+    if (Channels & MPU6050_CHAN_GYRO_X)  Packed[cnt++] = SamplePtr->gyroXDegsSec;
+    if (Channels & MPU6050_CHAN_GYRO_Y)  Packed[cnt++] = SamplePtr->gyroYDegsSec;
+    if (Channels & MPU6050_CHAN_GYRO_Z)  Packed[cnt++] = SamplePtr->gyroZDegsSec;
+
+    return cnt;
+}
+
+uint32 MPU6050_UnpackCalibrated(const double *Packed, uint8 Channels, MPU6050_Sample_t *SamplePtr)
+{
+    uint32 cnt = 0;
+
+    SamplePtr->accelXGees   = (Channels & MPU6050_CHAN_ACCEL_X) ? Packed[cnt++] : 0.0;
+    SamplePtr->accelYGees   = (Channels & MPU6050_CHAN_ACCEL_Y) ? Packed[cnt++] : 0.0;
+    SamplePtr->accelZGees   = (Channels & MPU6050_CHAN_ACCEL_Z) ? Packed[cnt++] : 0.0;
+    SamplePtr->gyroXDegsSec = (Channels & MPU6050_CHAN_GYRO_X)  ? Packed[cnt++] : 0.0;
+    SamplePtr->gyroYDegsSec = (Channels & MPU6050_CHAN_GYRO_Y)  ? Packed[cnt++] : 0.0;
+    SamplePtr->gyroZDegsSec = (Channels & MPU6050_CHAN_GYRO_Z)  ? Packed[cnt++] : 0.0;
+
+    return cnt;
+}
+
+/* Decode one big endian sample from a register or FIFO read. The buffer holds the
+ * channels in present, in order; those not also in keep are left 0. */
+void MPU6050_UnpackSample(const uint8 *buffer, uint8 present, uint8 keep, MPU6050_RawSample_t *sample)
+{
+    /* MPU6050_RawSample_t is the 7 channels in register order */
+    int16 *channel = (int16*) sample;
+    uint32 c;
+
+    if (present == MPU6050_CHAN_ALL && keep == MPU6050_CHAN_ALL)
+    {
+        sample->accel[0] = (int16) ((buffer[0]  << 8) | buffer[1]);
+        sample->accel[1] = (int16) ((buffer[2]  << 8) | buffer[3]);
+        sample->accel[2] = (int16) ((buffer[4]  << 8) | buffer[5]);
+        sample->temp     = (int16) ((buffer[6]  << 8) | buffer[7]);
+        sample->gyro[0]  = (int16) ((buffer[8]  << 8) | buffer[9]);
+        sample->gyro[1]  = (int16) ((buffer[10] << 8) | buffer[11]);
+        sample->gyro[2]  = (int16) ((buffer[12] << 8) | buffer[13]);
+        return;
+    }
+
+    for (c = 0; c < MPU6050_SAMPLE_BYTES / MPU6050_CHANNEL_BYTES; c++)
+    {
+        channel[c] = 0;
+        if (present & (1 << c))
+        {
+            if (keep & (1 << c))
+            {
+                channel[c] = (int16) ((buffer[0] << 8) | buffer[1]);
+            }
+            buffer += MPU6050_CHANNEL_BYTES;
+        }
+    }
+}
+
+/* Channels the FIFO queues to sample the given ones; FIFO_EN has one bit for all accel axes */
+uint8 MPU6050_FifoChannels(uint8 channels)
+{
+    return (channels & MPU6050_CHAN_ACCEL) ? (channels | MPU6050_CHAN_ACCEL) : channels;
+}
+
+/* Channels of the shortest burst of data registers that covers the given ones */
+uint8 MPU6050_RegisterSpan(uint8 channels)
+{
+    uint32 first;
+    uint32 last;
+
+    channels &= MPU6050_CHAN_ALL;
+    if (channels == 0)
+    {
+        return 0;
+    }
+
+    first = (uint32) __builtin_ctz(channels);
+    last  = 31 - (uint32) __builtin_clz(channels);
+
+    return (uint8) (((2u << last) - 1) & ~((1u << first) - 1));
+}
+
+/* Output data rate selected by SMPLRT_DIV and DLPF_CFG */
+double MPU6050_GetSampleRateHz(uint8 sampleRateDiv, uint8 dlpfConfig)
+{
+    /* The gyro runs at 8 kHz with the DLPF disabled, 1 kHz otherwise */
+    double gyroRate = (dlpfConfig == 0 || dlpfConfig == 7) ? 8000.0 : 1000.0;
+    return gyroRate / (1.0 + sampleRateDiv);
+}
+
+/*=======================================================================================
+** End of file mpu6050_conv.c
+**=====================================================================================*/
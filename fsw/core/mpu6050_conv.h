@@ -0,0 +1,83 @@
+/*=======================================================================================
+** File Name:  mpu6050_conv.h
+**
+** Title:  Sample Conversion Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the raw-to-engineering conversions.  The app converts with these
+**           same functions, so a consumer of raw packets that calls them with the scale
+**           codes and calibration named in the packet gets the app's numbers exactly.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_CONV_H_
+#define _MPU6050_CONV_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "mpu6050_core_types.h"
+
+/*
+** Function Prototypes
+*/
+
+/* Full scale range in g's of an ACCEL_CONFIG scale code, 0 if the code is invalid */
+float  MPU6050_AccelFullScale(uint8 AccelScale);
+
+/* Full scale range in degs/sec of a GYRO_CONFIG scale code, 0 if the code is invalid */
+float  MPU6050_GyroFullScale(uint8 GyroScale);
+
+/* Die temperature in degrees C of a raw TEMP_OUT reading */
+double MPU6050_RawTempToDegC(int16 RawTemp);
+
+/* Scale the axes of a raw sample in Channels by the given full scale ranges and apply
+** the calibration; the other axes are 0 */
+void   MPU6050_ConvertRaw(const MPU6050_RawSample_t *RawPtr, uint8 Channels, float GeeScale, float RateScale,
+                          const MPU6050_Calibration_t *CalPtr, MPU6050_Sample_t *SamplePtr);
+
+/* Channels set in an MPU6050_CHAN_* mask */
+uint32 MPU6050_ChannelCnt(uint8 Channels);
+
+/* Copy the channels of a raw sample in Channels to Packed, in order.  Returns the count. */
+uint32 MPU6050_PackRaw(const MPU6050_RawSample_t *RawPtr, uint8 Channels, int16 *Packed);
+
+/* Rebuild a raw sample from MPU6050_PackRaw output; the other channels are 0.
+** Returns the channels consumed. */
+uint32 MPU6050_UnpackRaw(const int16 *Packed, uint8 Channels, MPU6050_RawSample_t *RawPtr);
+
+/* Copy the axes of a calibrated sample in Channels to Packed, accel X/Y/Z then gyro
+** X/Y/Z.  Temperature is not part of a calibrated sample.  Returns the count. */
+uint32 MPU6050_PackCalibrated(const MPU6050_Sample_t *SamplePtr, uint8 Channels, double *Packed);
+
+/* Rebuild a calibrated sample from MPU6050_PackCalibrated output; the other axes are 0.
+** Returns the count consumed. */
+uint32 MPU6050_UnpackCalibrated(const double *Packed, uint8 Channels, MPU6050_Sample_t *SamplePtr);
+
+/* Decode one big endian sample from a register or FIFO read. The buffer holds the
+ * channels in present, in order; those not also in keep are left 0. */
+void MPU6050_UnpackSample(const uint8 *buffer, uint8 present, uint8 keep, MPU6050_RawSample_t *sample);
+
+/* Channels the FIFO queues to sample the given ones; FIFO_EN has one bit for all accel axes */
+uint8 MPU6050_FifoChannels(uint8 channels);
+
+/* Channels of the shortest burst of data registers that covers the given ones */
+uint8 MPU6050_RegisterSpan(uint8 channels);
+
+/* Output data rate selected by SMPLRT_DIV and DLPF_CFG */
+double MPU6050_GetSampleRateHz(uint8 sampleRateDiv, uint8 dlpfConfig);
+
+#endif /* _MPU6050_CONV_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_conv.h
+**=====================================================================================*/
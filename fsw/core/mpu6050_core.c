@@ -0,0 +1,242 @@
+/*=======================================================================================
+** File Name:  mpu6050_core.c
+**
+** Title:  Processing Core for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To run the sample processing of one device over caller-owned state, so the
+**           app, the bench and the offline tools share the same code.
+**
+** Functions Defined:
+**    MPU6050_Core_Init            - Reset the state of a device
+**    MPU6050_Core_Configure       - Set channels, full scale ranges and calibration
+**    MPU6050_Core_Convert         - Raw sample to calibrated engineering units
+**    MPU6050_Core_TimeRead        - Fold a device read into the time model
+**    MPU6050_Core_SampleTime      - Latch time of a sample
+**    MPU6050_Core_SetMotionWindow - Set the motion window length
+**    MPU6050_Core_AddMotion       - Count a sample toward the motion metrics
+**    MPU6050_Core_Propagate       - Advance the attitude by one step
+**    MPU6050_Core_SetAttitude     - Take the attitude from a quaternion
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Functions only touch the state passed in, so any number of devices can be
+**    processed side by side, from any thread that owns its state.
+** 2: MPU6050_FIXED_POINT picks the arithmetic at build time.  The fixed point build
+**    keeps its own calibration, motion sums and quaternion, and copies results out
+**    to the Motion and Attitude members the callers read.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <math.h>
+#include <string.h>
+
+#include "mpu6050_core.h"
+#include "mpu6050_registers.h"
+
+/*
+** Function Definitions
+*/
+
+void MPU6050_Core_Init(MPU6050_Core_t *CorePtr, double NominalPeriod, uint32 MotionWindow)
+{
+    uint32 i;
+
+    memset(CorePtr, 0x00, sizeof(*CorePtr));
+
+    CorePtr->ucChannels = MPU6050_CHAN_ALL;
+    CorePtr->fGeeScale  = MPU6050_AccelFullScale(MPU6050_ACCELSCALE_2G);
+    CorePtr->fRateScale = MPU6050_GyroFullScale(MPU6050_GYROSCALE_250DPS);
+    for (i = 0; i < 3; i++)
+    {
+        CorePtr->Cal.accelMatrix[i][i] = 1.0;
+        CorePtr->Cal.gyroMatrix[i][i]  = 1.0;
+    }
+
+#if MPU6050_FIXED_POINT
+    MPU6050_Fixed_Prepare(&CorePtr->FixedCal, CorePtr->fGeeScale, CorePtr->fRateScale, &CorePtr->Cal);
+    CorePtr->aiQuat[0] = MPU6050_Q30_ONE;
+#else
+    CorePtr->adQuat[0] = 1.0;
+#endif
+
+    MPU6050_TimeModel_Init(&CorePtr->TimeModel, NominalPeriod);
+    MPU6050_Core_SetMotionWindow(CorePtr, MotionWindow);
+}
+
+int32 MPU6050_Core_Configure(MPU6050_Core_t *CorePtr, uint8 Channels, uint8 AccelScale, uint8 GyroScale,
+                             const MPU6050_Calibration_t *CalPtr)
+{
+    int32 status = 0;
+
+    CorePtr->ucChannels = Channels;
+    CorePtr->fGeeScale  = MPU6050_AccelFullScale(AccelScale);
+    CorePtr->fRateScale = MPU6050_GyroFullScale(GyroScale);
+    CorePtr->Cal        = *CalPtr;
+
+    if (CorePtr->fGeeScale == 0.0)
+    {
+        CorePtr->fGeeScale = 1.0;
+        status = -1;
+    }
+
+    if (CorePtr->fRateScale == 0.0)
+    {
+        CorePtr->fRateScale = 1.0;
+        status = -1;
+    }
+
+#if MPU6050_FIXED_POINT
+    MPU6050_Fixed_Prepare(&CorePtr->FixedCal, CorePtr->fGeeScale, CorePtr->fRateScale, &CorePtr->Cal);
+#endif
+
+    return status;
+}
+
+void MPU6050_Core_Convert(const MPU6050_Core_t *CorePtr, const MPU6050_RawSample_t *RawPtr,
+                          MPU6050_Sample_t *SamplePtr)
+{
+#if MPU6050_FIXED_POINT
+    MPU6050_SampleQ_t sampleQ;
+
+    MPU6050_Fixed_Convert(&CorePtr->FixedCal, RawPtr, CorePtr->ucChannels, &sampleQ);
+    SamplePtr->accelXGees   = sampleQ.aiAccel[0] / (double) MPU6050_Q16_ONE;
+    SamplePtr->accelYGees   = sampleQ.aiAccel[1] / (double) MPU6050_Q16_ONE;
+    SamplePtr->accelZGees   = sampleQ.aiAccel[2] / (double) MPU6050_Q16_ONE;
+    SamplePtr->gyroXDegsSec = sampleQ.aiGyro[0] / (double) MPU6050_Q16_ONE;
+    SamplePtr->gyroYDegsSec = sampleQ.aiGyro[1] / (double) MPU6050_Q16_ONE;
+    SamplePtr->gyroZDegsSec = sampleQ.aiGyro[2] / (double) MPU6050_Q16_ONE;
+#else
+    MPU6050_ConvertRaw(RawPtr, CorePtr->ucChannels, CorePtr->fGeeScale, CorePtr->fRateScale,
+                       &CorePtr->Cal, SamplePtr);
+#endif
+}
+
+uint64 MPU6050_Core_TimeRead(MPU6050_Core_t *CorePtr, uint32 SampleCnt, double ReadTime)
+{
+    return MPU6050_TimeModel_Update(&CorePtr->TimeModel, SampleCnt, ReadTime);
+}
+
+double MPU6050_Core_SampleTime(const MPU6050_Core_t *CorePtr, uint64 SampleIndex)
+{
+    return MPU6050_TimeModel_SampleTime(&CorePtr->TimeModel, SampleIndex);
+}
+
+void MPU6050_Core_SetMotionWindow(MPU6050_Core_t *CorePtr, uint32 MotionWindow)
+{
+    MPU6050_Motion_Init(&CorePtr->Motion, MotionWindow);
+#if MPU6050_FIXED_POINT
+    MPU6050_Fixed_MotionInit(&CorePtr->MotionQ, MotionWindow);
+#endif
+}
+
+bool MPU6050_Core_AddMotion(MPU6050_Core_t *CorePtr, const MPU6050_RawSample_t *RawPtr)
+{
+#if MPU6050_FIXED_POINT
+    MPU6050_SampleQ_t sampleQ;
+
+    MPU6050_Fixed_Convert(&CorePtr->FixedCal, RawPtr, CorePtr->ucChannels, &sampleQ);
+    if (!MPU6050_Fixed_MotionAdd(&CorePtr->MotionQ, &sampleQ))
+    {
+        return false;
+    }
+
+    CorePtr->Motion.fGyroRmsDps = CorePtr->MotionQ.fGyroRmsDps;
+    CorePtr->Motion.fAccelStdMg = CorePtr->MotionQ.fAccelStdMg;
+    return true;
+#else
+    MPU6050_Sample_t sample;
+    double           gyro[3];
+    double           accel[3];
+
+    MPU6050_Core_Convert(CorePtr, RawPtr, &sample);
+    gyro[0]  = sample.gyroXDegsSec;
+    gyro[1]  = sample.gyroYDegsSec;
+    gyro[2]  = sample.gyroZDegsSec;
+    accel[0] = sample.accelXGees;
+    accel[1] = sample.accelYGees;
+    accel[2] = sample.accelZGees;
+
+    return MPU6050_Motion_Add(&CorePtr->Motion, gyro, accel);
+#endif
+}
+
+void MPU6050_Core_Propagate(MPU6050_Core_t *CorePtr, const double GyroDps[3], double Dt, double Delta[3])
+{
+    double delta[3];
+#if MPU6050_FIXED_POINT
+    int32  gyroQ[3];
+    int32  deltaQ[3];
+    int32  eulerQ[3];
+    uint32 dtNsec;
+    uint32 i;
+
+    /* Rates beyond Q16 cannot come out of MPU6050_Core_Convert; Dt is clamped to what
+    ** a uint32 of nanoseconds holds */
+    for (i = 0; i < 3; i++)
+    {
+        gyroQ[i] = (int32) lrint(GyroDps[i] * MPU6050_Q16_ONE);
+    }
+    dtNsec = (Dt <= 0.0) ? 0 : (Dt >= 4.294967295) ? 0xFFFFFFFF : (uint32) lrint(Dt * 1e9);
+
+    MPU6050_Fixed_Increment(gyroQ, dtNsec, deltaQ);
+    MPU6050_Fixed_QuatPropagate(CorePtr->aiQuat, deltaQ);
+    MPU6050_Fixed_QuatToEuler(CorePtr->aiQuat, eulerQ);
+
+    CorePtr->Attitude.phi   = eulerQ[0] / (double) MPU6050_Q29_ONE;
+    CorePtr->Attitude.theta = eulerQ[1] / (double) MPU6050_Q29_ONE;
+    CorePtr->Attitude.psi   = eulerQ[2] / (double) MPU6050_Q29_ONE;
+
+    for (i = 0; i < 3; i++)
+    {
+        delta[i] = deltaQ[i] / (double) MPU6050_Q30_ONE;
+    }
+#else
+    MPU6050_Attitude_Increment(GyroDps, Dt, delta);
+    MPU6050_Attitude_QuatPropagate(CorePtr->adQuat, delta);
+    MPU6050_Attitude_QuatToEuler(CorePtr->adQuat, &CorePtr->Attitude);
+#endif
+
+    if (Delta != NULL)
+    {
+        memcpy(Delta, delta, sizeof(delta));
+    }
+}
+
+void MPU6050_Core_SetAttitude(MPU6050_Core_t *CorePtr, const MPU6050_DmpQuat_t *QuatPtr)
+{
+    uint32 i;
+#if MPU6050_FIXED_POINT
+    int32  eulerQ[3];
+
+    for (i = 0; i < 4; i++)
+    {
+        CorePtr->aiQuat[i] = QuatPtr->aiQuat[i];
+    }
+    MPU6050_Fixed_QuatToEuler(CorePtr->aiQuat, eulerQ);
+
+    CorePtr->Attitude.phi   = eulerQ[0] / (double) MPU6050_Q29_ONE;
+    CorePtr->Attitude.theta = eulerQ[1] / (double) MPU6050_Q29_ONE;
+    CorePtr->Attitude.psi   = eulerQ[2] / (double) MPU6050_Q29_ONE;
+#else
+    for (i = 0; i < 4; i++)
+    {
+        CorePtr->adQuat[i] = QuatPtr->aiQuat[i] / (double) MPU6050_Q30_ONE;
+    }
+    MPU6050_Attitude_QuatToEuler(CorePtr->adQuat, &CorePtr->Attitude);
+#endif
+}
+
+/*=======================================================================================
+** End of file mpu6050_core.c
+**=====================================================================================*/
@@ -0,0 +1,106 @@
+/*=======================================================================================
+** File Name:  mpu6050_core.h
+**
+** Title:  Processing Core Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the sample processing of the app as a library: conversion,
+**           calibration, sample timing, motion and attitude, over state the caller
+**           owns.  Nothing here depends on cFE or holds global state.  With
+**           MPU6050_FIXED_POINT set, the per sample work is done in fixed point
+**           (see mpu6050_fixed.c) and only converted to double at this interface.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_CORE_H_
+#define _MPU6050_CORE_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "mpu6050_attitude.h"
+#include "mpu6050_compress.h"
+#include "mpu6050_conv.h"
+#include "mpu6050_core_types.h"
+#include "mpu6050_dmp.h"
+#include "mpu6050_fixed.h"
+#include "mpu6050_motion.h"
+#include "mpu6050_platform_cfg.h"
+#include "mpu6050_timing.h"
+
+/*
+** Local Structure Declarations
+*/
+
+/* Everything the processing of one device carries from sample to sample */
+typedef struct
+{
+    uint8   ucChannels;        /* MPU6050_CHAN_* converted */
+    uint8   aucSpare[3];
+    float   fGeeScale;         /* Accel full scale range (g's) */
+    float   fRateScale;        /* Gyro full scale range (degs/sec) */
+    MPU6050_Calibration_t Cal;
+    MPU6050_TimeModel_t   TimeModel;
+    MPU6050_Motion_t      Motion;      /* Metrics of the last window in either build */
+    MPU6050_Attitude_t    Attitude;    /* Euler angles of the attitude quaternion */
+#if MPU6050_FIXED_POINT
+    MPU6050_FixedCal_t    FixedCal;    /* Scales and Cal in fixed point */
+    MPU6050_MotionQ_t     MotionQ;
+    int32                 aiQuat[4];   /* Attitude quaternion w, x, y, z (Q30) */
+#else
+    double                adQuat[4];   /* Attitude quaternion w, x, y, z */
+#endif
+} MPU6050_Core_t;
+
+/*
+** Local Function Prototypes
+*/
+
+/* Start over: all channels, +-2 g and +-250 degs/sec, no calibration, a fresh time
+** model at NominalPeriod, motion windows of MotionWindow samples and level attitude */
+void   MPU6050_Core_Init(MPU6050_Core_t *CorePtr, double NominalPeriod, uint32 MotionWindow);
+
+/* Take the channels, ACCEL_CONFIG and GYRO_CONFIG scale codes, and calibration to
+** convert with.  Returns 0, or -1 if a scale code is invalid; that range is then 1. */
+int32  MPU6050_Core_Configure(MPU6050_Core_t *CorePtr, uint8 Channels, uint8 AccelScale, uint8 GyroScale,
+                              const MPU6050_Calibration_t *CalPtr);
+
+/* Scale and calibrate one raw sample */
+void   MPU6050_Core_Convert(const MPU6050_Core_t *CorePtr, const MPU6050_RawSample_t *RawPtr,
+                            MPU6050_Sample_t *SamplePtr);
+
+/* Account for SampleCnt samples drained at ReadTime.  Returns the index of the first. */
+uint64 MPU6050_Core_TimeRead(MPU6050_Core_t *CorePtr, uint32 SampleCnt, double ReadTime);
+
+/* Estimated latch time (monotonic seconds) of a sample index */
+double MPU6050_Core_SampleTime(const MPU6050_Core_t *CorePtr, uint64 SampleIndex);
+
+/* Start over with motion windows of MotionWindow samples */
+void   MPU6050_Core_SetMotionWindow(MPU6050_Core_t *CorePtr, uint32 MotionWindow);
+
+/* Convert a raw sample and count it toward the motion metrics; true when it
+** completes a window */
+bool   MPU6050_Core_AddMotion(MPU6050_Core_t *CorePtr, const MPU6050_RawSample_t *RawPtr);
+
+/* Propagate the attitude over Dt seconds at rates GyroDps (X/Y/Z, degs/sec); the
+** increments are returned in Delta when it is not NULL */
+void   MPU6050_Core_Propagate(MPU6050_Core_t *CorePtr, const double GyroDps[3], double Dt, double Delta[3]);
+
+/* Take the attitude from a quaternion found elsewhere, e.g. by the DMP, instead of
+** propagating it */
+void   MPU6050_Core_SetAttitude(MPU6050_Core_t *CorePtr, const MPU6050_DmpQuat_t *QuatPtr);
+
+#endif /* _MPU6050_CORE_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_core.h
+**=====================================================================================*/
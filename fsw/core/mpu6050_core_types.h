@@ -0,0 +1,84 @@
+/*=======================================================================================
+** File Name:  mpu6050_core_types.h
+**
+** Title:  Processing Core Types for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To define the samples, calibration and attitude the processing core works
+**           on.  Nothing here depends on cFE.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_CORE_TYPES_H_
+#define _MPU6050_CORE_TYPES_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*
+** Local Structure Declarations
+*/
+
+/* One sample as laid out in the data registers and the FIFO, in ADC counts */
+typedef struct
+{
+    int16   accel[3];
+    int16   temp;
+    int16   gyro[3];
+} MPU6050_RawSample_t;
+
+/* Channel mask bits, one per MPU6050_RawSample_t channel, in order */
+#define MPU6050_CHAN_ACCEL_X  0x01
+#define MPU6050_CHAN_ACCEL_Y  0x02
+#define MPU6050_CHAN_ACCEL_Z  0x04
+#define MPU6050_CHAN_TEMP     0x08
+#define MPU6050_CHAN_GYRO_X   0x10
+#define MPU6050_CHAN_GYRO_Y   0x20
+#define MPU6050_CHAN_GYRO_Z   0x40
+#define MPU6050_CHAN_ACCEL    0x07
+#define MPU6050_CHAN_GYRO     0x70
+#define MPU6050_CHAN_ALL      0x7F
+
+/* One sample in engineering units */
+typedef struct
+{
+    double  accelXGees;   /* Acceleration in X, Y, and Z body frame (g's) */
+    double  accelYGees;
+    double  accelZGees;
+    double  gyroXDegsSec; /* Gyro angular rates, X, Y, and Z BF (degs/sec)*/
+    double  gyroYDegsSec;
+    double  gyroZDegsSec;
+} MPU6050_Sample_t;
+
+/* Sensor calibration: calibrated = Matrix * (scaled - Bias), per sensor */
+typedef struct
+{
+    double  accelBias[3];      /* g's */
+    double  accelMatrix[3][3]; /* Scale factor and misalignment */
+    double  gyroBias[3];       /* degs/sec */
+    double  gyroMatrix[3][3];
+} MPU6050_Calibration_t;
+
+/* Attitude propagated from the gyro rates, as Euler angles */
+typedef struct
+{
+    double  phi;          /* Roll, pitch, and yaw (rad) */
+    double  theta;
+    double  psi;
+} MPU6050_Attitude_t;
+
+#endif /* _MPU6050_CORE_TYPES_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_core_types.h
+**=====================================================================================*/
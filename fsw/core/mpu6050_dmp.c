@@ -0,0 +1,130 @@
+/*=======================================================================================
+** File Name:  mpu6050_dmp.c
+**
+** Title:  DMP Packet Decoding for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To decode the packets the Digital Motion Processor puts in the FIFO into
+**           a quaternion and a raw sample.
+**
+** Functions Defined:
+**    MPU6050_Dmp_PacketBytes - Packet size of a feature set
+**    MPU6050_Dmp_Channels    - Channels a feature set fills in
+**    MPU6050_Dmp_Unpack      - Quaternion and raw sample of one packet
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The layout is that of the InvenSense Motion Driver 6.12 firmware: quaternion,
+**    then accel, then gyro, then the gesture word, each only if enabled, all big
+**    endian.  Other images that keep to it can be used as they are.
+** 2: A packet holds no sequence number or marker, so a read that starts mid-packet is
+**    only caught through the quaternion.  Its length is checked to within 1/16, as
+**    the Motion Driver does.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <string.h>
+
+#include "mpu6050_dmp.h"
+#include "mpu6050_fixed.h"
+
+/*
+** Local Defines
+*/
+#define MPU6050_DMP_QUAT_BYTES     16
+#define MPU6050_DMP_SENSOR_BYTES   6
+#define MPU6050_DMP_GESTURE_BYTES  4
+
+/* Squared length of a Q30 quaternion, Q30, may be this far from 1 */
+#define MPU6050_DMP_QUAT_TOL       (MPU6050_Q30_ONE >> 4)
+
+/*
+** Local Function Definitions
+*/
+
+static int32 MPU6050_Dmp_Get32(const uint8 *Buf)
+{
+    return (int32) (((uint32) Buf[0] << 24) | ((uint32) Buf[1] << 16) | ((uint32) Buf[2] << 8) | Buf[3]);
+}
+
+static int16 MPU6050_Dmp_Get16(const uint8 *Buf)
+{
+    return (int16) ((Buf[0] << 8) | Buf[1]);
+}
+
+/*
+** Function Definitions
+*/
+
+uint32 MPU6050_Dmp_PacketBytes(uint8 Features)
+{
+    return ((Features & MPU6050_DMP_FEAT_QUAT)    ? MPU6050_DMP_QUAT_BYTES    : 0) +
+           ((Features & MPU6050_DMP_FEAT_ACCEL)   ? MPU6050_DMP_SENSOR_BYTES  : 0) +
+           ((Features & MPU6050_DMP_FEAT_GYRO)    ? MPU6050_DMP_SENSOR_BYTES  : 0) +
+           ((Features & MPU6050_DMP_FEAT_GESTURE) ? MPU6050_DMP_GESTURE_BYTES : 0);
+}
+
+uint8 MPU6050_Dmp_Channels(uint8 Features)
+{
+    return ((Features & MPU6050_DMP_FEAT_ACCEL) ? MPU6050_CHAN_ACCEL : 0) |
+           ((Features & MPU6050_DMP_FEAT_GYRO)  ? MPU6050_CHAN_GYRO  : 0);
+}
+
+bool MPU6050_Dmp_Unpack(const uint8 *Packet, uint8 Features, MPU6050_DmpQuat_t *QuatPtr,
+                        MPU6050_RawSample_t *RawPtr)
+{
+    int64  lenSq = 0;
+    uint32 i;
+
+    memset(RawPtr, 0x00, sizeof(*RawPtr));
+    memset(QuatPtr, 0x00, sizeof(*QuatPtr));
+    QuatPtr->aiQuat[0] = MPU6050_Q30_ONE;
+
+    if (Features & MPU6050_DMP_FEAT_QUAT)
+    {
+        for (i = 0; i < 4; i++)
+        {
+            QuatPtr->aiQuat[i] = MPU6050_Dmp_Get32(&Packet[4 * i]);
+            lenSq += ((int64) QuatPtr->aiQuat[i] * QuatPtr->aiQuat[i]) >> 30;
+        }
+        Packet += MPU6050_DMP_QUAT_BYTES;
+
+        if (lenSq < MPU6050_Q30_ONE - MPU6050_DMP_QUAT_TOL || lenSq > MPU6050_Q30_ONE + MPU6050_DMP_QUAT_TOL)
+        {
+            return false;
+        }
+    }
+
+    if (Features & MPU6050_DMP_FEAT_ACCEL)
+    {
+        for (i = 0; i < 3; i++)
+        {
+            RawPtr->accel[i] = MPU6050_Dmp_Get16(&Packet[2 * i]);
+        }
+        Packet += MPU6050_DMP_SENSOR_BYTES;
+    }
+
+    if (Features & MPU6050_DMP_FEAT_GYRO)
+    {
+        for (i = 0; i < 3; i++)
+        {
+            RawPtr->gyro[i] = MPU6050_Dmp_Get16(&Packet[2 * i]);
+        }
+    }
+
+    return true;
+}
+
+/*=======================================================================================
+** End of file mpu6050_dmp.c
+**=====================================================================================*/
@@ -0,0 +1,74 @@
+/*=======================================================================================
+** File Name:  mpu6050_dmp.h
+**
+** Title:  DMP Packet Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the layout and decoding of the packets the Digital Motion
+**           Processor puts in the FIFO.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_DMP_H_
+#define _MPU6050_DMP_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "mpu6050_core_types.h"
+
+/*
+** Local Defines
+*/
+
+/* What a DMP packet carries, in packet order.  Which of them the DMP sends is up to
+** the firmware image and how it was set up; these only describe the packet. */
+#define MPU6050_DMP_FEAT_QUAT     0x01  /* 6-axis quaternion w/x/y/z, 4 x int32 Q30 */
+#define MPU6050_DMP_FEAT_ACCEL    0x02  /* Accel X/Y/Z, 3 x int16 counts            */
+#define MPU6050_DMP_FEAT_GYRO     0x04  /* Gyro X/Y/Z, 3 x int16 counts             */
+#define MPU6050_DMP_FEAT_GESTURE  0x08  /* Tap and orientation word, not decoded    */
+#define MPU6050_DMP_FEAT_ALL      0x0F
+
+#define MPU6050_DMP_MAX_PACKET_BYTES  32
+
+/*
+** Local Structure Declarations
+*/
+
+/* Attitude quaternion [w x y z] of one DMP packet, Q30 */
+typedef struct
+{
+    int32   aiQuat[4];
+} MPU6050_DmpQuat_t;
+
+/*
+** Local Function Prototypes
+*/
+
+/* Bytes of a packet with the given features, 0 if it would carry nothing */
+uint32 MPU6050_Dmp_PacketBytes(uint8 Features);
+
+/* MPU6050_CHAN_* a packet with the given features fills in */
+uint8  MPU6050_Dmp_Channels(uint8 Features);
+
+/* Decode one packet.  Channels the packet does not carry are left 0, and the quaternion
+** is the identity without MPU6050_DMP_FEAT_QUAT.  Returns false if the quaternion is
+** too far from unit length to be one, which is how a packet read out of step with the
+** FIFO shows. */
+bool   MPU6050_Dmp_Unpack(const uint8 *Packet, uint8 Features, MPU6050_DmpQuat_t *QuatPtr,
+                          MPU6050_RawSample_t *RawPtr);
+
+#endif /* _MPU6050_DMP_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_dmp.h
+**=====================================================================================*/
@@ -0,0 +1,108 @@
+/*=======================================================================================
+** File Name:  mpu6050_fixed.h
+**
+** Title:  Fixed-Point Processing Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the integer versions of the conversion, motion metrics and
+**           attitude propagation, for targets without an FPU.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_FIXED_H_
+#define _MPU6050_FIXED_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "mpu6050_core_types.h"
+
+/*
+** Local Defines
+*/
+
+/* Qn is a signed integer holding the value times 2^n */
+#define MPU6050_Q16_ONE  ((int32) 1 << 16)
+#define MPU6050_Q29_ONE  ((int32) 1 << 29)
+#define MPU6050_Q30_ONE  ((int32) 1 << 30)
+
+/*
+** Local Structure Declarations
+*/
+
+/* One sample in engineering units, Q16 */
+typedef struct
+{
+    int32   aiAccel[3];        /* g's */
+    int32   aiGyro[3];         /* degs/sec */
+} MPU6050_SampleQ_t;
+
+/* Scale and calibration of one sensor folded together:
+** Q16 out = (Gain * counts + Offset) >> (ucShift - 16) */
+typedef struct
+{
+    int32   aiGain[3][3];      /* Matrix * full scale / 65535, Q(ucShift) per count */
+    int64   alOffset[3];       /* -Matrix * Bias, Q(ucShift) */
+    uint8   ucShift;           /* Fraction bits of Gain, 16 to 62 */
+    uint8   aucSpare[7];
+} MPU6050_FixedSensor_t;
+
+typedef struct
+{
+    MPU6050_FixedSensor_t Accel;
+    MPU6050_FixedSensor_t Gyro;
+} MPU6050_FixedCal_t;
+
+/* MPU6050_Motion_t in integers.  Accel is summed about the first sample of the window,
+** so the sums stay small and the variance does not cancel out of a large mean. */
+typedef struct
+{
+    uint32  uiWinSamples;      /* Samples per window, at least 1 */
+    uint32  uiCnt;             /* Samples in the window so far */
+    uint64  ulGyroSq;          /* Sum of |gyro|^2, Q16 dps^2 */
+    int32   aiAccelRef[3];     /* First accel sample of the window, Q16 g */
+    int64   alAccelSum[3];     /* Per axis sum of accel - ref, Q16 g */
+    uint64  ulAccelSq;         /* Sum of |accel - ref|^2, Q32 g^2 */
+    float   fGyroRmsDps;       /* RMS angular rate of the last window */
+    float   fAccelStdMg;       /* Standard deviation of accel about its mean, all axes */
+} MPU6050_MotionQ_t;
+
+/*
+** Local Function Prototypes
+*/
+
+/* Fold full scale ranges and calibration into FixedCalPtr.  Uses floating point, but
+** only here; the per sample functions below do not. */
+void MPU6050_Fixed_Prepare(MPU6050_FixedCal_t *FixedCalPtr, float GeeScale, float RateScale,
+                           const MPU6050_Calibration_t *CalPtr);
+
+/* MPU6050_ConvertRaw in Q16 */
+void MPU6050_Fixed_Convert(const MPU6050_FixedCal_t *FixedCalPtr, const MPU6050_RawSample_t *RawPtr,
+                           uint8 Channels, MPU6050_SampleQ_t *SamplePtr);
+
+void MPU6050_Fixed_MotionInit(MPU6050_MotionQ_t *MotionPtr, uint32 WinSamples);
+bool MPU6050_Fixed_MotionAdd(MPU6050_MotionQ_t *MotionPtr, const MPU6050_SampleQ_t *SamplePtr);
+
+/* MPU6050_Attitude_Increment of Q16 rates held for DtNsec, in Q30 rad.  Increments
+** saturate at 1 rad. */
+void MPU6050_Fixed_Increment(const int32 GyroQ16[3], uint32 DtNsec, int32 DeltaQ30[3]);
+
+/* MPU6050_Attitude_QuatPropagate and MPU6050_Attitude_QuatToEuler on a Q30
+** quaternion; the angles are Q29 rad */
+void MPU6050_Fixed_QuatPropagate(int32 QuatQ30[4], const int32 DeltaQ30[3]);
+void MPU6050_Fixed_QuatToEuler(const int32 QuatQ30[4], int32 EulerQ29[3]);
+
+#endif /* _MPU6050_FIXED_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_fixed.h
+**=====================================================================================*/
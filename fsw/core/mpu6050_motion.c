@@ -0,0 +1,84 @@
+/*=======================================================================================
+** File Name:  mpu6050_motion.c
+**
+** Title:  Motion Energy for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To measure how much the sensor is moving over short windows of samples.
+**
+** Functions Defined:
+**    MPU6050_Motion_Init - Set the window length and start a window
+**    MPU6050_Motion_Add  - Count one sample, computing the metrics at the window end
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Gravity does not count as motion: accel is measured as its spread about the
+**    window mean, while any rotation counts against the gyro RMS.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <math.h>
+#include <string.h>
+
+#include "mpu6050_motion.h"
+
+/*
+** Local Function Definitions
+*/
+
+void MPU6050_Motion_Init(MPU6050_Motion_t *MotionPtr, uint32 WinSamples)
+{
+    memset(MotionPtr, 0x00, sizeof(*MotionPtr));
+    MotionPtr->uiWinSamples = (WinSamples == 0) ? 1 : WinSamples;
+}
+
+bool MPU6050_Motion_Add(MPU6050_Motion_t *MotionPtr, const double GyroDps[3], const double AccelG[3])
+{
+    double n;
+    double var;
+    uint32 i;
+
+    for (i = 0; i < 3; i++)
+    {
+        MotionPtr->dGyroSq       += GyroDps[i] * GyroDps[i];
+        MotionPtr->adAccelSum[i] += AccelG[i];
+        MotionPtr->dAccelSq      += AccelG[i] * AccelG[i];
+    }
+
+    if (++MotionPtr->uiCnt < MotionPtr->uiWinSamples)
+    {
+        return false;
+    }
+
+    /* E|a|^2 - |E a|^2, rounding can take it just below 0 */
+    n   = (double) MotionPtr->uiCnt;
+    var = MotionPtr->dAccelSq / n;
+    for (i = 0; i < 3; i++)
+    {
+        var -= (MotionPtr->adAccelSum[i] / n) * (MotionPtr->adAccelSum[i] / n);
+    }
+
+    MotionPtr->fGyroRmsDps = (float) sqrt(MotionPtr->dGyroSq / n);
+    MotionPtr->fAccelStdMg = (var > 0.0) ? (float) (sqrt(var) * 1000.0) : 0.0f;
+
+    MotionPtr->uiCnt = 0;
+    MotionPtr->dGyroSq  = 0.0;
+    MotionPtr->dAccelSq = 0.0;
+    memset(MotionPtr->adAccelSum, 0x00, sizeof(MotionPtr->adAccelSum));
+
+    return true;
+}
+
+/*=======================================================================================
+** End of file mpu6050_motion.c
+**=====================================================================================*/
@@ -0,0 +1,55 @@
+/*=======================================================================================
+** File Name:  mpu6050_motion.h
+**
+** Title:  Motion Energy Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the short-window motion metrics that pick the sampling rate
+**           profile in adaptive mode.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_MOTION_H_
+#define _MPU6050_MOTION_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*
+** Local Structure Declarations
+*/
+
+/* Motion over fixed windows of samples.  The metrics of the last complete window are
+** kept until the next one completes. */
+typedef struct
+{
+    uint32  uiWinSamples;      /* Samples per window, at least 1 */
+    uint32  uiCnt;             /* Samples in the window so far */
+    double  dGyroSq;           /* Sum of |gyro|^2 (dps^2) */
+    double  adAccelSum[3];     /* Per axis sum of accel (g) */
+    double  dAccelSq;          /* Sum of |accel|^2 (g^2) */
+    float   fGyroRmsDps;       /* RMS angular rate of the last window */
+    float   fAccelStdMg;       /* Standard deviation of accel about its mean, all axes */
+} MPU6050_Motion_t;
+
+/*
+** Local Function Prototypes
+*/
+void MPU6050_Motion_Init(MPU6050_Motion_t *MotionPtr, uint32 WinSamples);
+bool MPU6050_Motion_Add(MPU6050_Motion_t *MotionPtr, const double GyroDps[3], const double AccelG[3]);
+
+#endif /* _MPU6050_MOTION_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_motion.h
+**=====================================================================================*/
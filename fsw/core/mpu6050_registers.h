@@ -0,0 +1,137 @@
+#ifndef MPU6050_REGISTERS_H_
+#define MPU6050_REGISTERS_H_
+
+// Addresses
+#define MPU6050_DEVICE_ADDR 0x68
+#define RegSampleRateDiv    0x19
+#define RegConfig           0x1A
+#define RegPowerManagment1  0x6B
+#define RegPowerManagment2  0x6C
+#define RegGyroConfig       0x1B
+#define RegAccelConfig      0x1C
+#define RegAccelConfig2     0x1D // MPU-6500 family only: accelerometer DLPF
+#define RegLpAccelOdr       0x1E // MPU-6500 family only: cycle mode wake-up rate
+#define RegGyroX            0x43
+#define RegGyroY            0x45
+#define RegGyroZ            0x47
+#define RegAccelX           0x3B
+#define RegAccelY           0x3D
+#define RegAccelZ           0x3F
+#define RegFifoEnable       0x23
+#define RegIntEnable        0x38
+#define RegIntStatus        0x3A
+#define RegTemp             0x41
+#define RegSignalPathReset  0x68
+#define RegUserCtrl         0x6A
+#define RegBankSel          0x6D // DMP memory bank, then MEM_START_ADDR follows
+#define RegMemStartAddr     0x6E
+#define RegMemRW            0x6F
+#define RegDmpCfg1          0x70 // DMP program start, 16 bits, high byte first
+#define RegFifoCount        0x72 // 16 bits, high byte first
+#define RegFifoRW           0x74
+#define RegWhoAmI           0x75
+
+// RegWhoAmI reads the device address with AD0 low, whatever AD0 is
+#define MPU6050_WHO_AM_I    0x68 // MPU-6050 and MPU-6000
+#define MPU6500_WHO_AM_I    0x70
+#define MPU9250_WHO_AM_I    0x71
+
+// SPI: the first byte of a transfer is the register, with this bit set to read
+#define MPU6050_SPI_READ    0x80
+
+// FIFO geometry. The FIFO holds samples in register order: accel X/Y/Z,
+// temperature, gyro X/Y/Z, 16 bits each, big endian, of the channels FIFO_EN
+// selects. A sample is 2 to 14 bytes; a sample of one channel packs the most.
+#define MPU6050_FIFO_SIZE     1024
+#define MPU6050_CHANNEL_BYTES 2
+#define MPU6050_SAMPLE_BYTES  14
+#define MPU6050_FIFO_MAX_SAMPLES (MPU6050_FIFO_SIZE / MPU6050_CHANNEL_BYTES)
+
+// DMP memory, reached a bank at a time: BANK_SEL and MEM_START_ADDR pick the
+// first byte, and MEM_R_W transfers from there on. A transfer that runs off the
+// end of a bank wraps to its start instead of moving to the next one.
+#define MPU6050_DMP_BANK_SIZE 256
+#define MPU6050_DMP_MEM_SIZE  4096
+
+// RegConfig bits
+#define ConfigDlpf          0 // bits 2:0
+
+// RegFifoEnable bits
+#define FifoEnAccel         3
+#define FifoEnZG            4
+#define FifoEnYG            5
+#define FifoEnXG            6
+#define FifoEnTemp          7
+
+// RegIntEnable bits
+#define IntEnableDataRdy    0
+#define IntEnableDmp        1
+
+// RegIntStatus bits
+#define IntStatusDataRdy    0
+#define IntStatusDmp        1
+#define IntStatusFifoOflow  4
+
+// RegSignalPathReset bits: gyro, accel and temperature signal paths
+#define SignalPathResetAll  0x07
+
+// RegUserCtrl bits
+#define UserCtrlFifoReset   2
+#define UserCtrlDmpReset    3
+#define UserCtrlI2cIfDis    4 // SPI only; keeps the I2C interface from waking
+#define UserCtrlFifoEn      6
+#define UserCtrlDmpEn       7
+
+// RegPowerManagment1 bits
+#define PwrMgmt1Clksel      0 // bits 2:0
+#define PwrMgmt1Temp_dis    3 // bit  3
+#define PwrMgmt1Cycle       5
+#define PwrMgmt1Sleep       6
+#define PwrMgmt1DeviceReset 7
+
+// RegPowerManagment2 bits
+#define PwrMgmt2StbyZG     0
+#define PwrMgmt2StbyYG     1
+#define PwrMgmt2StbyXG     2
+#define PwrMgmt2StbyZA     3
+#define PwrMgmt2StbyYA     4
+#define PwrMgmt2StbyXA     5
+#define PwrMgmt2LPWakeCtrl 6 // bits 7:6
+
+// PwrMgmt2LPWakeCtrl codes, accelerometer wake-ups per second in cycle mode
+#define LPWake1_25Hz       0
+#define LPWake5Hz          1
+#define LPWake20Hz         2
+#define LPWake40Hz         3
+
+// LP_ACCEL_ODR codes of the MPU-6500 family, wake-ups per second in cycle mode
+#define LPAccelOdr0_98Hz   2
+#define LPAccelOdr3_91Hz   4
+#define LPAccelOdr15_63Hz  6
+#define LPAccelOdr31_25Hz  7
+
+// RegAccelConfig2 bits
+#define AccelConfig2Dlpf    0 // bits 2:0, as ConfigDlpf; cycle mode wants 1
+
+// RegAccelConfig bits
+#define RegAccelConfigScale 3 // bits 4:3
+#define RegGyroConfigScale 3  // bits 4:3
+
+typedef enum
+{
+    MPU6050_ACCELSCALE_2G  = 0 << RegAccelConfigScale,
+    MPU6050_ACCELSCALE_4G  = 1 << RegAccelConfigScale,
+    MPU6050_ACCELSCALE_8G  = 2 << RegAccelConfigScale,
+    MPU6050_ACCELSCALE_16G = 3 << RegAccelConfigScale,
+} MPU6050_AcceleormeterScale_t;
+
+typedef enum
+{
+    MPU6050_GYROSCALE_250DPS  = 0 << RegGyroConfigScale,
+    MPU6050_GYROSCALE_500DPS  = 1 << RegGyroConfigScale,
+    MPU6050_GYROSCALE_1000DPS = 2 << RegGyroConfigScale,
+    MPU6050_GYROSCALE_2000DPS = 3 << RegGyroConfigScale,
+} MPU6050_GyroScale_t;
+
+#endif /* MPU6050_REGISTERS_H_ */
+
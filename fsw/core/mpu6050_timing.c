@@ -0,0 +1,188 @@
+/*=======================================================================================
+** File Name:  mpu6050_timing.c
+**
+** Title:  Sample Timing Model for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To reconstruct the latch time of every sample drained from the device FIFO.
+**
+** Functions Defined:
+**    MPU6050_GetMonotonicTime     - Read CLOCK_MONOTONIC
+**    MPU6050_TimeModel_Init       - Start a new clock fit
+**    MPU6050_TimeModel_Resync     - Throw away the current fit
+**    MPU6050_TimeModel_SetPeriod  - Restart the fit at a new output data rate
+**    MPU6050_TimeModel_Update     - Fold one device read into the fit
+**    MPU6050_TimeModel_SampleTime - Evaluate the fit for one sample
+**    MPU6050_TimeModel_DriftPpm   - Sensor oscillator error against nominal
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Every read drains the whole FIFO, so the newest sample read is the newest sample
+**    latched before the FIFO count was sampled.  That sample's latch time is uniformly
+**    distributed over the preceding sample period, so reads are fitted at ReadTime minus
+**    half a period.
+** 2: The fit runs in monotonic time.  Conversion to CFE time is left to the caller so
+**    that CFE time corrections do not disturb the oscillator estimate.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+#include "mpu6050_platform_cfg.h"
+#include "mpu6050_timing.h"
+
+/*
+** Local Function Definitions
+*/
+
+/* Move the fit origin to NewRefIndex so the regressor stays small */
+static void MPU6050_TimeModel_Rebase(MPU6050_TimeModel_t *Model, uint64 NewRefIndex)
+{
+    double d   = (double) (NewRefIndex - Model->RefIndex);
+    double p00 = Model->P[0][0];
+    double p01 = Model->P[0][1];
+    double p11 = Model->P[1][1];
+
+    /* theta' = T theta, P' = T P T^T with T = [1 d; 0 1] */
+    Model->Offset  += Model->Period * d;
+    Model->P[0][0]  = p00 + 2.0 * d * p01 + d * d * p11;
+    Model->P[0][1]  = p01 + d * p11;
+    Model->P[1][0]  = Model->P[0][1];
+    Model->RefIndex = NewRefIndex;
+}
+
+double MPU6050_GetMonotonicTime(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double) ts.tv_sec) + ((double) ts.tv_nsec) / 1e9;
+}
+
+void MPU6050_TimeModel_Init(MPU6050_TimeModel_t *Model, double NominalPeriod)
+{
+    memset((void*) Model, 0x00, sizeof(*Model));
+    Model->NominalPeriod = NominalPeriod;
+    MPU6050_TimeModel_Resync(Model);
+    Model->ResyncCnt = 0;
+}
+
+void MPU6050_TimeModel_Resync(MPU6050_TimeModel_t *Model)
+{
+    double periodSigma = Model->NominalPeriod * MPU6050_TIME_PERIOD_PRIOR_PPM / 1e6;
+
+    Model->Offset    = 0.0;
+    Model->Period    = Model->NominalPeriod;
+    Model->P[0][0]   = MPU6050_TIME_OFFSET_PRIOR_SEC * MPU6050_TIME_OFFSET_PRIOR_SEC;
+    Model->P[0][1]   = 0.0;
+    Model->P[1][0]   = 0.0;
+    Model->P[1][1]   = periodSigma * periodSigma;
+    Model->RefTime   = 0.0;
+    Model->RefIndex  = Model->NextIndex;
+    Model->UpdateCnt = 0;
+    Model->ResyncCnt++;
+}
+
+void MPU6050_TimeModel_SetPeriod(MPU6050_TimeModel_t *Model, double NominalPeriod)
+{
+    Model->NominalPeriod = NominalPeriod;
+    Model->NextIndex++;
+    MPU6050_TimeModel_Resync(Model);
+}
+
+uint64 MPU6050_TimeModel_Update(MPU6050_TimeModel_t *Model, uint32 SampleCnt, double ReadTime)
+{
+    uint64 firstIndex = Model->NextIndex;
+    uint64 lastIndex;
+    double x, y, err;
+    double px0, px1, denom, k0, k1;
+
+    if (SampleCnt == 0)
+    {
+        return firstIndex;
+    }
+
+    Model->NextIndex += SampleCnt;
+    lastIndex = Model->NextIndex - 1;
+
+    /* First read after a resync pins the origin; the prior on Period does the rest */
+    if (Model->UpdateCnt == 0)
+    {
+        Model->RefIndex  = lastIndex;
+        Model->RefTime   = ReadTime - 0.5 * Model->Period;
+        Model->UpdateCnt = 1;
+        return firstIndex;
+    }
+
+    if (lastIndex - Model->RefIndex > MPU6050_TIME_REBASE_SAMPLES)
+    {
+        MPU6050_TimeModel_Rebase(Model, lastIndex);
+    }
+
+    x   = (double) (lastIndex - Model->RefIndex);
+    y   = ReadTime - 0.5 * Model->Period - Model->RefTime;
+    err = y - (Model->Offset + Model->Period * x);
+
+    /* A read this far off the line means samples were lost or the clock stepped */
+    if (fabs(err) > MPU6050_TIME_RESYNC_SEC)
+    {
+        MPU6050_TimeModel_Resync(Model);
+        Model->RefIndex  = lastIndex;
+        Model->RefTime   = ReadTime - 0.5 * Model->Period;
+        Model->UpdateCnt = 1;
+        return firstIndex;
+    }
+
+    /* Recursive least squares with exponential forgetting, regressor [1, x] */
+    px0   = Model->P[0][0] + Model->P[0][1] * x;
+    px1   = Model->P[1][0] + Model->P[1][1] * x;
+    denom = MPU6050_TIME_FORGET_FACTOR + px0 + px1 * x;
+    k0    = px0 / denom;
+    k1    = px1 / denom;
+
+    Model->Offset += k0 * err;
+    Model->Period += k1 * err;
+
+    Model->P[0][0] = (Model->P[0][0] - k0 * px0) / MPU6050_TIME_FORGET_FACTOR;
+    Model->P[0][1] = (Model->P[0][1] - k0 * px1) / MPU6050_TIME_FORGET_FACTOR;
+    Model->P[1][1] = (Model->P[1][1] - k1 * px1) / MPU6050_TIME_FORGET_FACTOR;
+    Model->P[1][0] = Model->P[0][1];
+
+    Model->UpdateCnt++;
+
+    return firstIndex;
+}
+
+double MPU6050_TimeModel_SampleTime(const MPU6050_TimeModel_t *Model, uint64 SampleIndex)
+{
+    double x = ((double) SampleIndex) - ((double) Model->RefIndex);
+
+    return Model->RefTime + Model->Offset + Model->Period * x;
+}
+
+double MPU6050_TimeModel_DriftPpm(const MPU6050_TimeModel_t *Model)
+{
+    if (Model->NominalPeriod <= 0.0 || Model->UpdateCnt < 2)
+    {
+        return 0.0;
+    }
+
+    /* A slow oscillator has a long period, i.e. negative drift */
+    return (Model->NominalPeriod / Model->Period - 1.0) * 1e6;
+}
+
+/*=======================================================================================
+** End of file mpu6050_timing.c
+**=====================================================================================*/
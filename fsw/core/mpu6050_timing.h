@@ -0,0 +1,81 @@
+/*=======================================================================================
+** File Name:  mpu6050_timing.h
+**
+** Title:  Sample Timing Model Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the sensor clock model used to reconstruct per-sample timestamps
+**           from FIFO counts and read-completion times.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_TIMING_H_
+#define _MPU6050_TIMING_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*
+** Local Structure Declarations
+*/
+
+/*
+** Linear model of the sensor oscillator: the n-th sample drained from the device was
+** latched at   RefTime + Offset + Period * (n - RefIndex)   seconds of CLOCK_MONOTONIC.
+** Offset and Period are fitted by recursive least squares over every device read.
+*/
+typedef struct
+{
+    double  NominalPeriod;   /* Period implied by the configured output data rate (s) */
+    double  Offset;          /* Fitted latch time of sample RefIndex, relative to RefTime (s) */
+    double  Period;          /* Fitted sample period (s) */
+    double  P[2][2];         /* Covariance of [Offset, Period] */
+    double  RefTime;         /* Monotonic time origin of the fit (s) */
+    uint64  RefIndex;        /* Sample index origin of the fit */
+    uint64  NextIndex;       /* Index that will be given to the next sample read */
+    uint32  UpdateCnt;       /* Reads folded into the fit since the last resync */
+    uint32  ResyncCnt;       /* Number of times the fit has been restarted */
+} MPU6050_TimeModel_t;
+
+/*
+** Function Prototypes
+*/
+
+/* Current CLOCK_MONOTONIC time in seconds */
+double MPU6050_GetMonotonicTime(void);
+
+/* Start a new fit for a device sampling at NominalPeriod seconds */
+void   MPU6050_TimeModel_Init(MPU6050_TimeModel_t *Model, double NominalPeriod);
+
+/* Discard the fit (e.g. after a FIFO overflow); sample numbering continues */
+void   MPU6050_TimeModel_Resync(MPU6050_TimeModel_t *Model);
+
+/* Restart the fit at a new output data rate.  One index is skipped, so the samples
+** lost while the rate changed show as a gap in the numbering. */
+void   MPU6050_TimeModel_SetPeriod(MPU6050_TimeModel_t *Model, double NominalPeriod);
+
+/* Fold in a read of SampleCnt samples that completed at ReadTime (monotonic seconds).
+** Returns the index of the first of those samples. */
+uint64 MPU6050_TimeModel_Update(MPU6050_TimeModel_t *Model, uint32 SampleCnt, double ReadTime);
+
+/* Estimated latch time (monotonic seconds) of a sample index */
+double MPU6050_TimeModel_SampleTime(const MPU6050_TimeModel_t *Model, uint64 SampleIndex);
+
+/* Sensor oscillator error relative to nominal, in parts per million */
+double MPU6050_TimeModel_DriftPpm(const MPU6050_TimeModel_t *Model);
+
+#endif /* _MPU6050_TIMING_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_timing.h
+**=====================================================================================*/
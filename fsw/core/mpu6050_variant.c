@@ -0,0 +1,83 @@
+/*=======================================================================================
+** File Name:  mpu6050_variant.c
+**
+** Title:  Chip Variants for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To tell the MPU-6050's siblings apart by WHO_AM_I and give the registers
+**           each needs written differently.
+**
+** Functions Defined:
+**    MPU6050_Variant_Lookup  - Variant of a WHO_AM_I value
+**    MPU6050_Variant_Default - Variant of the MPU-6050
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The MPU-6000 is the MPU-6050 with SPI and answers the same WHO_AM_I.  The
+**    MPU-9250 is an MPU-6500 with a magnetometer on its auxiliary bus, which is not
+**    used.
+** 2: Sample registers, FIFO layout, scales and the sample rate divider are common to
+**    all of them, so nothing past the bus depends on the variant.  The MPU-6500's
+**    accelerometer has its own DLPF, which is set to CONFIG's so both sensors filter
+**    alike, and cycle mode takes its rate from LP_ACCEL_ODR, at the nearest of its
+**    rates below the MPU-6050's.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <stddef.h>
+
+#include "mpu6050_variant.h"
+#include "mpu6050_registers.h"
+
+/*
+** Local Variables
+*/
+static const MPU6050_Variant_t MPU6050_Variants[] =
+{
+    {"MPU-6050/6000", MPU6050_WHO_AM_I, 0, 0,
+     {LPWake1_25Hz, LPWake5Hz, LPWake20Hz, LPWake40Hz}, {1.25f, 5.0f, 20.0f, 40.0f}, 1024},
+    {"MPU-6500", MPU6500_WHO_AM_I, RegAccelConfig2, RegLpAccelOdr,
+     {LPAccelOdr0_98Hz, LPAccelOdr3_91Hz, LPAccelOdr15_63Hz, LPAccelOdr31_25Hz},
+     {0.98f, 3.91f, 15.63f, 31.25f}, 512},
+    {"MPU-9250", MPU9250_WHO_AM_I, RegAccelConfig2, RegLpAccelOdr,
+     {LPAccelOdr0_98Hz, LPAccelOdr3_91Hz, LPAccelOdr15_63Hz, LPAccelOdr31_25Hz},
+     {0.98f, 3.91f, 15.63f, 31.25f}, 512},
+};
+
+/*
+** Function Definitions
+*/
+
+const MPU6050_Variant_t *MPU6050_Variant_Lookup(uint8 WhoAmI)
+{
+    uint32 i;
+
+    for (i = 0; i < sizeof(MPU6050_Variants) / sizeof(MPU6050_Variants[0]); i++)
+    {
+        if (MPU6050_Variants[i].ucWhoAmI == WhoAmI)
+        {
+            return &MPU6050_Variants[i];
+        }
+    }
+
+    return NULL;
+}
+
+const MPU6050_Variant_t *MPU6050_Variant_Default(void)
+{
+    return &MPU6050_Variants[0];
+}
+
+/*=======================================================================================
+** End of file mpu6050_variant.c
+**=====================================================================================*/
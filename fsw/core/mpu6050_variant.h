@@ -0,0 +1,67 @@
+/*=======================================================================================
+** File Name:  mpu6050_variant.h
+**
+** Title:  Chip Variant Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare how the register maps of the MPU-6050's siblings differ from
+**           its own, so one driver can run any of them.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_VARIANT_H_
+#define _MPU6050_VARIANT_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*
+** Local Defines
+*/
+
+/* LPWake* codes the app selects cycle mode rates with */
+#define MPU6050_WAKE_RATE_CNT  4
+
+/*
+** Local Structure Declarations
+*/
+
+/* What sets a variant apart.  Registers not named here are the MPU-6050's. */
+typedef struct
+{
+    const char *pcName;
+    uint8   ucWhoAmI;
+    uint8   ucRegAccelConfig2;                     /* 0 where CONFIG's DLPF also filters the
+                                                      accelerometer */
+    uint8   ucRegLpAccelOdr;                       /* 0 where PWR_MGMT_2 LP_WAKE_CTRL sets the
+                                                      cycle mode rate */
+    uint8   aucWakeCode[MPU6050_WAKE_RATE_CNT];    /* Rate code written for each LPWake* code */
+    float   afWakeHz[MPU6050_WAKE_RATE_CNT];       /* Wake-ups per second it gives */
+    uint16  usFifoBytes;
+} MPU6050_Variant_t;
+
+/*
+** Local Function Prototypes
+*/
+
+/* Variant answering WHO_AM_I with WhoAmI, NULL if none does */
+const MPU6050_Variant_t *MPU6050_Variant_Lookup(uint8 WhoAmI);
+
+/* Variant of the MPU-6050 itself, for when WHO_AM_I cannot be read */
+const MPU6050_Variant_t *MPU6050_Variant_Default(void);
+
+#endif /* _MPU6050_VARIANT_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_variant.h
+**=====================================================================================*/
@@ -0,0 +1,510 @@
+/*=======================================================================================
+** File Name:  mpu6050_vote.c
+**
+** Title:  Redundancy Voting for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To fuse the samples of several redundant devices into one "virtual IMU":
+**           time align them, find the ones that disagree with the rest, and average
+**           the ones that do not.
+**
+** Functions Defined:
+**    MPU6050_Vote_Init - Start over with a member count and tolerances
+**    MPU6050_Vote_Add  - Take one sample of one member
+**    MPU6050_Vote_Fuse - Fuse the reference samples the others have caught up with
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Samples must be calibrated into the same body frame and timed on the same clock.
+**    Members are interpolated linearly to the times of the reference member's samples.
+** 2: Each axis is voted on its own: its median over the healthy members is taken, and
+**    a member farther than tolerance from it on any axis is an outlier and left out of
+**    the average on every axis.  Averaging N healthy members cuts white noise by
+**    about sqrt(N).
+** 3: It takes three voters on an axis to tell which one is wrong.  Two that disagree
+**    are both marked outliers, but neither is faulted for it, and the axis is fused to
+**    their mean.
+** 4: A member that is an outlier usFaultPersist times in a row is faulted: it no
+**    longer votes or is averaged, until it agrees with the median usRecoverPersist
+**    times in a row.
+** 5: Every step is linear in the member count: the median is found by selection, not
+**    sorting, and each member keeps a cursor into its samples that only moves forward.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <math.h>
+#include <string.h>
+
+#include "mpu6050_vote.h"
+
+/*
+** Local Defines
+*/
+#define MPU6050_VOTE_AXES  6
+#define MPU6050_VOTE_MASK  (MPU6050_VOTE_RING_SAMPLES - 1)
+
+/*
+** Local Variables
+*/
+
+/* Channel of each axis, in MPU6050_Sample_t order */
+static const uint8 MPU6050_VoteAxisChan[MPU6050_VOTE_AXES] =
+{
+    MPU6050_CHAN_ACCEL_X, MPU6050_CHAN_ACCEL_Y, MPU6050_CHAN_ACCEL_Z,
+    MPU6050_CHAN_GYRO_X,  MPU6050_CHAN_GYRO_Y,  MPU6050_CHAN_GYRO_Z,
+};
+
+/*
+** Local Function Definitions
+*/
+
+/* MPU6050_Sample_t is exactly MPU6050_VOTE_AXES doubles */
+static double *MPU6050_Vote_Axes(MPU6050_Sample_t *SamplePtr)
+{
+    return (double*) SamplePtr;
+}
+
+/* K'th smallest of Val, leaving the K before it no larger (Hoare's selection) */
+static double MPU6050_Vote_Select(double *Val, int32 Cnt, int32 K)
+{
+    int32  lo = 0;
+    int32  hi = Cnt - 1;
+    int32  i;
+    int32  j;
+    double pivot;
+    double tmp;
+
+    while (lo < hi)
+    {
+        pivot = Val[lo + (hi - lo) / 2];
+        i = lo;
+        j = hi;
+        while (i <= j)
+        {
+            while (Val[i] < pivot)
+            {
+                i++;
+            }
+            while (Val[j] > pivot)
+            {
+                j--;
+            }
+            if (i <= j)
+            {
+                tmp    = Val[i];
+                Val[i] = Val[j];
+                Val[j] = tmp;
+                i++;
+                j--;
+            }
+        }
+
+        if (K <= j)
+        {
+            hi = j;
+        }
+        else if (K >= i)
+        {
+            lo = i;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return Val[K];
+}
+
+/* Median of Cnt values, reordering them */
+static double MPU6050_Vote_Median(double *Val, uint32 Cnt)
+{
+    double upper = MPU6050_Vote_Select(Val, (int32) Cnt, (int32) (Cnt / 2));
+    double lower;
+    uint32 i;
+
+    if (Cnt % 2 != 0)
+    {
+        return upper;
+    }
+
+    /* The lower middle is the largest of those selected below the upper one */
+    lower = Val[0];
+    for (i = 1; i < Cnt / 2; i++)
+    {
+        if (Val[i] > lower)
+        {
+            lower = Val[i];
+        }
+    }
+
+    return 0.5 * (lower + upper);
+}
+
+/* A member's sample at TimeNsec, interpolated between the two around it; false if it
+** has none that close */
+static bool MPU6050_Vote_SampleAt(MPU6050_Vote_t *VotePtr, uint32 Member, uint64 TimeNsec,
+                                  MPU6050_VoteEntry_t *EntryPtr)
+{
+    MPU6050_VoteMember_t      *memberPtr = &VotePtr->Members[Member];
+    const MPU6050_VoteEntry_t *aPtr;
+    const MPU6050_VoteEntry_t *bPtr;
+    const double              *a;
+    const double              *b;
+    double                    *out;
+    double                     w;
+    uint32                     i;
+
+    if (memberPtr->uiSeq == 0)
+    {
+        return false;
+    }
+
+    /* Times only move forward, so samples left behind are never needed again */
+    while (memberPtr->uiCursor + 1 != memberPtr->uiSeq &&
+           memberPtr->Ring[(memberPtr->uiCursor + 1) & MPU6050_VOTE_MASK].uiTimeNsec <= TimeNsec)
+    {
+        memberPtr->uiCursor++;
+    }
+
+    aPtr = &memberPtr->Ring[memberPtr->uiCursor & MPU6050_VOTE_MASK];
+    if (aPtr->uiTimeNsec == TimeNsec)
+    {
+        *EntryPtr = *aPtr;
+        return true;
+    }
+
+    if (aPtr->uiTimeNsec > TimeNsec || memberPtr->uiCursor + 1 == memberPtr->uiSeq)
+    {
+        return false;
+    }
+
+    bPtr = &memberPtr->Ring[(memberPtr->uiCursor + 1) & MPU6050_VOTE_MASK];
+    if (bPtr->uiTimeNsec - aPtr->uiTimeNsec > VotePtr->Cfg.uiMaxGapNsec)
+    {
+        return false;
+    }
+
+    w   = (double) (TimeNsec - aPtr->uiTimeNsec) / (double) (bPtr->uiTimeNsec - aPtr->uiTimeNsec);
+    a   = (const double*) &aPtr->Sample;
+    b   = (const double*) &bPtr->Sample;
+    out = MPU6050_Vote_Axes(&EntryPtr->Sample);
+    for (i = 0; i < MPU6050_VOTE_AXES; i++)
+    {
+        out[i] = a[i] + w * (b[i] - a[i]);
+    }
+    EntryPtr->uiTimeNsec = TimeNsec;
+    EntryPtr->ucChannels = aPtr->ucChannels & bPtr->ucChannels;
+
+    return true;
+}
+
+/* Whether to hold a reference sample at TimeNsec back for a member still to send its
+** samples around it.  A member silent for longer than the latency is not waited for. */
+static bool MPU6050_Vote_Waiting(const MPU6050_Vote_t *VotePtr, uint32 Member, uint64 TimeNsec)
+{
+    const MPU6050_VoteMember_t *memberPtr = &VotePtr->Members[Member];
+    uint64                      newest;
+
+    if (memberPtr->uiSeq == 0)
+    {
+        return false;
+    }
+
+    newest = memberPtr->Ring[(memberPtr->uiSeq - 1) & MPU6050_VOTE_MASK].uiTimeNsec;
+
+    return newest < TimeNsec && newest + VotePtr->Cfg.uiLatencyNsec >= TimeNsec;
+}
+
+/* Vote on the members' samples at TimeNsec and average the healthy ones */
+static void MPU6050_Vote_FuseAt(MPU6050_Vote_t *VotePtr, uint64 TimeNsec, MPU6050_FusedSample_t *FusedPtr)
+{
+    MPU6050_VoteEntry_t   entry[MPU6050_VOTE_MAX_MEMBERS];
+    MPU6050_VoteMember_t *memberPtr;
+    double                val[MPU6050_VOTE_MAX_MEMBERS];
+    double                median[MPU6050_VOTE_AXES];
+    uint32                voterCnt[MPU6050_VOTE_AXES];
+    double               *fused = MPU6050_Vote_Axes(&FusedPtr->Sample);
+    double                tol;
+    double                sum;
+    uint8                 availMask = 0;
+    uint8                 voterMask;
+    uint8                 faultedMask = 0;
+    uint8                 blameMask = 0;
+    uint8                 judgedMask = 0;
+    uint8                 bit;
+    uint32                cnt;
+    uint32                m;
+    uint32                a;
+
+    memset(FusedPtr, 0x00, sizeof(*FusedPtr));
+
+    for (m = 0; m < VotePtr->uiMemberCnt; m++)
+    {
+        bit = (uint8) (1 << m);
+        if (VotePtr->Members[m].bFaulted)
+        {
+            faultedMask |= bit;
+        }
+
+        if (MPU6050_Vote_SampleAt(VotePtr, m, TimeNsec, &entry[m]))
+        {
+            availMask |= bit;
+        }
+        else
+        {
+            FusedPtr->ucStaleMask |= bit;
+            VotePtr->Members[m].uiStaleCnt++;
+        }
+    }
+
+    /* Faulted members are judged against the median but do not vote on it */
+    voterMask = availMask & ~faultedMask;
+
+    for (a = 0; a < MPU6050_VOTE_AXES; a++)
+    {
+        cnt = 0;
+        for (m = 0; m < VotePtr->uiMemberCnt; m++)
+        {
+            if ((voterMask & (1 << m)) && (entry[m].ucChannels & MPU6050_VoteAxisChan[a]))
+            {
+                val[cnt++] = MPU6050_Vote_Axes(&entry[m].Sample)[a];
+            }
+        }
+
+        voterCnt[a] = cnt;
+        if (cnt == 0)
+        {
+            continue;
+        }
+        median[a] = MPU6050_Vote_Median(val, cnt);
+
+        tol = (MPU6050_VoteAxisChan[a] & MPU6050_CHAN_ACCEL) ? VotePtr->Cfg.dAccelTolG : VotePtr->Cfg.dGyroTolDps;
+        for (m = 0; m < VotePtr->uiMemberCnt; m++)
+        {
+            bit = (uint8) (1 << m);
+            if (!(availMask & bit) || !(entry[m].ucChannels & MPU6050_VoteAxisChan[a]))
+            {
+                continue;
+            }
+
+            judgedMask |= bit;
+            if (fabs(MPU6050_Vote_Axes(&entry[m].Sample)[a] - median[a]) > tol)
+            {
+                FusedPtr->ucOutlierMask |= bit;
+                if (cnt >= 3 || (faultedMask & bit))
+                {
+                    blameMask |= bit;
+                }
+            }
+        }
+    }
+
+    /* Mean of the voters that agree, or the median if none do */
+    for (a = 0; a < MPU6050_VOTE_AXES; a++)
+    {
+        if (voterCnt[a] == 0)
+        {
+            continue;
+        }
+
+        FusedPtr->ucChannels |= MPU6050_VoteAxisChan[a];
+        sum = 0.0;
+        cnt = 0;
+        for (m = 0; m < VotePtr->uiMemberCnt; m++)
+        {
+            bit = (uint8) (1 << m);
+            if ((voterMask & bit) && !(FusedPtr->ucOutlierMask & bit) &&
+                (entry[m].ucChannels & MPU6050_VoteAxisChan[a]))
+            {
+                sum += MPU6050_Vote_Axes(&entry[m].Sample)[a];
+                cnt++;
+                FusedPtr->ucUsedMask |= bit;
+            }
+        }
+
+        fused[a] = (cnt > 0) ? sum / cnt : median[a];
+    }
+
+    /* Fault and recovery persistence */
+    for (m = 0; m < VotePtr->uiMemberCnt; m++)
+    {
+        memberPtr = &VotePtr->Members[m];
+        bit       = (uint8) (1 << m);
+        if (!(judgedMask & bit))
+        {
+            continue;
+        }
+
+        if (FusedPtr->ucOutlierMask & bit)
+        {
+            memberPtr->uiOutlierCnt++;
+        }
+
+        if (!memberPtr->bFaulted)
+        {
+            if (!(blameMask & bit))
+            {
+                /* Disagreeing without a majority to say so neither counts nor clears */
+                if (!(FusedPtr->ucOutlierMask & bit))
+                {
+                    memberPtr->usOutlierRun = 0;
+                }
+            }
+            else if (++memberPtr->usOutlierRun >= VotePtr->Cfg.usFaultPersist)
+            {
+                memberPtr->bFaulted   = true;
+                memberPtr->usAgreeRun = 0;
+                memberPtr->uiFaultCnt++;
+            }
+        }
+        else if (blameMask & bit)
+        {
+            memberPtr->usAgreeRun = 0;
+        }
+        else if (++memberPtr->usAgreeRun >= VotePtr->Cfg.usRecoverPersist)
+        {
+            memberPtr->bFaulted     = false;
+            memberPtr->usOutlierRun = 0;
+        }
+
+        if (memberPtr->bFaulted)
+        {
+            FusedPtr->ucFaultMask |= bit;
+        }
+    }
+
+    /* Faulted members with nothing to be judged by stay faulted */
+    FusedPtr->ucFaultMask |= faultedMask & ~judgedMask;
+
+    for (m = 0; m < VotePtr->uiMemberCnt; m++)
+    {
+        if (FusedPtr->ucUsedMask & (1 << m))
+        {
+            FusedPtr->ucUsedCnt++;
+        }
+    }
+}
+
+/*
+** Function Definitions
+*/
+
+void MPU6050_Vote_Init(MPU6050_Vote_t *VotePtr, uint32 MemberCnt, const MPU6050_VoteCfg_t *CfgPtr)
+{
+    memset(VotePtr, 0x00, sizeof(*VotePtr));
+
+    VotePtr->Cfg         = *CfgPtr;
+    VotePtr->uiMemberCnt = (MemberCnt == 0) ? 1 :
+                           (MemberCnt > MPU6050_VOTE_MAX_MEMBERS) ? MPU6050_VOTE_MAX_MEMBERS : MemberCnt;
+
+    if (VotePtr->Cfg.usFaultPersist == 0)
+    {
+        VotePtr->Cfg.usFaultPersist = 1;
+    }
+    if (VotePtr->Cfg.usRecoverPersist == 0)
+    {
+        VotePtr->Cfg.usRecoverPersist = 1;
+    }
+}
+
+bool MPU6050_Vote_Add(MPU6050_Vote_t *VotePtr, uint32 Member, uint64 TimeNsec, uint8 Channels,
+                      const MPU6050_Sample_t *SamplePtr)
+{
+    MPU6050_VoteMember_t *memberPtr;
+    MPU6050_VoteEntry_t  *entryPtr;
+    const double         *axes = (const double*) SamplePtr;
+    uint32                i;
+
+    if (Member >= VotePtr->uiMemberCnt)
+    {
+        return false;
+    }
+
+    memberPtr = &VotePtr->Members[Member];
+    if (memberPtr->uiSeq > 0 &&
+        TimeNsec <= memberPtr->Ring[(memberPtr->uiSeq - 1) & MPU6050_VOTE_MASK].uiTimeNsec)
+    {
+        return false;
+    }
+
+    /* A value that cannot be compared cannot be voted on */
+    for (i = 0; i < MPU6050_VOTE_AXES; i++)
+    {
+        if (!isfinite(axes[i]))
+        {
+            return false;
+        }
+    }
+
+    entryPtr = &memberPtr->Ring[memberPtr->uiSeq & MPU6050_VOTE_MASK];
+    entryPtr->uiTimeNsec = TimeNsec;
+    entryPtr->ucChannels = Channels;
+    entryPtr->Sample     = *SamplePtr;
+    memberPtr->uiSeq++;
+
+    if (memberPtr->uiSeq - memberPtr->uiCursor > MPU6050_VOTE_RING_SAMPLES)
+    {
+        memberPtr->uiCursor = memberPtr->uiSeq - MPU6050_VOTE_RING_SAMPLES;
+    }
+
+    if (Member == 0 && memberPtr->uiSeq - VotePtr->uiNextSeq > MPU6050_VOTE_RING_SAMPLES)
+    {
+        VotePtr->uiLostCnt += memberPtr->uiSeq - MPU6050_VOTE_RING_SAMPLES - VotePtr->uiNextSeq;
+        VotePtr->uiNextSeq  = memberPtr->uiSeq - MPU6050_VOTE_RING_SAMPLES;
+    }
+
+    return true;
+}
+
+uint32 MPU6050_Vote_Fuse(MPU6050_Vote_t *VotePtr, uint64 NowNsec, MPU6050_VoteOut_t *Out, uint32 MaxOut)
+{
+    const MPU6050_VoteMember_t *refPtr = &VotePtr->Members[0];
+    uint64                      timeNsec;
+    uint32                      outCnt = 0;
+    uint32                      m;
+    bool                        waiting;
+
+    while (outCnt < MaxOut && VotePtr->uiNextSeq != refPtr->uiSeq)
+    {
+        timeNsec = refPtr->Ring[VotePtr->uiNextSeq & MPU6050_VOTE_MASK].uiTimeNsec;
+
+        if (NowNsec < timeNsec + VotePtr->Cfg.uiLatencyNsec)
+        {
+            waiting = false;
+            for (m = 1; m < VotePtr->uiMemberCnt && !waiting; m++)
+            {
+                waiting = MPU6050_Vote_Waiting(VotePtr, m, timeNsec);
+            }
+
+            if (waiting)
+            {
+                break;
+            }
+        }
+
+        Out[outCnt].uiTimeNsec = timeNsec;
+        Out[outCnt].uiSeq      = VotePtr->uiNextSeq;
+        Out[outCnt].uiSpare    = 0;
+        MPU6050_Vote_FuseAt(VotePtr, timeNsec, &Out[outCnt].Fused);
+
+        VotePtr->uiNextSeq++;
+        outCnt++;
+    }
+
+    return outCnt;
+}
+
+/*=======================================================================================
+** End of file mpu6050_vote.c
+**=====================================================================================*/
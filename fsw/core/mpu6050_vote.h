@@ -0,0 +1,134 @@
+/*=======================================================================================
+** File Name:  mpu6050_vote.h
+**
+** Title:  Redundancy Voting Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the time alignment, median voting and averaging of the samples
+**           of several redundant devices into one fused sample stream.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_VOTE_H_
+#define _MPU6050_VOTE_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "mpu6050_core_types.h"
+#include "mpu6050_platform_cfg.h"
+
+/*
+** Local Defines
+*/
+
+/* Ring index arithmetic relies on this */
+#if (MPU6050_VOTE_RING_SAMPLES & (MPU6050_VOTE_RING_SAMPLES - 1)) != 0
+#error "MPU6050_VOTE_RING_SAMPLES must be a power of 2"
+#endif
+
+/* Health masks hold a bit per member */
+#if MPU6050_VOTE_MAX_MEMBERS > 8
+#error "MPU6050_VOTE_MAX_MEMBERS must not exceed 8"
+#endif
+
+/*
+** Local Structure Declarations
+*/
+
+typedef struct
+{
+    double  dAccelTolG;        /* Farthest an accel axis may be from the median */
+    double  dGyroTolDps;       /* Farthest a gyro axis may be from the median */
+    uint64  uiMaxGapNsec;      /* Interpolate only between samples this close */
+    uint64  uiLatencyNsec;     /* Longest a reference sample waits for the others */
+    uint16  usFaultPersist;    /* Outliers in a row that fault a member, at least 1 */
+    uint16  usRecoverPersist;  /* Agreements in a row that clear a fault, at least 1 */
+} MPU6050_VoteCfg_t;
+
+/* One sample of one member */
+typedef struct
+{
+    uint64  uiTimeNsec;
+    uint8   ucChannels;        /* MPU6050_CHAN_* axes present; the others are not voted */
+    uint8   aucSpare[7];
+    MPU6050_Sample_t Sample;
+} MPU6050_VoteEntry_t;
+
+typedef struct
+{
+    MPU6050_VoteEntry_t Ring[MPU6050_VOTE_RING_SAMPLES];
+    uint32  uiSeq;             /* Samples added; the newest is uiSeq - 1 */
+    uint32  uiCursor;          /* Oldest sample still needed to interpolate at */
+    uint16  usOutlierRun;      /* Consecutive outliers */
+    uint16  usAgreeRun;        /* Consecutive agreements while faulted */
+    bool    bFaulted;
+    uint8   aucSpare[3];
+    uint32  uiFaultCnt;        /* Times faulted */
+    uint32  uiOutlierCnt;      /* Fused samples it disagreed with */
+    uint32  uiStaleCnt;        /* Fused samples it had no sample for */
+} MPU6050_VoteMember_t;
+
+/* One fused sample with the health of every member behind it.  Bit n of each mask is
+** member n. */
+typedef struct
+{
+    MPU6050_Sample_t Sample;   /* Mean of the members used, per axis */
+    uint8   ucUsedMask;        /* Averaged into Sample */
+    uint8   ucStaleMask;       /* Had no sample near the fused time */
+    uint8   ucOutlierMask;     /* Farther than tolerance from the median on some axis */
+    uint8   ucFaultMask;       /* Excluded until it agrees again for usRecoverPersist */
+    uint8   ucUsedCnt;         /* Members in ucUsedMask */
+    uint8   ucChannels;        /* MPU6050_CHAN_* axes in Sample; the others are 0 */
+    uint8   aucSpare[2];
+} MPU6050_FusedSample_t;
+
+typedef struct
+{
+    uint64  uiTimeNsec;        /* Time of the reference sample */
+    uint32  uiSeq;             /* Reference sample number, consecutive unless some were lost */
+    uint32  uiSpare;
+    MPU6050_FusedSample_t Fused;
+} MPU6050_VoteOut_t;
+
+/* Member 0 is the reference: a fused sample is made at the time of each of its
+** samples. */
+typedef struct
+{
+    MPU6050_VoteCfg_t    Cfg;
+    uint32               uiMemberCnt;
+    uint32               uiNextSeq;     /* Reference sample to fuse next */
+    uint32               uiLostCnt;     /* Reference samples overwritten before fusing */
+    MPU6050_VoteMember_t Members[MPU6050_VOTE_MAX_MEMBERS];
+} MPU6050_Vote_t;
+
+/*
+** Local Function Prototypes
+*/
+
+/* Start over with MemberCnt members, 1 to MPU6050_VOTE_MAX_MEMBERS, all healthy */
+void   MPU6050_Vote_Init(MPU6050_Vote_t *VotePtr, uint32 MemberCnt, const MPU6050_VoteCfg_t *CfgPtr);
+
+/* Take a sample of a member.  Samples of a member must come in time order; one that
+** does not is dropped and false returned. */
+bool   MPU6050_Vote_Add(MPU6050_Vote_t *VotePtr, uint32 Member, uint64 TimeNsec, uint8 Channels,
+                        const MPU6050_Sample_t *SamplePtr);
+
+/* Fuse the reference samples that every member has caught up with, or that have
+** waited uiLatencyNsec as of NowNsec, oldest first.  Returns the count put in Out. */
+uint32 MPU6050_Vote_Fuse(MPU6050_Vote_t *VotePtr, uint64 NowNsec, MPU6050_VoteOut_t *Out, uint32 MaxOut);
+
+#endif /* _MPU6050_VOTE_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_vote.h
+**=====================================================================================*/
@@ -22,6 +22,14 @@
 
 #define MPU6050_MAIN_TASK_PERF_ID            51
 
+/* Stages of a processing cycle, see MPU6050_STAGE_* */
+#define MPU6050_READ_PERF_ID                 52
+#define MPU6050_CONVERT_PERF_ID              53
+#define MPU6050_RECORD_PERF_ID               54
+#define MPU6050_ATTITUDE_PERF_ID             55
+#define MPU6050_PUBLISH_PERF_ID              56
+#define MPU6050_FUSE_PERF_ID                 57
+
 #endif /* _MPU6050_PERFIDS_H_ */
 
 /*=======================================================================================
@@ -25,7 +25,15 @@
 #define MPU6050_SEND_HK_MID   0x11C1
 #define MPU6050_WAKEUP_MID    0x11D0
 #define MPU6050_OUT_DATA_MID  0x11D1
+#define MPU6050_OUT_BATCH_MID 0x11D2
+#define MPU6050_OUT_RAW_MID   0x11D3
+#define MPU6050_OUT_COMP_MID  0x11D4
+#define MPU6050_OUT_ATT_MID   0x11D5
+#define MPU6050_OUT_SUM_MID   0x11D6
+#define MPU6050_REC_BLOCK_MID 0x11D7
+#define MPU6050_OUT_FUSED_MID 0x11D8
 #define MPU6050_HK_TLM_MID    0x11BB
+#define MPU6050_DIAG_TLM_MID  0x11BC
 
 #endif /* _MPU6050_MSGIDS_H_ */
 
@@ -30,6 +30,104 @@
 /* Accelerometer readings per second */
 #define MPU6050_SAMPLE_RATE_HZ 10
 
+/* Entries in the output stream table */
+#define MPU6050_MAX_STREAMS  6
+
+/* Sampling rate profiles an adaptive configuration table can switch between */
+#define MPU6050_MAX_RATE_PROFILES  4
+
+/* Capacity of one batched output packet (MPU6050_OutBatch_t).
+** Compressed batches are coded as one block, so this must not exceed 255. */
+#define MPU6050_MAX_BATCH_SAMPLES  50
+
+/* Sample timing model (see mpu6050_timing.c) */
+#define MPU6050_TIME_FORGET_FACTOR     0.999   /* RLS forgetting factor per read         */
+#define MPU6050_TIME_RESYNC_SEC        0.050   /* Restart fit on a residual this large   */
+#define MPU6050_TIME_OFFSET_PRIOR_SEC  0.010   /* Initial uncertainty of the fit offset  */
+#define MPU6050_TIME_PERIOD_PRIOR_PPM  5000.0  /* Initial uncertainty of the sensor clock */
+#define MPU6050_TIME_REBASE_SAMPLES    65536   /* Move the fit origin after this many    */
+
+/* Onboard recorder (see mpu6050_recorder.c) */
+#define MPU6050_REC_BLOCK_BYTES            4096  /* Block size, a multiple of the page size */
+#define MPU6050_REC_DUMP_BLOCKS_PER_CYCLE  4     /* Blocks a dump sends or writes per cycle */
+
+/* Binary trace (see mpu6050_trace.h): 0 builds no tracing at all, 1 traces
+** occasional events, 2 also traces every cycle */
+#ifndef MPU6050_TRACE_LEVEL
+#define MPU6050_TRACE_LEVEL  2
+#endif
+#define MPU6050_TRACE_RING_SIZE  1024  /* Records kept per task */
+
+/* Timing diagnostics (see mpu6050_diag.c): a cycle taking longer than this share of
+** the acquisition period in effect, from wakeup to the next wait, counts as a
+** deadline miss */
+#define MPU6050_DIAG_DEADLINE_PCT  100
+
+/* Timer-paced acquisition (see mpu6050_sched.c): commands and housekeeping are only
+** serviced after a read if at least this long remains before the next one, or if
+** they have been put off for this many ticks, and then one message at a time */
+#define MPU6050_SCHED_IDLE_MARGIN_USEC  2000
+#define MPU6050_SCHED_IDLE_MAX_DEFER    4
+
+/* Stack touched after locking memory (see mpu6050_rt.c); at least what a cycle uses */
+#define MPU6050_RT_STACK_PREFAULT_BYTES  (64 * 1024)
+
+/* Consolidated dispatch (see mpu6050_dispatch.c): 1 takes wakeups, commands and
+** subscribed data off a single pipe, 0 uses the SCH, CMD and TLM pipes */
+#ifndef MPU6050_DISPATCH_SINGLE_PIPE
+#define MPU6050_DISPATCH_SINGLE_PIPE  0
+#endif
+#define MPU6050_DISPATCH_PIPE_DEPTH  (MPU6050_SCH_PIPE_DEPTH + MPU6050_CMD_PIPE_DEPTH + MPU6050_TLM_PIPE_DEPTH)
+#define MPU6050_DISPATCH_BUDGET      16   /* Messages taken off the pipe per cycle       */
+#define MPU6050_DISPATCH_MSG_BYTES   256  /* Largest message held back until urgent ones */
+
+/* Register-map simulator (see mpu6050_sim.c): 1 lets a table devicePath of
+** "sim:<profile>" open a simulated device instead of an I2C bus */
+#ifndef MPU6050_SIM_ENABLE
+#define MPU6050_SIM_ENABLE  0
+#endif
+#define MPU6050_SIM_PATH_PREFIX  "sim:"
+#define MPU6050_SIM_MAX_DEVICES  4     /* Simulated devices open at once              */
+#define MPU6050_SIM_TIME_SCALE   1.0   /* Device seconds per second; 0 steps manually */
+
+/* Bus capture and replay (see mpu6050_capture.c): 1 lets a table devicePath of
+** "replay:<capture file>" play a capture back instead of opening an I2C bus */
+#ifndef MPU6050_REPLAY_ENABLE
+#define MPU6050_REPLAY_ENABLE  0
+#endif
+#define MPU6050_REPLAY_PATH_PREFIX  "replay:"
+
+/* SPI transport (see mpu6050_spi.c): a table devicePath under this prefix opens an
+** MPU-6000 or MPU-6500 family device on spidev.  Registers are written at the clock
+** all of them take; interrupt and sensor data are read at the faster one the data
+** sheets allow for those registers only.  FIFO_COUNT and FIFO_R_W are read at their
+** own clock, within spec at MPU6050_SPI_CLOCK_HZ; a faster one is outside it. */
+#define MPU6050_SPI_PATH_PREFIX    "/dev/spidev"
+#define MPU6050_SPI_MAX_DEVICES    4
+#define MPU6050_SPI_CLOCK_HZ       1000000
+#define MPU6050_SPI_DATA_CLOCK_HZ  20000000
+#define MPU6050_SPI_FIFO_CLOCK_HZ  MPU6050_SPI_CLOCK_HZ
+
+/* Sample processing (see mpu6050_fixed.c): 1 converts, calibrates, measures motion and
+** propagates attitude in fixed point, for targets without an FPU; 0 uses double */
+#ifndef MPU6050_FIXED_POINT
+#define MPU6050_FIXED_POINT  0
+#endif
+
+/* Redundancy voting (see mpu6050_vote.c): the calibrated streams of up to this many
+** other MPU6050 app instances are fused with this device's samples.  The ring holds
+** each device's samples until fused; it must cover the latency allowed in the table
+** at the highest sample rate. */
+#define MPU6050_VOTE_MAX_PEERS     3
+#define MPU6050_VOTE_MAX_MEMBERS   (MPU6050_VOTE_MAX_PEERS + 1)  /* Peers and this device, at most 8 */
+#define MPU6050_VOTE_RING_SAMPLES  256                           /* Per device, a power of 2 */
+
+/* Digital Motion Processor (see mpu6050_dmp_load.c): memory writes the table can make
+** after the firmware image is loaded to switch on its features, and the bytes each
+** can hold */
+#define MPU6050_DMP_MAX_PATCHES    8
+#define MPU6050_DMP_PATCH_BYTES    12
+
 /* Where to store the configuration table */
 #define MPU6050_TBL_PATH "/cf/mpu6050_table.tbl"
 
@@ -0,0 +1,170 @@
+/*=======================================================================================
+** File Name:  mpu6050_age.c
+**
+** Title:  Sample Age Helper for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To measure the age of MPU6050 samples from the CLOCK_MONOTONIC acquisition
+**           and publish times carried in MPU6050_OutData_t.
+**
+** Functions Defined:
+**    MPU6050_AgeTracker_Init    - Empty a tracker
+**    MPU6050_AgeTracker_Publish - Count the age of a sample as it is published
+**    MPU6050_AgeTracker_Receive - Count the age of a sample as it is received
+**    MPU6050_AgeTracker_Stats   - Min, mean, 99th percentile and max age
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: CLOCK_MONOTONIC is only comparable on the host that took the sample, so a
+**    consumer elsewhere (over a bridge or the ground) cannot use this.
+** 2: A zero acquisition time marks a sample that was never timed; it is not counted.
+** 3: The 99th percentile is the upper edge of the bin it falls in, with bins an eighth
+**    of an octave wide, and never more than the largest age seen.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <string.h>
+
+#include "mpu6050_age.h"
+
+/*
+** Local Function Definitions
+*/
+
+/* Bin of an age: the octave above the sub-bin bits, then its top sub-bits below the
+ * leading one.  Ages under 2^MPU6050_AGE_SUB_BITS ns are their own bin. */
+static uint32 MPU6050_AgeBin(uint64 Nsec)
+{
+    uint32 nsec = (Nsec > 0xFFFFFFFFull) ? 0xFFFFFFFF : (uint32) Nsec;
+    uint32 octave;
+
+    if (nsec < (1u << MPU6050_AGE_SUB_BITS))
+    {
+        return nsec;
+    }
+
+    octave = 31 - (uint32) __builtin_clz(nsec);
+    return ((octave - MPU6050_AGE_SUB_BITS + 1) << MPU6050_AGE_SUB_BITS) |
+           ((nsec >> (octave - MPU6050_AGE_SUB_BITS)) & ((1u << MPU6050_AGE_SUB_BITS) - 1));
+}
+
+/* Largest age that lands in a bin */
+static uint64 MPU6050_AgeBinTop(uint32 Bin)
+{
+    uint32 octave = (Bin >> MPU6050_AGE_SUB_BITS) + MPU6050_AGE_SUB_BITS - 1;
+    uint64 sub    = Bin & ((1u << MPU6050_AGE_SUB_BITS) - 1);
+
+    if (Bin < (1u << MPU6050_AGE_SUB_BITS))
+    {
+        return Bin;
+    }
+
+    return (((1ull << MPU6050_AGE_SUB_BITS) + sub + 1) << (octave - MPU6050_AGE_SUB_BITS)) - 1;
+}
+
+static void MPU6050_AgeTracker_AddAge(MPU6050_AgeTracker_t *TrackerPtr, uint64 AgeNsec)
+{
+    MPU6050_Hist_Add(&TrackerPtr->Age, AgeNsec);
+    TrackerPtr->auiAgeBin[MPU6050_AgeBin(AgeNsec)]++;
+}
+
+void MPU6050_AgeTracker_Init(MPU6050_AgeTracker_t *TrackerPtr)
+{
+    MPU6050_Hist_Reset(&TrackerPtr->Age);
+    MPU6050_Hist_Reset(&TrackerPtr->Transit);
+    memset(TrackerPtr->auiAgeBin, 0x00, sizeof(TrackerPtr->auiAgeBin));
+}
+
+uint64 MPU6050_AgeTracker_Publish(MPU6050_AgeTracker_t *TrackerPtr, uint64 AcqTimeNsec)
+{
+    uint64 nowNsec = MPU6050_DiagNow();
+    uint64 ageNsec;
+
+    if (AcqTimeNsec == 0 || AcqTimeNsec > nowNsec)
+    {
+        return 0;
+    }
+
+    ageNsec = nowNsec - AcqTimeNsec;
+    MPU6050_AgeTracker_AddAge(TrackerPtr, ageNsec);
+
+    return ageNsec;
+}
+
+uint64 MPU6050_AgeTracker_Receive(MPU6050_AgeTracker_t *TrackerPtr, uint64 AcqTimeNsec, uint64 PubTimeNsec)
+{
+    uint64 nowNsec = MPU6050_DiagNow();
+
+    if (PubTimeNsec != 0 && PubTimeNsec <= nowNsec)
+    {
+        MPU6050_Hist_Add(&TrackerPtr->Transit, nowNsec - PubTimeNsec);
+    }
+
+    if (AcqTimeNsec == 0 || AcqTimeNsec > nowNsec)
+    {
+        return 0;
+    }
+
+    MPU6050_AgeTracker_AddAge(TrackerPtr, nowNsec - AcqTimeNsec);
+
+    return nowNsec - AcqTimeNsec;
+}
+
+void MPU6050_AgeTracker_Stats(const MPU6050_AgeTracker_t *TrackerPtr, MPU6050_AgeStats_t *StatsPtr)
+{
+    const MPU6050_Histogram_t *histPtr = &TrackerPtr->Age;
+    uint64 rank;
+    uint64 seen = 0;
+    uint64 p99Nsec;
+    uint32 b;
+
+    if (histPtr->uiCount == 0)
+    {
+        StatsPtr->uiMinUsec  = 0;
+        StatsPtr->uiMeanUsec = 0;
+        StatsPtr->uiP99Usec  = 0;
+        StatsPtr->uiMaxUsec  = 0;
+        return;
+    }
+
+    /* Smallest bin holding at least 99 percent of the ages, as MPU6050_Hist_Percentile */
+    rank = (uint64) (0.99 * histPtr->uiCount + 0.5);
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+
+    for (b = 0; b < MPU6050_AGE_BINS - 1; b++)
+    {
+        seen += TrackerPtr->auiAgeBin[b];
+        if (seen >= rank)
+        {
+            break;
+        }
+    }
+
+    p99Nsec = MPU6050_AgeBinTop(b);
+    if (p99Nsec > histPtr->uiMaxNsec)
+    {
+        p99Nsec = histPtr->uiMaxNsec;
+    }
+
+    StatsPtr->uiMinUsec  = histPtr->uiMinNsec / 1000;
+    StatsPtr->uiMeanUsec = (uint32) (histPtr->uiSumNsec / histPtr->uiCount / 1000);
+    StatsPtr->uiP99Usec  = (uint32) (p99Nsec / 1000);
+    StatsPtr->uiMaxUsec  = histPtr->uiMaxNsec / 1000;
+}
+
+/*=======================================================================================
+** End of file mpu6050_age.c
+**=====================================================================================*/
@@ -0,0 +1,73 @@
+/*=======================================================================================
+** File Name:  mpu6050_age.h
+**
+** Title:  Sample Age Helper Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the helper that measures how old MPU6050 samples are when they
+**           are published or received.  Consumers of MPU6050_OutData_t on the same host
+**           can link the mpu6050_age library to check their own latency budget.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_AGE_H_
+#define _MPU6050_AGE_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "mpu6050_diag.h"
+
+/*
+** Local Defines
+*/
+
+/* Ages are binned 2^MPU6050_AGE_SUB_BITS to an octave, so the 99th percentile comes
+** out at most 1/8 above the true value instead of up to twice it.  Ages under
+** 2^MPU6050_AGE_SUB_BITS ns each get a bin of their own. */
+#define MPU6050_AGE_SUB_BITS  3
+#define MPU6050_AGE_BINS      ((32 - MPU6050_AGE_SUB_BITS + 1) << MPU6050_AGE_SUB_BITS)
+
+/*
+** Local Structure Declarations
+*/
+
+/* Age statistics of the samples seen by one publisher or consumer */
+typedef struct
+{
+    MPU6050_Histogram_t Age;      /* Acquisition to publish (or receive) */
+    MPU6050_Histogram_t Transit;  /* Publish to receive, consumers only */
+    uint32  auiAgeBin[MPU6050_AGE_BINS]; /* Age again, finer, for the percentile */
+} MPU6050_AgeTracker_t;
+
+/* Summary reported in housekeeping, in microseconds */
+typedef struct
+{
+    uint32  uiMinUsec;
+    uint32  uiMeanUsec;
+    uint32  uiP99Usec;
+    uint32  uiMaxUsec;
+} MPU6050_AgeStats_t;
+
+/*
+** Local Function Prototypes
+*/
+void   MPU6050_AgeTracker_Init(MPU6050_AgeTracker_t *TrackerPtr);
+uint64 MPU6050_AgeTracker_Publish(MPU6050_AgeTracker_t *TrackerPtr, uint64 AcqTimeNsec);
+uint64 MPU6050_AgeTracker_Receive(MPU6050_AgeTracker_t *TrackerPtr, uint64 AcqTimeNsec, uint64 PubTimeNsec);
+void   MPU6050_AgeTracker_Stats(const MPU6050_AgeTracker_t *TrackerPtr, MPU6050_AgeStats_t *StatsPtr);
+
+#endif /* _MPU6050_AGE_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_age.h
+**=====================================================================================*/
@@ -32,6 +32,7 @@
 ** Include Files
 */
 #include <string.h>
+#include <stddef.h>
 #include <assert.h>
 #include <fcntl.h>
 #include <linux/i2c-dev.h>
@@ -62,7 +63,9 @@
 #include "mpu6050_mission_cfg.h"
 #include "mpu6050_app.h"
 #include "mpu6050_hw_drv.h"
-#include "osapi-printf.h"
+#include "mpu6050_timing.h"
+#include "mpu6050_conv.h"
+#include "mpu6050_trace.h"
 
 /*
 ** Local Defines
@@ -86,6 +89,18 @@ MPU6050_AppData_t  g_MPU6050_AppData;
 ** Local Variables
 */
 
+/* Perf log ID of each MPU6050_STAGE_* */
+static const uint32 MPU6050_StagePerfIds[MPU6050_STAGE_CNT] =
+{
+    MPU6050_READ_PERF_ID,
+    MPU6050_CONVERT_PERF_ID,
+    MPU6050_RECORD_PERF_ID,
+    MPU6050_ATTITUDE_PERF_ID,
+    MPU6050_FUSE_PERF_ID,
+    MPU6050_PUBLISH_PERF_ID,
+    MPU6050_MAIN_TASK_PERF_ID,
+};
+
 /*
 ** Local Function Definitions
 */
@@ -147,6 +162,15 @@ int32 MPU6050_InitEvent()
     g_MPU6050_AppData.EventTbl[13].EventID = MPU6050_MSGLEN_ERR_EID;
     g_MPU6050_AppData.EventTbl[14].EventID = MPU6050_DEVICE_ERR_EID;
 
+    g_MPU6050_AppData.EventTbl[15].EventID = MPU6050_REC_INF_EID;
+    g_MPU6050_AppData.EventTbl[16].EventID = MPU6050_REC_ERR_EID;
+
+    g_MPU6050_AppData.EventTbl[17].EventID = MPU6050_FUSION_INF_EID;
+    g_MPU6050_AppData.EventTbl[18].EventID = MPU6050_FUSION_ERR_EID;
+
+    g_MPU6050_AppData.EventTbl[19].EventID = MPU6050_DMP_INF_EID;
+    g_MPU6050_AppData.EventTbl[20].EventID = MPU6050_DMP_ERR_EID;
+
     /* Register the table with CFE */
     iStatus = CFE_EVS_Register(g_MPU6050_AppData.EventTbl, MPU6050_EVT_CNT, CFE_EVS_EventFilter_BINARY);
     if (iStatus != CFE_SUCCESS)
@@ -191,6 +215,8 @@ int32 MPU6050_InitEvent()
 **    g_MPU6050_AppData.TlmPipeId
 **
 ** Limitations, Assumptions, External Events, and Notes:
+** 1: With MPU6050_DISPATCH_SINGLE_PIPE only the dispatch pipe is created, by
+**    MPU6050_InitDispatchPipe.
 **
 ** Algorithm:
 **
@@ -203,6 +229,11 @@ int32 MPU6050_InitPipe()
 {
     int32 iStatus = CFE_SUCCESS;
 
+#if MPU6050_DISPATCH_SINGLE_PIPE
+    /* Wakeups, commands and data all arrive on one pipe */
+    iStatus = MPU6050_InitDispatchPipe();
+#else
+
     /* Init schedule pipe */
     g_MPU6050_AppData.usSchPipeDepth = MPU6050_SCH_PIPE_DEPTH;
     memset((void*)g_MPU6050_AppData.cSchPipeName, '\0', sizeof(g_MPU6050_AppData.cSchPipeName));
@@ -279,6 +310,8 @@ int32 MPU6050_InitPipe()
         **
         ** Examples:
         **     CFE_SB_Subscribe(GNCEXEC_OUT_DATA_MID, g_MPU6050_AppData.TlmPipeId);
+        **
+        ** Fusion peers depend on the table; MPU6050_InitFusion subscribes to them.
         */
     }
     else
@@ -288,6 +321,7 @@ int32 MPU6050_InitPipe()
     }
 
 MPU6050_InitPipe_Exit_Tag:
+#endif
     return (iStatus);
 }
 
@@ -314,6 +348,14 @@ MPU6050_InitPipe_Exit_Tag:
 ** Global Outputs/Writes:
 **    g_MPU6050_AppData.InData
 **    g_MPU6050_AppData.OutData
+**    g_MPU6050_AppData.Streams
+**    g_MPU6050_AppData.Recorder
+**    g_MPU6050_AppData.TraceRing
+**    g_MPU6050_AppData.ucRateProfile
+**    g_MPU6050_AppData.usPublishDecimation
+**    g_MPU6050_AppData.ucPowerState
+**    g_MPU6050_AppData.auiPowerStateNsec
+**    g_MPU6050_AppData.ucChannelMask
 **    g_MPU6050_AppData.HkTlm
 **
 ** Limitations, Assumptions, External Events, and Notes:
@@ -336,10 +378,56 @@ int32 MPU6050_InitData()
     memset((void*) &g_MPU6050_AppData.OutData, 0x00, sizeof(g_MPU6050_AppData.OutData));
     CFE_MSG_Init((CFE_MSG_Message_t *) &g_MPU6050_AppData.OutData, CFE_SB_ValueToMsgId(MPU6050_OUT_DATA_MID), sizeof(g_MPU6050_AppData.OutData));
 
+    /* Init output streams; packet headers are set up per packet in MPU6050_StartStream */
+    memset((void*) g_MPU6050_AppData.Streams, 0x00, sizeof(g_MPU6050_AppData.Streams));
+
+    /* The recorder is mapped in MPU6050_RecorderOpen once the table is loaded */
+    memset((void*) &g_MPU6050_AppData.Recorder, 0x00, sizeof(g_MPU6050_AppData.Recorder));
+    g_MPU6050_AppData.Recorder.FileID     = -1;
+    g_MPU6050_AppData.Recorder.DumpFileID = -1;
+
+    /* The tick is armed in MPU6050_InitSched once the table is loaded */
+    MPU6050_Sched_Init(&g_MPU6050_AppData.Sched);
+    g_MPU6050_AppData.usIdleDeferTicks = 0;
+
+    /* The attitude is propagated from the first sample it is given */
+    g_MPU6050_AppData.dAttLastTime = 0.0;
+    g_MPU6050_AppData.bAttHaveLast = false;
+
+    /* The table's fixed rate until MPU6050_InitRateProfiles says otherwise */
+    g_MPU6050_AppData.ucRateProfile       = MPU6050_RATE_PROFILE_FIXED;
+    g_MPU6050_AppData.ucRateProfileCnt    = 0;
+    g_MPU6050_AppData.usPublishDecimation = 1;
+
+    /* The MPU-6050 until MPU6050_InitDevice finds what is there */
+    g_MPU6050_AppData.VariantPtr = MPU6050_Variant_Default();
+
+    /* Active until MPU6050_InitApp applies the table's power state */
+    g_MPU6050_AppData.ucPowerState          = MPU6050_POWER_ACTIVE;
+    g_MPU6050_AppData.ucWakeRate            = 0;
+    g_MPU6050_AppData.uiPowerStateStartNsec = MPU6050_DiagNow();
+    g_MPU6050_AppData.uiWakeStartNsec       = 0;
+    memset((void*) g_MPU6050_AppData.auiPowerStateNsec, 0x00, sizeof(g_MPU6050_AppData.auiPowerStateNsec));
+
+    /* Every channel until MPU6050_ConfigChannels applies the table's mask */
+    g_MPU6050_AppData.ucChannelMask     = MPU6050_CHAN_ALL;
+    g_MPU6050_AppData.ucAxisEnable      = MPU6050_CHAN_ALL;
+    g_MPU6050_AppData.ucFifoChannels    = MPU6050_CHAN_ALL;
+    g_MPU6050_AppData.ucFifoSampleBytes = MPU6050_SAMPLE_BYTES;
+
+#if MPU6050_TRACE_LEVEL > MPU6050_TRACE_LEVEL_OFF
+    MPU6050_TraceInit(&g_MPU6050_AppData.TraceRing);
+#endif
+
     /* Init housekeeping packet */
     memset((void*) &g_MPU6050_AppData.HkTlm, 0x00, sizeof(g_MPU6050_AppData.HkTlm));
     CFE_MSG_Init((CFE_MSG_Message_t *) &g_MPU6050_AppData.HkTlm, CFE_SB_ValueToMsgId(MPU6050_HK_TLM_MID), sizeof(g_MPU6050_AppData.HkTlm));
 
+    /* Init diagnostics packet */
+    memset((void*) &g_MPU6050_AppData.DiagTlm, 0x00, sizeof(g_MPU6050_AppData.DiagTlm));
+    CFE_MSG_Init((CFE_MSG_Message_t *) &g_MPU6050_AppData.DiagTlm, CFE_SB_ValueToMsgId(MPU6050_DIAG_TLM_MID), sizeof(g_MPU6050_AppData.DiagTlm));
+    MPU6050_ResetDiagnostics();
+
     return (iStatus);
 }
 
@@ -433,7 +521,15 @@ int32 MPU6050_InitTable(void)
 **    int32 iStatus - Status of initialization
 **
 ** Routines Called:
-**    Linux file IO commands - open, ioctl, etc
+**    MPU6050_DiagNow
+**    MPU6050_OpenDevice
+**    MPU6050_DetectVariant
+**    MPU6050_DmpLoadImage
+**    MPU6050_DmpDecimation
+**    MPU6050_Core_Init
+**    MPU6050_ConfigDevice
+**    MPU6050_BusBatched
+**    CFE_EVS_SendEvent
 **
 ** Called By:
 **    MPU6050_InitApp
@@ -443,9 +539,24 @@ int32 MPU6050_InitTable(void)
 **
 ** Global Outputs/Writes:
 **    g_MPU6050_AppData.FileID
+**    g_MPU6050_AppData.VariantPtr
+**    g_MPU6050_AppData.HkTlm.ucWhoAmI
+**    g_MPU6050_AppData.Core
+**    g_MPU6050_AppData.auiInitPhaseUsec
+**    g_MPU6050_AppData.uiWakeStartNsec
 **    MPU6050_BUS_FILEPATH
 **
 ** Limitations, Assumptions, External Events, and Notes:
+** 1: With MPU6050_SIM_ENABLE, a devicePath of "sim:<profile>" runs the app on the
+**    register-map simulator instead of a bus (see mpu6050_sim.c).
+** 2: A DMP image is read once here; MPU6050_ConfigDevice writes it to the device.
+** 3: A devicePath under MPU6050_SPI_PATH_PREFIX is an SPI device (see mpu6050_spi.c).
+**    Either way WHO_AM_I tells which chip answers, and one the app does not know
+**    stops the init rather than be misconfigured.
+** 4: One event reports the chip, the time from the start of the init until the
+**    device is configured, each phase of it, and whether the register writes went
+**    out in I2C_RDWR batches or, off I2C or on an SMBus-only adapter, one by one.  The HK wake-up latency counts on
+**    from the same start to the first sample read.
 **
 ** Algorithm:
 **
@@ -456,54 +567,373 @@ int32 MPU6050_InitTable(void)
 **=====================================================================================*/
 int32 MPU6050_InitDevice(void)
 {
-    int32 iStatus = CFE_SUCCESS;
-
-    g_MPU6050_AppData.FileID = open(g_MPU6050_AppData.ConfigTbl->devicePath, O_RDWR);
+    uint32 *phaseUsec = g_MPU6050_AppData.auiInitPhaseUsec;
+    uint64  startNsec = MPU6050_DiagNow();
+    uint64  phaseNsec;
+    int32   iStatus   = CFE_SUCCESS;
+
+    CFE_PSP_MemSet(phaseUsec, 0, sizeof(g_MPU6050_AppData.auiInitPhaseUsec));
+    g_MPU6050_AppData.uiWakeStartNsec = startNsec;
+
+    g_MPU6050_AppData.FileID = MPU6050_OpenDevice(g_MPU6050_AppData.ConfigTbl->devicePath,
+                                                  g_MPU6050_AppData.ConfigTbl->deviceI2CAddr);
+    phaseNsec = MPU6050_DiagNow();
+    phaseUsec[MPU6050_INIT_PHASE_OPEN] = (uint32) ((phaseNsec - startNsec) / 1000);
     if (g_MPU6050_AppData.FileID < 0)
     {
         iStatus = CFE_ES_RunStatus_APP_ERROR;
         perror("Failed to open bus path!");
-        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR, "MPU6050 - Failed to open bus path %s\n",
-                g_MPU6050_AppData.ConfigTbl->devicePath);
+        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Failed to open bus path %s at address 0x%02X\n",
+                g_MPU6050_AppData.ConfigTbl->devicePath, g_MPU6050_AppData.ConfigTbl->deviceI2CAddr);
         return iStatus;
     }
 
-    iStatus = ioctl(g_MPU6050_AppData.FileID, I2C_SLAVE, g_MPU6050_AppData.ConfigTbl->deviceI2CAddr);
-    if (iStatus < 0)
+    g_MPU6050_AppData.VariantPtr = MPU6050_DetectVariant(g_MPU6050_AppData.FileID,
+                                                         &g_MPU6050_AppData.HkTlm.ucWhoAmI);
+    phaseUsec[MPU6050_INIT_PHASE_IDENTIFY] = (uint32) ((MPU6050_DiagNow() - phaseNsec) / 1000);
+    if (g_MPU6050_AppData.VariantPtr == NULL)
+    {
+        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Unknown device on %s, WHO_AM_I 0x%02X",
+                g_MPU6050_AppData.ConfigTbl->devicePath, (unsigned int) g_MPU6050_AppData.HkTlm.ucWhoAmI);
+        g_MPU6050_AppData.VariantPtr = MPU6050_Variant_Default();
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    iStatus = MPU6050_DmpLoadImage();
+    if (iStatus != CFE_SUCCESS)
     {
-        iStatus = CFE_ES_RunStatus_APP_ERROR;
-        perror("ioctl");
-        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR, "MPU6050 - Ioctl failed to set slave address!\n");
         return iStatus;
     }
 
-    /* Wake device */
-    if(MPU6050_write8(g_MPU6050_AppData.FileID, RegPowerManagment1, 0) < 2)
+    /* Configured as the device is, in MPU6050_ConfigChannels */
+    MPU6050_Core_Init(&g_MPU6050_AppData.Core,
+            MPU6050_DmpDecimation() / MPU6050_GetSampleRateHz(g_MPU6050_AppData.ConfigTbl->sampleRateDiv,
+                                                              g_MPU6050_AppData.ConfigTbl->dlpfConfig), 1);
+
+    iStatus = MPU6050_ConfigDevice();
+    if (iStatus != CFE_SUCCESS)
     {
-        iStatus = CFE_ES_RunStatus_APP_ERROR;
-        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR, "MPU6050 - Failed to send wakeup command to device!\n");
         return iStatus;
     }
 
-    /* +/- 2g */
-    if(MPU6050_write8(g_MPU6050_AppData.FileID, RegAccelConfig, g_MPU6050_AppData.ConfigTbl->initialAccelScale) < 2)
+    CFE_EVS_SendEvent(MPU6050_INF_EID, CFE_EVS_EventType_INFORMATION,
+            "MPU6050 - %s on %s, WHO_AM_I 0x%02X, %u byte FIFO, ready in %u us with %s: "
+            "open %u, identify %u, configure %u, DMP %u, start %u, verify %u",
+            g_MPU6050_AppData.VariantPtr->pcName, g_MPU6050_AppData.ConfigTbl->devicePath,
+            (unsigned int) g_MPU6050_AppData.HkTlm.ucWhoAmI, (unsigned int) g_MPU6050_AppData.VariantPtr->usFifoBytes,
+            (unsigned int) ((MPU6050_DiagNow() - startNsec) / 1000),
+            MPU6050_BusBatched(g_MPU6050_AppData.FileID) ? "I2C_RDWR batches" : "single transfers",
+            (unsigned int) phaseUsec[MPU6050_INIT_PHASE_OPEN], (unsigned int) phaseUsec[MPU6050_INIT_PHASE_IDENTIFY],
+            (unsigned int) phaseUsec[MPU6050_INIT_PHASE_CONFIG], (unsigned int) phaseUsec[MPU6050_INIT_PHASE_DMP],
+            (unsigned int) phaseUsec[MPU6050_INIT_PHASE_START], (unsigned int) phaseUsec[MPU6050_INIT_PHASE_VERIFY]);
+
+    return iStatus;
+}
+
+/*=====================================================================================
+** Name: MPU6050_ConfigDevice
+**
+** Purpose: To wake the device and program its scales, sample rate and FIFO from the
+**          configuration table
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    int32 iStatus - Status of configuration
+**
+** Routines Called:
+**    MPU6050_DiagNow
+**    MPU6050_RegListAdd
+**    MPU6050_SampleRateWrites
+**    MPU6050_WriteRegs
+**    MPU6050_DmpStart
+**    MPU6050_FifoResetWrites
+**    MPU6050_ConfigChannels
+**    MPU6050_VerifyRegs
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_InitDevice
+**    MPU6050_RestartDevice
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl
+**    g_MPU6050_AppData.FileID
+**    g_MPU6050_AppData.VariantPtr
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.ucChannelMask
+**    g_MPU6050_AppData.bDmpOn
+**    g_MPU6050_AppData.auiInitPhaseUsec
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The sample rate and DLPF are programmed before the FIFO is enabled so that
+**    every queued sample is taken at the configured output data rate.
+** 2: Leaves the device active with the table's channels; see MPU6050_ConfigChannels.
+** 3: A loaded DMP image is written once the device is awake and the sample rate set,
+**    and the FIFO reset starts the DMP with it.
+** 4: The table's settings become two register lists, each written in one batch (a
+**    single I2C_RDWR on I2C): the wake-up, rate and scales, then after the DMP the
+**    FIFO reset and channels.  Both are then read back in one more batch with
+**    WHO_AM_I, so a register the device did not take stops the init here rather
+**    than show up as bad data.
+** 5: Each phase is timed in auiInitPhaseUsec, for the init event.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_ConfigDevice(void)
+{
+    uint32           *phaseUsec = g_MPU6050_AppData.auiInitPhaseUsec;
+    MPU6050_RegList_t lists[2];
+    uint64            startNsec;
+    uint8             badReg;
+    uint8             readVal;
+    uint8             expectVal;
+    int32             iStatus = CFE_SUCCESS;
+
+    CFE_PSP_MemSet(lists, 0, sizeof(lists));
+
+    /* Wake device, then the sample rate, DLPF and scales (+/- 2g, +/- 250 deg/s) */
+    startNsec = MPU6050_DiagNow();
+    MPU6050_RegListAdd(&lists[0], RegPowerManagment1, 0);
+    MPU6050_SampleRateWrites(&lists[0], g_MPU6050_AppData.VariantPtr,
+                             g_MPU6050_AppData.ConfigTbl->sampleRateDiv, g_MPU6050_AppData.ConfigTbl->dlpfConfig);
+    MPU6050_RegListAdd(&lists[0], RegGyroConfig, g_MPU6050_AppData.ConfigTbl->initialGyroScale);
+    MPU6050_RegListAdd(&lists[0], RegAccelConfig, g_MPU6050_AppData.ConfigTbl->initialAccelScale);
+
+    iStatus = MPU6050_WriteRegs(g_MPU6050_AppData.FileID, &lists[0]);
+    phaseUsec[MPU6050_INIT_PHASE_CONFIG] = (uint32) ((MPU6050_DiagNow() - startNsec) / 1000);
+    if (iStatus != 0)
     {
         iStatus = CFE_ES_RunStatus_APP_ERROR;
         CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR,
-                "MPU6050 - Failed to set accelerometer sensitivity!\n");
+                "MPU6050 - Failed to wake the device and set its sample rate and sensitivity!\n");
+        return iStatus;
+    }
+
+    startNsec = MPU6050_DiagNow();
+    iStatus = MPU6050_DmpStart();
+    phaseUsec[MPU6050_INIT_PHASE_DMP] = (uint32) ((MPU6050_DiagNow() - startNsec) / 1000);
+    if (iStatus != CFE_SUCCESS)
+    {
         return iStatus;
     }
 
-    /* +/- 250 deg/s */
-    if(MPU6050_write8(g_MPU6050_AppData.FileID, RegGyroConfig, g_MPU6050_AppData.ConfigTbl->initialGyroScale) < 2)
+    /* Enable the FIFO, then standby for the axes not sampled and FIFO_EN for the ones
+       that are */
+    startNsec = MPU6050_DiagNow();
+    if (g_MPU6050_AppData.ConfigTbl->useFifo)
+    {
+        MPU6050_FifoResetWrites(&lists[1], g_MPU6050_AppData.bDmpOn);
+    }
+    iStatus = MPU6050_ConfigChannels(MPU6050_POWER_ACTIVE, 0, &lists[1]);
+    phaseUsec[MPU6050_INIT_PHASE_START] = (uint32) ((MPU6050_DiagNow() - startNsec) / 1000);
+    if (iStatus != CFE_SUCCESS)
     {
-        iStatus = CFE_ES_RunStatus_APP_ERROR;
-        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR,
-                "MPU6050 - Failed to set gyro sensitivity!\n");
         return iStatus;
     }
 
-    return iStatus;
+    startNsec = MPU6050_DiagNow();
+    iStatus = MPU6050_VerifyRegs(g_MPU6050_AppData.FileID, lists, 2, g_MPU6050_AppData.VariantPtr->ucWhoAmI,
+                                 &badReg, &readVal, &expectVal);
+    phaseUsec[MPU6050_INIT_PHASE_VERIFY] = (uint32) ((MPU6050_DiagNow() - startNsec) / 1000);
+    if (iStatus != 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Register 0x%02X reads 0x%02X after init, expected 0x%02X",
+                (unsigned int) badReg, (unsigned int) readVal, (unsigned int) expectVal);
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_ConfigChannels
+**
+** Purpose: To sample the channels the table enables and the power state allows, and to
+**          put the other axes in standby
+**
+** Arguments:
+**    uint8 State                - MPU6050_POWER_* the device is being put in
+**    uint8 WakeRate             - LPWake* code, used by MPU6050_POWER_CYCLE
+**    MPU6050_RegList_t *ListPtr - Writes to send ahead of the channels', and on return
+**                                 all that were sent; NULL for none
+**
+** Returns:
+**    int32 iStatus - Status of configuration
+**
+** Routines Called:
+**    MPU6050_StandbyBits
+**    MPU6050_FifoChannels
+**    MPU6050_FifoEnableBits
+**    MPU6050_ChannelCnt
+**    MPU6050_Dmp_Channels
+**    MPU6050_Dmp_PacketBytes
+**    MPU6050_RegListAdd
+**    MPU6050_WriteRegs
+**    MPU6050_ConfigureCore
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_ConfigDevice
+**    MPU6050_SetPowerState
+**    MPU6050_ProcessSendHk
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->axisEnable
+**    g_MPU6050_AppData.ConfigTbl->useFifo
+**    g_MPU6050_AppData.ConfigTbl->rateProfiles
+**    g_MPU6050_AppData.FileID
+**    g_MPU6050_AppData.VariantPtr
+**    g_MPU6050_AppData.ucRateProfile
+**    g_MPU6050_AppData.bDmpOn
+**    g_MPU6050_AppData.ucDmpFeatures
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.ucChannelMask
+**    g_MPU6050_AppData.ucAxisEnable
+**    g_MPU6050_AppData.ucFifoChannels
+**    g_MPU6050_AppData.ucFifoSampleBytes
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Writes PWR_MGMT_2, FIFO_EN and then PWR_MGMT_1, which also carries the cycle and
+**    sleep bits of the state.  The temperature sensor is disabled when not sampled.
+** 2: FIFO_EN has one bit for the three accel axes, so the FIFO queues all of them
+**    if any is enabled; MPU6050_ReadDevice drops the ones in standby.
+** 3: Gyro standby and cycle mode idle the gyros, cycle mode the temperature sensor
+**    too.  A state that leaves no channel to sample is refused before any write.
+** 4: Callers flush the streams first; entry sizes follow the channel mask.
+** 5: While the DMP runs it alone writes the FIFO, so FIFO_EN stays 0 and the channels
+**    are those its packets carry.  Its packets leave out the temperature.
+** 6: The MPU-6500 family sets the cycle rate in LP_ACCEL_ODR rather than PWR_MGMT_2,
+**    and wants its accelerometer DLPF at 1 while cycling.  Otherwise that DLPF is
+**    kept at the rate profile's, as MPU6050_SetSampleRate left it.
+** 7: The writes go out in one batch with those already in ListPtr, so that
+**    MPU6050_ConfigDevice can send a FIFO reset with them and read all of them back.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_ConfigChannels(uint8 State, uint8 WakeRate, MPU6050_RegList_t *ListPtr)
+{
+    const MPU6050_Variant_t *variantPtr = g_MPU6050_AppData.VariantPtr;
+    MPU6050_RegList_t list = {0};
+    uint8 axisEnable = g_MPU6050_AppData.ConfigTbl->axisEnable & MPU6050_CHAN_ALL;
+    uint8 channels   = axisEnable;
+    uint8 pwrMgmt1   = 0;
+    uint8 pwrMgmt2   = 0;
+    uint8 fifoEnable = 0;
+    uint8 accelDlpf  = g_MPU6050_AppData.ConfigTbl->dlpfConfig;
+
+    switch (State)
+    {
+        case MPU6050_POWER_GYRO_STANDBY:
+            channels &= ~MPU6050_CHAN_GYRO;
+            break;
+
+        case MPU6050_POWER_CYCLE:
+            channels &= MPU6050_CHAN_ACCEL;
+            pwrMgmt1  = 1 << PwrMgmt1Cycle;
+            if (variantPtr->ucRegLpAccelOdr == 0)
+            {
+                pwrMgmt2 = variantPtr->aucWakeCode[WakeRate] << PwrMgmt2LPWakeCtrl;
+            }
+            break;
+
+        case MPU6050_POWER_SLEEP:
+            pwrMgmt1  = 1 << PwrMgmt1Sleep;
+            break;
+
+        default:
+            break;
+    }
+
+    if (channels == 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - No channel of mask 0x%02X left to sample in power state %u",
+                (unsigned int) axisEnable, (unsigned int) State);
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    pwrMgmt2 |= MPU6050_StandbyBits(channels);
+    if (!(channels & MPU6050_CHAN_TEMP))
+    {
+        pwrMgmt1 |= 1 << PwrMgmt1Temp_dis;
+    }
+
+    /* Cycle mode reads the data registers; nothing should pile up in the FIFO */
+    if (g_MPU6050_AppData.ConfigTbl->useFifo && State != MPU6050_POWER_CYCLE && !g_MPU6050_AppData.bDmpOn)
+    {
+        fifoEnable = MPU6050_FifoEnableBits(channels);
+    }
+
+    /* An accelerometer DLPF of its own follows the rate profile, except in cycle mode */
+    if (State == MPU6050_POWER_CYCLE)
+    {
+        accelDlpf = 1;
+    }
+    else if (g_MPU6050_AppData.ucRateProfile != MPU6050_RATE_PROFILE_FIXED)
+    {
+        accelDlpf = g_MPU6050_AppData.ConfigTbl->rateProfiles[g_MPU6050_AppData.ucRateProfile].dlpfConfig;
+    }
+
+    if (ListPtr == NULL)
+    {
+        ListPtr = &list;
+    }
+
+    MPU6050_RegListAdd(ListPtr, RegPowerManagment2, pwrMgmt2);
+    MPU6050_RegListAdd(ListPtr, RegFifoEnable, fifoEnable);
+    if (variantPtr->ucRegLpAccelOdr != 0)
+    {
+        MPU6050_RegListAdd(ListPtr, variantPtr->ucRegLpAccelOdr, variantPtr->aucWakeCode[WakeRate]);
+    }
+    if (variantPtr->ucRegAccelConfig2 != 0)
+    {
+        MPU6050_RegListAdd(ListPtr, variantPtr->ucRegAccelConfig2, accelDlpf << AccelConfig2Dlpf);
+    }
+    MPU6050_RegListAdd(ListPtr, RegPowerManagment1, pwrMgmt1);
+
+    if (MPU6050_WriteRegs(g_MPU6050_AppData.FileID, ListPtr) != 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Failed to set channels 0x%02X in power state %u",
+                (unsigned int) channels, (unsigned int) State);
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    g_MPU6050_AppData.ucAxisEnable = g_MPU6050_AppData.ConfigTbl->axisEnable;
+    if (g_MPU6050_AppData.bDmpOn)
+    {
+        channels &= MPU6050_Dmp_Channels(g_MPU6050_AppData.ucDmpFeatures);
+        g_MPU6050_AppData.ucChannelMask     = channels;
+        g_MPU6050_AppData.ucFifoChannels    = channels;
+        g_MPU6050_AppData.ucFifoSampleBytes = (uint8) MPU6050_Dmp_PacketBytes(g_MPU6050_AppData.ucDmpFeatures);
+    }
+    else
+    {
+        g_MPU6050_AppData.ucChannelMask     = channels;
+        g_MPU6050_AppData.ucFifoChannels    = MPU6050_FifoChannels(channels);
+        g_MPU6050_AppData.ucFifoSampleBytes = (uint8) (MPU6050_ChannelCnt(g_MPU6050_AppData.ucFifoChannels) *
+                                                       MPU6050_CHANNEL_BYTES);
+    }
+    MPU6050_ConfigureCore();
+
+    return CFE_SUCCESS;
 }
 
 /*=====================================================================================
@@ -524,6 +954,15 @@ int32 MPU6050_InitDevice(void)
 **    MPU6050_InitEvent
 **    MPU6050_InitPipe
 **    MPU6050_InitData
+**    MPU6050_InitTable
+**    MPU6050_InitDevice
+**    MPU6050_InitRateProfiles
+**    MPU6050_SetPowerState
+**    MPU6050_InitStreams
+**    MPU6050_InitFusion
+**    MPU6050_RecorderOpen
+**    MPU6050_InitSched
+**    MPU6050_InitRealtime
 **
 ** Called By:
 **    MPU6050_AppMain
@@ -589,6 +1028,66 @@ int32 MPU6050_InitApp()
         return iStatus;
     }
 
+    /* Start adaptive sampling, if the table asks for it */
+    iStatus = MPU6050_InitRateProfiles();
+    if (iStatus != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MPU6050_INIT_ERR_EID, CFE_EVS_EventType_ERROR, "InitRateProfiles failed");
+        return iStatus;
+    }
+
+    /* Start in the table's power state */
+    if (g_MPU6050_AppData.ConfigTbl->powerState != MPU6050_POWER_ACTIVE)
+    {
+        iStatus = MPU6050_SetPowerState(g_MPU6050_AppData.ConfigTbl->powerState,
+                                        g_MPU6050_AppData.ConfigTbl->cycleWakeRate);
+        if (iStatus != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(MPU6050_INIT_ERR_EID, CFE_EVS_EventType_ERROR, "SetPowerState failed");
+            return iStatus;
+        }
+    }
+
+    /* Schedule the output streams in the table */
+    iStatus = MPU6050_InitStreams();
+    if (iStatus != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MPU6050_INIT_ERR_EID, CFE_EVS_EventType_ERROR, "InitStreams failed");
+        return iStatus;
+    }
+
+    /* Subscribe to the devices fused with this one, if a stream publishes them */
+    iStatus = MPU6050_InitFusion();
+    if (iStatus != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MPU6050_INIT_ERR_EID, CFE_EVS_EventType_ERROR, "InitFusion failed");
+        return iStatus;
+    }
+
+    /* Map the onboard recorder and find where it left off */
+    iStatus = MPU6050_RecorderOpen();
+    if (iStatus != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MPU6050_INIT_ERR_EID, CFE_EVS_EventType_ERROR, "RecorderOpen failed");
+        return iStatus;
+    }
+
+    /* Pace device reads on the acquisition timer */
+    iStatus = MPU6050_InitSched();
+    if (iStatus != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MPU6050_INIT_ERR_EID, CFE_EVS_EventType_ERROR, "InitSched failed");
+        return iStatus;
+    }
+
+    /* Raise, pin and lock the task that reads the device */
+    iStatus = MPU6050_InitRealtime();
+    if (iStatus != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MPU6050_INIT_ERR_EID, CFE_EVS_EventType_ERROR, "InitRealtime failed");
+        return iStatus;
+    }
+
     /* Install the cleanup callback */
     OS_TaskInstallDeleteHandler(MPU6050_CleanupCallback);
 
@@ -640,11 +1139,16 @@ void MPU6050_CleanupCallback()
 {
     /* TODO:  Add code to cleanup memory and other cleanup here */
     CFE_ES_WriteToSysLog("MPU6050 - Cleanup Callback\n");
+    MPU6050_Capture_Stop();
     if (g_MPU6050_AppData.FileID >= 0)
     {
-        close(g_MPU6050_AppData.FileID);
+        MPU6050_CloseDevice(g_MPU6050_AppData.FileID);
         g_MPU6050_AppData.FileID = -1;
     }
+    /* Packets still being collected in SB buffers are ours to give back */
+    MPU6050_CleanupStreams();
+    MPU6050_RecorderClose();
+    MPU6050_Sched_Stop(&g_MPU6050_AppData.Sched);
 }
 
 /*=====================================================================================
@@ -657,18 +1161,39 @@ void MPU6050_CleanupCallback()
 ** Returns: void
 **
 ** Routines Called:
+**     MPU6050_read8
 **     MPU6050_read16
+**     MPU6050_ReadArbitrary
+**     MPU6050_RegisterSpan
+**     MPU6050_UnpackSample
+**     MPU6050_Dmp_Unpack
+**     MPU6050_ResetFifo
+**     MPU6050_BusTimeNsec
+**     MPU6050_Core_TimeRead
+**     MPU6050_Core_Convert
+**     MPU6050_Core_SampleTime
+**     MPU6050_StreamContentUsed
+**     MPU6050_DiagNow
 **     CFE_TIME_GetTime
 **
 ** Called By:
 **    MPU6050_RcvMsg
+**    MPU6050_WaitTick
 **
 ** Global Inputs/Reads:
 **    g_MPU6050_AppData.FileID
-**    g_MPU6050_AppData.ConfigTbl->initialAccelScale
-**    g_MPU6050_AppData.ConfigTbl->initialGyroScale
+**    g_MPU6050_AppData.ConfigTbl->useFifo
+**    g_MPU6050_AppData.ucPowerState
+**    g_MPU6050_AppData.ucChannelMask
+**    g_MPU6050_AppData.ucFifoChannels
+**    g_MPU6050_AppData.ucFifoSampleBytes
+**    g_MPU6050_AppData.bDmpOn
+**    g_MPU6050_AppData.ucDmpFeatures
+**    g_MPU6050_AppData.VariantPtr->usFifoBytes
 **
 ** Global Outputs/Writes:
+**    g_MPU6050_AppData.InData
+**    g_MPU6050_AppData.Core.TimeModel
 **    g_MPU6050_AppData.OutData.gyroXDegsSec
 **    g_MPU6050_AppData.OutData.gyroYDegsSec
 **    g_MPU6050_AppData.OutData.gyroZDegsSec
@@ -676,8 +1201,34 @@ void MPU6050_CleanupCallback()
 **    g_MPU6050_AppData.OutData.accelYGees
 **    g_MPU6050_AppData.OutData.accelZGees
 **    g_MPU6050_AppData.OutData.timeTag
+**    g_MPU6050_AppData.OutData.uiAcqTimeNsec
+**    g_MPU6050_AppData.OutData.ucRateProfile
+**    g_MPU6050_AppData.HkTlm.uiFifoOverflowCnt
+**    g_MPU6050_AppData.HkTlm.uiDmpPacketErrCnt
+**    g_MPU6050_AppData.HkTlm.uiWakeLatencyUsec
+**    g_MPU6050_AppData.HkTlm.uiWakeLatencyMaxUsec
+**    g_MPU6050_AppData.uiWakeStartNsec
 **
 ** Limitations, Assumptions, External Events, and Notes:
+** 1: In FIFO mode the read time is taken right after the FIFO count is read, since
+**    that is the instant the set of drained samples is fixed.  The time it takes to
+**    transfer the samples does not enter the timing model.
+** 2: OutData carries the newest sample only; the rest stay in InData.  It is only
+**    converted when a latest sample or attitude stream is configured.
+** 3: Nothing is read while the device sleeps.  In cycle mode the data registers are
+**    read once DATA_RDY says a wake-up latched a new sample, and with the FIFO
+**    enabled that sample is still timed by the time model.
+** 4: Only the channels being sampled cross the bus: the FIFO queues just those
+**    (all three accel axes if any is), and a polled read bursts the shortest run of
+**    data registers covering them.  Channels not sampled are left 0 in InData.
+** 5: The read time is when that bus transfer completed, as the bus driver saw it, so
+**    a replayed capture is timed as it was recorded.
+** 6: While the DMP runs the FIFO holds its packets, each decoded into a sample and a
+**    quaternion.  A packet that does not decode means the read is out of step with
+**    the FIFO; it is reset and the read dropped, as on an overflow.
+** 7: A FIFO count larger than the device's FIFO can only come from a failed count
+**    read.  It is treated the same way, so no more is ever read than sampleData
+**    and InData hold.
 **
 ** Algorithm:
 **
@@ -692,123 +1243,468 @@ void MPU6050_ReadDevice(void)
      * TODO: read from configuration registers to make scaling dynamic.
      * Read all values at once to reduce jitter. */
 
-    // float readingAccelX = ((float) (int16) MPU6050_read16(g_MPU6050_AppData.FileID, RegAccelX)) / 65535.0;
-    // float readingAccelY = ((float) (int16) MPU6050_read16(g_MPU6050_AppData.FileID, RegAccelY)) / 65535.0;
-    // float readingAccelZ = ((float) (int16) MPU6050_read16(g_MPU6050_AppData.FileID, RegAccelZ)) / 65535.0;
-    // float readingGyroX  = ((float) (int16) MPU6050_read16(g_MPU6050_AppData.FileID, RegGyroX))  / 65535.0;
-    // float readingGyroY  = ((float) (int16) MPU6050_read16(g_MPU6050_AppData.FileID, RegGyroY))  / 65535.0;
-    // float readingGyroZ  = ((float) (int16) MPU6050_read16(g_MPU6050_AppData.FileID, RegGyroZ))  / 65535.0;
+    MPU6050_InData_t *inData = &g_MPU6050_AppData.InData;
+    MPU6050_Sample_t  newest;
+    uint8  sampleData[MPU6050_FIFO_SIZE];
+    uint8  powerState  = g_MPU6050_AppData.ucPowerState;
+    uint8  channels    = g_MPU6050_AppData.ucChannelMask;
+    uint8  present     = g_MPU6050_AppData.ucFifoChannels;
+    uint32 sampleBytes = g_MPU6050_AppData.ucFifoSampleBytes;
+    uint32 sampleCnt   = 1;
+    uint32 bytesRead   = 0;
+    uint32 fifoBytes;
+    uint32 wakeUsec;
+    uint32 i;
+
+    inData->uiSampleCnt = 0;
+
+    /* No bus traffic at all while asleep */
+    if (powerState == MPU6050_POWER_SLEEP)
+    {
+        return;
+    }
+
+    if (g_MPU6050_AppData.ConfigTbl->useFifo && powerState != MPU6050_POWER_CYCLE)
+    {
+        /* An overflow drops samples, which breaks the sample count the time model relies on */
+        if (MPU6050_read8(g_MPU6050_AppData.FileID, RegIntStatus) & (1 << IntStatusFifoOflow))
+        {
+            MPU6050_ResetFifo(g_MPU6050_AppData.FileID, g_MPU6050_AppData.bDmpOn);
+            MPU6050_TimeModel_Resync(&g_MPU6050_AppData.Core.TimeModel);
+            g_MPU6050_AppData.HkTlm.uiFifoOverflowCnt++;
+            MPU6050_TRACE_EVENT(&g_MPU6050_AppData.TraceRing, MPU6050_TRACE_FIFO_OFLOW);
+            return;
+        }
+
+        fifoBytes = MPU6050_read16(g_MPU6050_AppData.FileID, RegFifoCount);
+        inData->dReadTime   = MPU6050_BusTimeNsec() * 1e-9;
+        inData->readTimeTag = CFE_TIME_GetTime();
+
+        /* More than the FIFO holds is a bad count read, not data; restart from empty */
+        if (fifoBytes > g_MPU6050_AppData.VariantPtr->usFifoBytes)
+        {
+            MPU6050_ResetFifo(g_MPU6050_AppData.FileID, g_MPU6050_AppData.bDmpOn);
+            MPU6050_TimeModel_Resync(&g_MPU6050_AppData.Core.TimeModel);
+            CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "FIFO count %u exceeds the %u byte FIFO, FIFO reset",
+                              (unsigned int) fifoBytes, (unsigned int) g_MPU6050_AppData.VariantPtr->usFifoBytes);
+            return;
+        }
+
+        sampleCnt = fifoBytes / sampleBytes;
+        if (sampleCnt == 0)
+        {
+            return;
+        }
 
-    uint8 gyroData[6];
-    uint8 accelData[6];
-    uint32 bytesRead = 0;
+        /* The rest stays queued for the next read */
+        if (sampleCnt > sizeof(sampleData) / sampleBytes)
+        {
+            sampleCnt = sizeof(sampleData) / sampleBytes;
+        }
+        if (sampleCnt > MPU6050_FIFO_MAX_SAMPLES)
+        {
+            sampleCnt = MPU6050_FIFO_MAX_SAMPLES;
+        }
 
-    bytesRead = MPU6050_ReadArbitrary(g_MPU6050_AppData.FileID, RegGyroX, gyroData, sizeof(gyroData));
-    if (bytesRead <= 0)
+        bytesRead = MPU6050_ReadArbitrary(g_MPU6050_AppData.FileID, RegFifoRW,
+                                          sampleData, sampleCnt * sampleBytes);
+    }
+    else
     {
-        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR, "Failed to read gyros!");
+        /* Reading DATA_RDY clears it, so each wake-up is read once */
+        if (powerState == MPU6050_POWER_CYCLE &&
+            !(MPU6050_read8(g_MPU6050_AppData.FileID, RegIntStatus) & (1 << IntStatusDataRdy)))
+        {
+            return;
+        }
+
+        present     = MPU6050_RegisterSpan(channels);
+        sampleBytes = MPU6050_ChannelCnt(present) * MPU6050_CHANNEL_BYTES;
+        bytesRead   = MPU6050_ReadArbitrary(g_MPU6050_AppData.FileID,
+                                            RegAccelX + MPU6050_CHANNEL_BYTES * __builtin_ctz(present),
+                                            sampleData, sampleBytes);
+        inData->dReadTime   = MPU6050_BusTimeNsec() * 1e-9;
+        inData->readTimeTag = CFE_TIME_GetTime();
     }
 
-    bytesRead = MPU6050_ReadArbitrary(g_MPU6050_AppData.FileID, RegAccelX, accelData, sizeof(accelData));
-    if (bytesRead <= 0)
+    if (bytesRead != sampleCnt * sampleBytes)
     {
-        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR, "Failed to read accelerometers!");
+        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR, "Failed to read samples!");
+        return;
     }
 
-    float readingAccelX = (float) ((int16) (accelData[0] << 8) | accelData[1]) / 65535.0;
-    float readingAccelY = (float) ((int16) (accelData[2] << 8) | accelData[3]) / 65535.0;
-    float readingAccelZ = (float) ((int16) (accelData[4] << 8) | accelData[5]) / 65535.0;
+    if (g_MPU6050_AppData.bDmpOn)
+    {
+        for (i = 0; i < sampleCnt; i++)
+        {
+            if (!MPU6050_Dmp_Unpack(&sampleData[i * sampleBytes], g_MPU6050_AppData.ucDmpFeatures,
+                                    &inData->Quats[i], &inData->Samples[i]))
+            {
+                MPU6050_ResetFifo(g_MPU6050_AppData.FileID, true);
+                MPU6050_TimeModel_Resync(&g_MPU6050_AppData.Core.TimeModel);
+                g_MPU6050_AppData.HkTlm.uiDmpPacketErrCnt++;
+                return;
+            }
+        }
+    }
+    else
+    {
+        for (i = 0; i < sampleCnt; i++)
+        {
+            MPU6050_UnpackSample(&sampleData[i * sampleBytes], present, channels, &inData->Samples[i]);
+        }
+    }
 
-    float readingGyroX  = (float) ((int16) (gyroData[0] << 8) | gyroData[1]) / 65535.0;
-    float readingGyroY  = (float) ((int16) (gyroData[2] << 8) | gyroData[3]) / 65535.0;
-    float readingGyroZ  = (float) ((int16) (gyroData[4] << 8) | gyroData[5]) / 65535.0;
+    inData->uiSampleCnt = sampleCnt;
 
-    float geeScale  = 1.0;
-    float rateScale = 1.0;
+    /* First sample since leaving sleep or cycle mode */
+    if (g_MPU6050_AppData.uiWakeStartNsec != 0)
+    {
+        wakeUsec = (uint32) ((MPU6050_DiagNow() - g_MPU6050_AppData.uiWakeStartNsec) / 1000);
+        g_MPU6050_AppData.HkTlm.uiWakeLatencyUsec = wakeUsec;
+        if (wakeUsec > g_MPU6050_AppData.HkTlm.uiWakeLatencyMaxUsec)
+        {
+            g_MPU6050_AppData.HkTlm.uiWakeLatencyMaxUsec = wakeUsec;
+        }
+        g_MPU6050_AppData.uiWakeStartNsec = 0;
+    }
 
-    switch (g_MPU6050_AppData.ConfigTbl->initialAccelScale)
+    MPU6050_TRACE_DEBUG(&g_MPU6050_AppData.TraceRing, MPU6050_TRACE_READ, sampleCnt);
+    if (g_MPU6050_AppData.ConfigTbl->useFifo)
     {
-        case MPU6050_ACCELSCALE_2G:
-            geeScale = 2.0;
-            break;
-        case MPU6050_ACCELSCALE_4G:
-            geeScale = 4.0;
-            break;
-        case MPU6050_ACCELSCALE_8G:
-            geeScale = 8.0;
-            break;
-        case MPU6050_ACCELSCALE_16G:
-            geeScale = 16.0;
-            break;
-        default:
-            CFE_EVS_SendEvent(MPU6050_ERR_EID, CFE_EVS_EventType_ERROR, "Could not determine accelerometer scale!");
-            break;
+        inData->uiFirstSampleIdx = MPU6050_Core_TimeRead(&g_MPU6050_AppData.Core, sampleCnt, inData->dReadTime);
     }
 
-    switch (g_MPU6050_AppData.ConfigTbl->initialGyroScale)
+    /* The newest sample only feeds the once per cycle streams */
+    if (!MPU6050_StreamContentUsed(MPU6050_STREAM_LATEST) && !MPU6050_StreamContentUsed(MPU6050_STREAM_ATTITUDE))
     {
-        case MPU6050_GYROSCALE_250DPS:
-            rateScale = 250.0;
-            break;
-        case MPU6050_GYROSCALE_500DPS:
-            rateScale = 500.0;
-            break;
-        case MPU6050_GYROSCALE_1000DPS:
-            rateScale = 1000.0;
-            break;
-        case MPU6050_GYROSCALE_2000DPS:
-            rateScale = 2000.0;
-            break;
-        default:
-            CFE_EVS_SendEvent(MPU6050_ERR_EID, CFE_EVS_EventType_ERROR, "Could not determine gyroscope scale!");
-            break;
+        return;
     }
 
+    MPU6050_Core_Convert(&g_MPU6050_AppData.Core, &inData->Samples[sampleCnt - 1], &newest);
 
-    g_MPU6050_AppData.OutData.gyroXDegsSec = rateScale * readingGyroX;
-    g_MPU6050_AppData.OutData.gyroYDegsSec = rateScale * readingGyroY;
-    g_MPU6050_AppData.OutData.gyroZDegsSec = rateScale * readingGyroZ;
-    g_MPU6050_AppData.OutData.accelXGees   = geeScale  * readingAccelX;
-    g_MPU6050_AppData.OutData.accelYGees   = geeScale  * readingAccelY;
-    g_MPU6050_AppData.OutData.accelZGees   = geeScale  * readingAccelZ;
+    g_MPU6050_AppData.OutData.gyroXDegsSec = newest.gyroXDegsSec;
+    g_MPU6050_AppData.OutData.gyroYDegsSec = newest.gyroYDegsSec;
+    g_MPU6050_AppData.OutData.gyroZDegsSec = newest.gyroZDegsSec;
+    g_MPU6050_AppData.OutData.accelXGees   = newest.accelXGees;
+    g_MPU6050_AppData.OutData.accelYGees   = newest.accelYGees;
+    g_MPU6050_AppData.OutData.accelZGees   = newest.accelZGees;
 
-    g_MPU6050_AppData.OutData.timeTag      = CFE_TIME_GetTime();
+    g_MPU6050_AppData.OutData.timeTag      = MPU6050_GetSampleTime(sampleCnt - 1);
+    g_MPU6050_AppData.OutData.ucRateProfile = g_MPU6050_AppData.ucRateProfile;
 
-    // OS_printf("%f\t%f\t%f\t%f\t%f\t%f\n", readingAccelX, readingAccelY, readingAccelZ, readingGyroX, readingGyroY, readingGyroZ);
+    /* Polled reads return whatever the sensor latched last; the read time stands in */
+    if (g_MPU6050_AppData.ConfigTbl->useFifo)
+    {
+        g_MPU6050_AppData.OutData.uiAcqTimeNsec = (uint64) (MPU6050_Core_SampleTime(&g_MPU6050_AppData.Core,
+                                                            inData->uiFirstSampleIdx + sampleCnt - 1) * 1e9);
+    }
+    else
+    {
+        g_MPU6050_AppData.OutData.uiAcqTimeNsec = (uint64) (inData->dReadTime * 1e9);
+    }
 }
 
 /*=====================================================================================
-** Name: MPU6050_RcvMsg
+** Name: MPU6050_ConfigureCore
 **
-** Purpose: To receive and process messages for MPU6050 application
+** Purpose: To give the processing core the channels, full scale ranges and
+**          calibration samples are converted with
 **
 ** Arguments:
-**    int32 Timeout - The number of milliseconds to wait before timing out.
-**                      CFE_SB_PEND_FOREVER can be used to wait indefinitely for a message
+**    None
 **
 ** Returns:
-**    int32 iStatus - Status of initialization
+**    None
 **
 ** Routines Called:
-**    CFE_SB_RcvMsg
-**    CFE_MSG_GetMsgId
+**    MPU6050_Core_Configure
 **    CFE_EVS_SendEvent
-**    CFE_ES_PerfLogEntry
-**    CFE_ES_PerfLogExit
-**    MPU6050_ProcessNewCmds
+**
+** Called By:
+**    MPU6050_ConfigChannels
+**    MPU6050_ProcessSendHk
+**    MPU6050_ProcessNewAppCmds
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->initialAccelScale
+**    g_MPU6050_AppData.ConfigTbl->initialGyroScale
+**    g_MPU6050_AppData.ConfigTbl->calibration
+**    g_MPU6050_AppData.ucChannelMask
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Core
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Called whenever one of the inputs changes, so conversion itself does no lookups.
+**    An invalid scale code converts with a range of 1, as before.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_ConfigureCore(void)
+{
+    const MPU6050_ConfigTbl_t *cfgPtr = g_MPU6050_AppData.ConfigTbl;
+
+    if (MPU6050_Core_Configure(&g_MPU6050_AppData.Core, g_MPU6050_AppData.ucChannelMask,
+                               cfgPtr->initialAccelScale, cfgPtr->initialGyroScale,
+                               &cfgPtr->calibration) != 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Could not determine accelerometer or gyroscope scale (0x%02X, 0x%02X)!",
+                (unsigned int) cfgPtr->initialAccelScale, (unsigned int) cfgPtr->initialGyroScale);
+    }
+}
+
+/*=====================================================================================
+** Name: MPU6050_SetScale
+**
+** Purpose: To change the accelerometer or gyroscope full scale range
+**
+** Arguments:
+**    uint8 Reg   - RegAccelConfig or RegGyroConfig
+**    uint8 Scale - MPU6050_ACCELSCALE_* or MPU6050_GYROSCALE_* code for that register
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    MPU6050_FlushStreams
+**    MPU6050_write8
+**    MPU6050_ConfigureCore
+**    MPU6050_RestartSampling
+**
+** Called By:
+**    MPU6050_ProcessNewAppCmds
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.FileID
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.ConfigTbl->initialAccelScale
+**    g_MPU6050_AppData.ConfigTbl->initialGyroScale
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Batches and recorder blocks carry one scale code for all their samples, so the
+**    ones collected at the old range are sent first, labelled with it.
+** 2: Samples the FIFO latched at the old range are thrown away, as on a rate profile
+**    change, and the time model skips an index so the recorder starts a new block.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_SetScale(uint8 Reg, uint8 Scale)
+{
+    MPU6050_FlushStreams();
+
+    if (Reg == RegAccelConfig)
+    {
+        g_MPU6050_AppData.ConfigTbl->initialAccelScale = Scale;
+    }
+    else
+    {
+        g_MPU6050_AppData.ConfigTbl->initialGyroScale = Scale;
+    }
+
+    MPU6050_write8(g_MPU6050_AppData.FileID, Reg, Scale);
+    MPU6050_ConfigureCore();
+
+    /* New FIFO and a gap in the sample index, from the next period on */
+    MPU6050_RestartSampling();
+}
+
+/*=====================================================================================
+** Name: MPU6050_GetSampleTime
+**
+** Purpose: To give the CFE time at which a sample of the last device read was latched
+**
+** Arguments:
+**    uint32 SampleNum - Index into g_MPU6050_AppData.InData.Samples
+**
+** Returns:
+**    CFE_TIME_SysTime_t - Estimated latch time of the sample
+**
+** Routines Called:
+**    MPU6050_Core_SampleTime
+**    CFE_TIME_Add
+**    CFE_TIME_Subtract
+**
+** Called By:
+**    MPU6050_ReadDevice
+**    MPU6050_StreamNewData
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.InData
+**    g_MPU6050_AppData.Core.TimeModel
+**
+** Global Outputs/Writes:
+**    None
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The monotonic estimate is carried over to CFE time through the clock pair taken
+**    at the read, so only the short distance between the read and the sample is
+**    subject to the difference between the two clocks.
+** 2: Without the FIFO there is no sample count to fit, and the read time is returned.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+CFE_TIME_SysTime_t MPU6050_GetSampleTime(uint32 SampleNum)
+{
+    const MPU6050_InData_t *inData = &g_MPU6050_AppData.InData;
+    CFE_TIME_SysTime_t      delta;
+    double                  deltaSec;
+
+    if (!g_MPU6050_AppData.ConfigTbl->useFifo)
+    {
+        return inData->readTimeTag;
+    }
+
+    deltaSec = MPU6050_Core_SampleTime(&g_MPU6050_AppData.Core, inData->uiFirstSampleIdx + SampleNum)
+             - inData->dReadTime;
+
+    delta.Seconds    = (uint32) floor(fabs(deltaSec));
+    delta.Subseconds = CFE_TIME_Micro2SubSecs((uint32) ((fabs(deltaSec) - delta.Seconds) * 1e6));
+
+    if (deltaSec < 0.0)
+    {
+        return CFE_TIME_Subtract(inData->readTimeTag, delta);
+    }
+
+    return CFE_TIME_Add(inData->readTimeTag, delta);
+}
+
+/*=====================================================================================
+** Name: MPU6050_PropagateAttitude
+**
+** Purpose: To propagate the attitude through every sample of the last device read
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    MPU6050_Core_SampleTime
+**    MPU6050_Core_Convert
+**    MPU6050_Core_Propagate
+**
+** Called By:
+**    MPU6050_AppMain
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.InData
+**    g_MPU6050_AppData.ConfigTbl->useFifo
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Core
+**    g_MPU6050_AppData.dAttLastTime
+**    g_MPU6050_AppData.bAttHaveLast
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Each sample is integrated over the time model's interval from the one before,
+**    as mpu6050_replay does, so the two agree on a capture.
+** 2: The first sample after bAttHaveLast is cleared only seeds the time.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_PropagateAttitude(void)
+{
+    const MPU6050_InData_t *inData = &g_MPU6050_AppData.InData;
+    MPU6050_Sample_t        sample;
+    double                  sampleTime;
+    double                  dt       = 0.0;
+    double                  gyro[3];
+    double                  delta[3] = {0.0, 0.0, 0.0};
+    uint32                  i;
+
+    for (i = 0; i < inData->uiSampleCnt; i++)
+    {
+        /* Polled reads return whatever the sensor latched last; the read time stands in */
+        sampleTime = g_MPU6050_AppData.ConfigTbl->useFifo ?
+                     MPU6050_Core_SampleTime(&g_MPU6050_AppData.Core, inData->uiFirstSampleIdx + i) :
+                     inData->dReadTime;
+
+        if (g_MPU6050_AppData.bAttHaveLast && sampleTime > g_MPU6050_AppData.dAttLastTime)
+        {
+            MPU6050_Core_Convert(&g_MPU6050_AppData.Core, &inData->Samples[i], &sample);
+            gyro[0] = sample.gyroXDegsSec;
+            gyro[1] = sample.gyroYDegsSec;
+            gyro[2] = sample.gyroZDegsSec;
+
+            dt = sampleTime - g_MPU6050_AppData.dAttLastTime;
+            MPU6050_Core_Propagate(&g_MPU6050_AppData.Core, gyro, dt, delta);
+        }
+        g_MPU6050_AppData.dAttLastTime = sampleTime;
+        g_MPU6050_AppData.bAttHaveLast = true;
+    }
+
+    MPU6050_TRACE_DEBUG(&g_MPU6050_AppData.TraceRing, MPU6050_TRACE_ATTITUDE,
+            dt,
+            g_MPU6050_AppData.Core.Attitude.phi, g_MPU6050_AppData.Core.Attitude.theta,
+            g_MPU6050_AppData.Core.Attitude.psi,
+            delta[0], delta[1], delta[2]);
+}
+
+/*=====================================================================================
+** Name: MPU6050_RcvMsg
+**
+** Purpose: To receive and process messages for MPU6050 application
+**
+** Arguments:
+**    int32 Timeout - The number of milliseconds to wait before timing out.
+**                      CFE_SB_PEND_FOREVER can be used to wait indefinitely for a message
+**
+** Returns:
+**    int32 iStatus - Status of initialization
+**
+** Routines Called:
+**    CFE_SB_RcvMsg
+**    CFE_MSG_GetMsgId
+**    CFE_EVS_SendEvent
+**    CFE_ES_PerfLogEntry
+**    CFE_ES_PerfLogExit
+**    MPU6050_ProcessNewCmds
 **    MPU6050_ProcessNewData
-**    MPU6050_SendOutData
+**    MPU6050_ReadDevice
+**    MPU6050_StageBegin
+**    MPU6050_StageEnd
+**    MPU6050_Jitter_Add
+**    MPU6050_Dispatch
 **
 ** Called By:
 **    MPU6050_Main
 **
 ** Global Inputs/Reads:
 **    g_MPU6050_AppData.SchPipeId
+**    g_MPU6050_AppData.DispatchPipeId
 **
 ** Global Outputs/Writes:
 **    g_MPU6050_AppData.uiRunStatus
+**    g_MPU6050_AppData.uiSbRcvCnt
 **
 ** Limitations, Assumptions, External Events, and Notes:
+** 1: With MPU6050_DISPATCH_SINGLE_PIPE the wait is on the dispatch pipe, and what
+**    arrives goes to MPU6050_Dispatch.
 **
 ** Algorithm:
 **
@@ -817,20 +1713,40 @@ void MPU6050_ReadDevice(void)
 ** History:  Date Written  2019-10-22
 **           Unit Tested   yyyy-mm-dd
 **=====================================================================================*/
-int32 jPU6050_RcvMsg(int32 Timeout)
+int32 MPU6050_RcvMsg(int32 Timeout)
 {
     int32           iStatus = CFE_SUCCESS;
     CFE_SB_Buffer_t *MsgPtr = NULL;
     CFE_SB_MsgId_t  MsgId;
 
+    /* The previous cycle ends where the wait for the next one begins */
+    if (g_MPU6050_AppData.auiStageStartNsec[MPU6050_STAGE_CYCLE] != 0)
+    {
+        MPU6050_StageEnd(MPU6050_STAGE_CYCLE);
+    }
+
     /* Stop Performance Log entry */
     CFE_ES_PerfLogExit(MPU6050_MAIN_TASK_PERF_ID);
 
     /* Wait for WakeUp messages from scheduler */
+#if MPU6050_DISPATCH_SINGLE_PIPE
+    iStatus = CFE_SB_ReceiveBuffer(&MsgPtr, g_MPU6050_AppData.DispatchPipeId, Timeout);
+#else
     iStatus = CFE_SB_ReceiveBuffer(&MsgPtr, g_MPU6050_AppData.SchPipeId, Timeout);
+#endif
 
     /* Start Performance Log entry */
     CFE_ES_PerfLogEntry(MPU6050_MAIN_TASK_PERF_ID);
+    MPU6050_StageBegin(MPU6050_STAGE_CYCLE);
+    g_MPU6050_AppData.uiSbRcvCnt++;
+
+#if MPU6050_DISPATCH_SINGLE_PIPE
+    if (iStatus == CFE_SUCCESS)
+    {
+        MPU6050_Dispatch(MsgPtr);
+        return (iStatus);
+    }
+#endif
 
     /* New data to process */
     if (iStatus == CFE_SUCCESS)
@@ -845,9 +1761,13 @@ int32 jPU6050_RcvMsg(int32 Timeout)
         switch (CFE_SB_MsgIdToValue(MsgId))
         {
             case MPU6050_WAKEUP_MID:
+                MPU6050_Jitter_Add(&g_MPU6050_AppData.DiagTlm.WakeJitter,
+                                   g_MPU6050_AppData.auiStageStartNsec[MPU6050_STAGE_CYCLE]);
                 MPU6050_ProcessNewCmds();
                 MPU6050_ProcessNewData();
+                MPU6050_StageBegin(MPU6050_STAGE_READ);
                 MPU6050_ReadDevice();
+                MPU6050_StageEnd(MPU6050_STAGE_READ);
                 break;
 
             /* Add more cases here */
@@ -861,7 +1781,9 @@ int32 jPU6050_RcvMsg(int32 Timeout)
     else if (iStatus == CFE_SB_NO_MESSAGE || iStatus == CFE_SB_TIME_OUT)
     {
         /* Read accelerometer */
+        MPU6050_StageBegin(MPU6050_STAGE_READ);
         MPU6050_ReadDevice();
+        MPU6050_StageEnd(MPU6050_STAGE_READ);
     }
     else
     {
@@ -878,9 +1800,119 @@ int32 jPU6050_RcvMsg(int32 Timeout)
 }
 
 /*=====================================================================================
-** Name: MPU6050_ProcessNewData
+** Name: MPU6050_InitSched
 **
-** Purpose: To process incoming data subscribed by MPU6050 application
+** Purpose: To arm the acquisition tick at the rate in the configuration table, or of
+**          the rate profile or power state in effect
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    int32 iStatus - Status of initialization
+**
+** Routines Called:
+**    MPU6050_StartTick
+**    MPU6050_ResetDiagnostics
+**
+** Called By:
+**    MPU6050_InitApp
+**    MPU6050_ProcessSendHk
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Sched
+**    g_MPU6050_AppData.DiagTlm
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Restarting moves the tick grid, so the timing diagnostics are reset with it.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_InitSched(void)
+{
+    MPU6050_StartTick();
+    MPU6050_ResetDiagnostics();
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_AcqPeriodNsec
+**
+** Purpose: To work out the acquisition tick period for the table, rate profile and
+**          power state in effect
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    uint32 - Tick period (ns), 0 to read on SCH wakeups instead
+**
+** Routines Called:
+**    None
+**
+** Called By:
+**    MPU6050_StartTick
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->acqRateHz
+**    g_MPU6050_AppData.ConfigTbl->rateProfiles
+**    g_MPU6050_AppData.ucRateProfile
+**    g_MPU6050_AppData.ucPowerState
+**    g_MPU6050_AppData.ucWakeRate
+**    g_MPU6050_AppData.VariantPtr
+**
+** Global Outputs/Writes:
+**    None
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Cycle mode always runs a tick, at twice the wake-up rate, so every wake-up is
+**    read within half a wake-up period of its sample.
+** 2: Nothing is read while the device sleeps, so there is no tick either.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+uint32 MPU6050_AcqPeriodNsec(void)
+{
+    uint16 rateHz = g_MPU6050_AppData.ConfigTbl->acqRateHz;
+
+    if (g_MPU6050_AppData.ucPowerState == MPU6050_POWER_SLEEP)
+    {
+        return 0;
+    }
+
+    if (g_MPU6050_AppData.ucPowerState == MPU6050_POWER_CYCLE)
+    {
+        return (uint32) (1e9 / (2.0 * g_MPU6050_AppData.VariantPtr->afWakeHz[g_MPU6050_AppData.ucWakeRate]));
+    }
+
+    /* A profile only changes the rate of a tick the table asks for */
+    if (rateHz != 0 && g_MPU6050_AppData.ucRateProfile != MPU6050_RATE_PROFILE_FIXED &&
+        g_MPU6050_AppData.ConfigTbl->rateProfiles[g_MPU6050_AppData.ucRateProfile].acqRateHz != 0)
+    {
+        rateHz = g_MPU6050_AppData.ConfigTbl->rateProfiles[g_MPU6050_AppData.ucRateProfile].acqRateHz;
+    }
+
+    return (rateHz == 0) ? 0 : 1000000000u / rateHz;
+}
+
+/*=====================================================================================
+** Name: MPU6050_StartTick
+**
+** Purpose: To start, restart or stop the acquisition tick as MPU6050_AcqPeriodNsec says
 **
 ** Arguments:
 **    None
@@ -889,12 +1921,1731 @@ int32 jPU6050_RcvMsg(int32 Timeout)
 **    None
 **
 ** Routines Called:
-**    CFE_SB_RcvMsg
-**    CFE_MSG_GetMsgId
+**    MPU6050_AcqPeriodNsec
+**    MPU6050_Sched_Start
+**    MPU6050_Sched_Stop
+**    MPU6050_Jitter_Init
 **    CFE_EVS_SendEvent
 **
 ** Called By:
-**    MPU6050_RcvMsg
+**    MPU6050_InitSched
+**    MPU6050_RestartSampling
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Sched
+**    g_MPU6050_AppData.DiagTlm.WakeJitter
+**    g_MPU6050_AppData.DiagTlm.ReadJitter
+**    g_MPU6050_AppData.DiagTlm.uiDeadlineNsec
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: With no tick (a rate of 0, or no timer available) the device is read on SCH
+**    wakeups and pipe timeouts as before; that is not an error.
+** 2: The first tick is one period out, so the cycle in progress is not cut short.
+** 3: Every rate, profile or power state change comes through here, so the cycle
+**    deadline follows the period too.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_StartTick(void)
+{
+    uint32 periodNsec = MPU6050_AcqPeriodNsec();
+
+    if (periodNsec == 0)
+    {
+        MPU6050_Sched_Stop(&g_MPU6050_AppData.Sched);
+    }
+    else if (MPU6050_Sched_Start(&g_MPU6050_AppData.Sched, periodNsec) != 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Could not start the %u us acquisition timer (%d), reading on SCH wakeups",
+                (unsigned int) (periodNsec / 1000), errno);
+    }
+
+    periodNsec = (g_MPU6050_AppData.Sched.iTimerFd >= 0) ? g_MPU6050_AppData.Sched.uiPeriodNsec :
+                                                           1000000000 / MPU6050_SAMPLE_RATE_HZ;
+    MPU6050_Jitter_Init(&g_MPU6050_AppData.DiagTlm.WakeJitter, periodNsec);
+    MPU6050_Jitter_Init(&g_MPU6050_AppData.DiagTlm.ReadJitter, periodNsec);
+    g_MPU6050_AppData.DiagTlm.uiDeadlineNsec = (uint32) ((uint64) periodNsec * MPU6050_DIAG_DEADLINE_PCT / 100);
+}
+
+/*=====================================================================================
+** Name: MPU6050_InitRealtime
+**
+** Purpose: To apply the real-time settings in the configuration table to the app task
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    int32 iStatus - Status of initialization
+**
+** Routines Called:
+**    MPU6050_Rt_Apply
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_InitApp
+**    MPU6050_ProcessSendHk
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->realtime
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.HkTlm.Realtime
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Runs on the app's main task, which is the one that reads the device.
+** 2: Settings the OS refuses are reported, but the app keeps running without them.
+** 3: Rerun on each table update; a setting the new table clears is undone.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_InitRealtime(void)
+{
+    MPU6050_RtStatus_t *statusPtr = &g_MPU6050_AppData.HkTlm.Realtime;
+
+    if (MPU6050_Rt_Apply(&g_MPU6050_AppData.ConfigTbl->realtime, statusPtr) != 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Real-time settings not fully applied (mask 0x%02X)",
+                (unsigned int) statusPtr->ucErrMask);
+    }
+
+    CFE_EVS_SendEvent(MPU6050_INIT_INF_EID, CFE_EVS_EventType_INFORMATION,
+            "MPU6050 - Policy %u priority %u CPUs 0x%08X memory %s",
+            (unsigned int) statusPtr->ucPolicy, (unsigned int) statusPtr->ucPriority,
+            (unsigned int) statusPtr->uiCpuMask, statusPtr->ucMemLocked ? "locked" : "unlocked");
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_WaitTick
+**
+** Purpose: To wait for the next acquisition tick and read the device on it
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_ES_PerfLogEntry
+**    CFE_ES_PerfLogExit
+**    CFE_EVS_SendEvent
+**    MPU6050_Sched_Wait
+**    MPU6050_Sched_Stop
+**    MPU6050_StageBegin
+**    MPU6050_StageEnd
+**    MPU6050_Jitter_Add
+**    MPU6050_ReadDevice
+**
+** Called By:
+**    MPU6050_AppMain
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Sched
+**    g_MPU6050_AppData.InData.uiSampleCnt
+**    g_MPU6050_AppData.DiagTlm.WakeJitter
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Takes the place of MPU6050_RcvMsg while the tick runs.  Exactly one read is made
+**    per tick acted on; ticks missed by an overrun are counted, not caught up on.
+** 2: If the timer fails the app falls back to SCH paced reads from the next cycle.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_WaitTick(void)
+{
+    int32 iStatus;
+
+    /* The previous cycle ends where the wait for the next one begins */
+    if (g_MPU6050_AppData.auiStageStartNsec[MPU6050_STAGE_CYCLE] != 0)
+    {
+        MPU6050_StageEnd(MPU6050_STAGE_CYCLE);
+    }
+
+    /* Stop Performance Log entry */
+    CFE_ES_PerfLogExit(MPU6050_MAIN_TASK_PERF_ID);
+
+    iStatus = MPU6050_Sched_Wait(&g_MPU6050_AppData.Sched);
+
+    /* Start Performance Log entry */
+    CFE_ES_PerfLogEntry(MPU6050_MAIN_TASK_PERF_ID);
+    MPU6050_StageBegin(MPU6050_STAGE_CYCLE);
+
+    if (iStatus < 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Acquisition timer failed (%d), reading on SCH wakeups", errno);
+        MPU6050_Sched_Stop(&g_MPU6050_AppData.Sched);
+        g_MPU6050_AppData.InData.uiSampleCnt = 0;
+        return;
+    }
+
+    MPU6050_Jitter_Add(&g_MPU6050_AppData.DiagTlm.WakeJitter,
+                       g_MPU6050_AppData.auiStageStartNsec[MPU6050_STAGE_CYCLE]);
+
+    MPU6050_StageBegin(MPU6050_STAGE_READ);
+    MPU6050_ReadDevice();
+    MPU6050_StageEnd(MPU6050_STAGE_READ);
+}
+
+/*=====================================================================================
+** Name: MPU6050_ServiceIdle
+**
+** Purpose: To handle SCH wakeups (commands and housekeeping) between acquisition ticks
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_SB_ReceiveBuffer
+**    CFE_MSG_GetMsgId
+**    CFE_EVS_SendEvent
+**    MPU6050_Sched_Remaining
+**    MPU6050_ProcessNewCmds
+**    MPU6050_ProcessNewData
+**    MPU6050_Dispatch
+**
+** Called By:
+**    MPU6050_AppMain
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.SchPipeId
+**    g_MPU6050_AppData.DispatchPipeId
+**    g_MPU6050_AppData.Sched
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.uiRunStatus
+**    g_MPU6050_AppData.uiSbRcvCnt
+**    g_MPU6050_AppData.usIdleDeferTicks
+**    g_MPU6050_AppData.HkTlm.uiIdleDeferCnt
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Nothing is taken off the SCH pipe unless MPU6050_SCHED_IDLE_MARGIN_USEC remain
+**    before the next tick; wakeups left on the pipe are handled after a later tick.
+** 2: The wakeups do not read the device, the tick does.
+** 3: A tick period, or a cycle, that never leaves the margin would shut out
+**    commands for good, the one that lowers the rate included.  So after
+**    MPU6050_SCHED_IDLE_MAX_DEFER ticks without it one message is taken anyway, at
+**    the cost of that tick's slack.  Each tick put off is counted in HK.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_ServiceIdle(void)
+{
+    int32            iStatus;
+    CFE_SB_Buffer_t *MsgPtr = NULL;
+    CFE_SB_MsgId_t   MsgId;
+    bool             bForced = false;
+
+    if (MPU6050_Sched_Remaining(&g_MPU6050_AppData.Sched) < MPU6050_SCHED_IDLE_MARGIN_USEC * 1000ull)
+    {
+        g_MPU6050_AppData.usIdleDeferTicks++;
+        if (g_MPU6050_AppData.usIdleDeferTicks < MPU6050_SCHED_IDLE_MAX_DEFER)
+        {
+            g_MPU6050_AppData.HkTlm.uiIdleDeferCnt++;
+            return;
+        }
+
+        /* Put off long enough; one message, whatever the time left */
+        bForced = true;
+    }
+    g_MPU6050_AppData.usIdleDeferTicks = 0;
+
+    do
+    {
+#if MPU6050_DISPATCH_SINGLE_PIPE
+        iStatus = CFE_SB_ReceiveBuffer(&MsgPtr, g_MPU6050_AppData.DispatchPipeId, CFE_SB_POLL);
+        g_MPU6050_AppData.uiSbRcvCnt++;
+        if (iStatus == CFE_SUCCESS)
+        {
+            /* Takes everything waiting, up to the budget */
+            MPU6050_Dispatch(MsgPtr);
+            break;
+        }
+#else
+        iStatus = CFE_SB_ReceiveBuffer(&MsgPtr, g_MPU6050_AppData.SchPipeId, CFE_SB_POLL);
+        g_MPU6050_AppData.uiSbRcvCnt++;
+#endif
+        if (iStatus == CFE_SB_NO_MESSAGE)
+        {
+            break;
+        }
+
+        if (iStatus != CFE_SUCCESS)
+        {
+            g_MPU6050_AppData.uiRunStatus = CFE_ES_RunStatus_APP_ERROR;
+            CFE_EVS_SendEvent(MPU6050_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050: SB pipe read error (0x%08X), app will exit", iStatus);
+            break;
+        }
+
+        iStatus = CFE_MSG_GetMsgId(&MsgPtr->Msg, &MsgId);
+        if (iStatus != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - Could not get message ID (0x%08X)", iStatus);
+            continue;
+        }
+
+        switch (CFE_SB_MsgIdToValue(MsgId))
+        {
+            case MPU6050_WAKEUP_MID:
+                MPU6050_ProcessNewCmds();
+                MPU6050_ProcessNewData();
+                break;
+
+            default:
+                CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "MPU6050 - Recvd invalid SCH msgId (0x%08X)", CFE_SB_MsgIdToValue(MsgId));
+                break;
+        }
+    } while (!bForced &&
+             MPU6050_Sched_Remaining(&g_MPU6050_AppData.Sched) >= MPU6050_SCHED_IDLE_MARGIN_USEC * 1000ull);
+}
+
+/*=====================================================================================
+** Name: MPU6050_InitRateProfiles
+**
+** Purpose: To start adaptive sampling in the most active rate profile, or return to the
+**          table's fixed rate
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    int32 iStatus - Status of initialization
+**
+** Routines Called:
+**    MPU6050_ApplyRateProfile
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_InitApp
+**    MPU6050_ProcessSendHk
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->adaptiveRate
+**    g_MPU6050_AppData.ConfigTbl->rateProfileCnt
+**    g_MPU6050_AppData.bDmpOn
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.ucRateProfileCnt
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Starting high means the first moments after boot or a table load are never
+**    undersampled; quiet motion steps the rate down within motionHoldMsec.
+** 2: The device already runs at the table's fixed rate after MPU6050_InitDevice, so
+**    it is only reprogrammed when adaptive sampling is turned off by a table update.
+** 3: The DMP firmware is built for one sample rate, so the fixed rate is kept while
+**    it runs.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_InitRateProfiles(void)
+{
+    const MPU6050_ConfigTbl_t *cfgPtr = g_MPU6050_AppData.ConfigTbl;
+
+    g_MPU6050_AppData.ucRateProfileCnt = cfgPtr->rateProfileCnt;
+    if (g_MPU6050_AppData.ucRateProfileCnt > MPU6050_MAX_RATE_PROFILES)
+    {
+        CFE_EVS_SendEvent(MPU6050_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - %u rate profiles configured, only the first %u used",
+                (unsigned int) cfgPtr->rateProfileCnt, (unsigned int) MPU6050_MAX_RATE_PROFILES);
+        g_MPU6050_AppData.ucRateProfileCnt = MPU6050_MAX_RATE_PROFILES;
+    }
+
+    if (cfgPtr->adaptiveRate && g_MPU6050_AppData.ucRateProfileCnt > 0)
+    {
+        if (!g_MPU6050_AppData.bDmpOn)
+        {
+            return MPU6050_ApplyRateProfile(g_MPU6050_AppData.ucRateProfileCnt - 1);
+        }
+
+        CFE_EVS_SendEvent(MPU6050_DMP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                "MPU6050 - Adaptive sampling is off while the DMP runs");
+    }
+
+    if (g_MPU6050_AppData.ucRateProfile != MPU6050_RATE_PROFILE_FIXED)
+    {
+        return MPU6050_ApplyRateProfile(MPU6050_RATE_PROFILE_FIXED);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_ApplyRateProfile
+**
+** Purpose: To switch the device, the sample timing and the output streams to a rate
+**          profile
+**
+** Arguments:
+**    uint8 Profile - Index into the table's rate profiles, or MPU6050_RATE_PROFILE_FIXED
+**
+** Returns:
+**    int32 iStatus - Status of the switch
+**
+** Routines Called:
+**    MPU6050_FlushStreams
+**    MPU6050_SetSampleRate
+**    MPU6050_GetSampleRateHz
+**    MPU6050_Core_SetMotionWindow
+**    MPU6050_RestartSampling
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_InitRateProfiles
+**    MPU6050_AdaptRate
+**    MPU6050_RestartDevice
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl
+**    g_MPU6050_AppData.FileID
+**    g_MPU6050_AppData.VariantPtr
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.ucRateProfile
+**    g_MPU6050_AppData.usPublishDecimation
+**    g_MPU6050_AppData.uiQuietMsec
+**    g_MPU6050_AppData.Core.Motion
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Packets collected under the old profile are sent first, tagged with it.
+** 2: Samples the FIFO latched since the last read are thrown away with it, since
+**    their rate is unknown.  The time model skips an index for them, so the streams
+**    and the recorder see a gap and start new packets and blocks.
+** 3: The acquisition tick is restarted at the profile's rate.  Only the jitter
+**    trackers are reset with it; the other timing diagnostics carry on.
+** 4: In cycle mode the registers are written but the device keeps sampling at the
+**    wake-up rate until it is active again.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_ApplyRateProfile(uint8 Profile)
+{
+    const MPU6050_ConfigTbl_t   *cfgPtr  = g_MPU6050_AppData.ConfigTbl;
+    const MPU6050_RateProfile_t *profPtr = NULL;
+    uint8   sampleRateDiv = cfgPtr->sampleRateDiv;
+    uint8   dlpfConfig    = cfgPtr->dlpfConfig;
+    uint16  acqRateHz     = cfgPtr->acqRateHz;
+    double  rateHz;
+
+    if (Profile != MPU6050_RATE_PROFILE_FIXED)
+    {
+        profPtr       = &cfgPtr->rateProfiles[Profile];
+        sampleRateDiv = profPtr->sampleRateDiv;
+        dlpfConfig    = profPtr->dlpfConfig;
+        if (profPtr->acqRateHz != 0)
+        {
+            acqRateHz = profPtr->acqRateHz;
+        }
+    }
+
+    MPU6050_FlushStreams();
+
+    if (MPU6050_SetSampleRate(g_MPU6050_AppData.FileID, g_MPU6050_AppData.VariantPtr, sampleRateDiv, dlpfConfig) != 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Failed to set the sample rate of rate profile %u", (unsigned int) Profile);
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    rateHz = MPU6050_GetSampleRateHz(sampleRateDiv, dlpfConfig);
+
+    g_MPU6050_AppData.ucRateProfile       = Profile;
+    g_MPU6050_AppData.usPublishDecimation = (profPtr != NULL && profPtr->publishDecimation != 0) ?
+                                            profPtr->publishDecimation : 1;
+    g_MPU6050_AppData.uiQuietMsec         = 0;
+    MPU6050_Core_SetMotionWindow(&g_MPU6050_AppData.Core, (uint32) (cfgPtr->motionWindowMsec * rateHz / 1000.0));
+
+    /* New FIFO, sample period and tick, from the next period on */
+    MPU6050_RestartSampling();
+
+    MPU6050_TRACE_EVENT(&g_MPU6050_AppData.TraceRing, MPU6050_TRACE_RATE_PROFILE, Profile,
+            g_MPU6050_AppData.Core.Motion.fGyroRmsDps, g_MPU6050_AppData.Core.Motion.fAccelStdMg);
+
+    CFE_EVS_SendEvent(MPU6050_INF_EID, CFE_EVS_EventType_INFORMATION,
+            "MPU6050 - Rate profile %u: %.1f Hz output data rate, DLPF %u, %u Hz reads",
+            (unsigned int) Profile, rateHz, (unsigned int) dlpfConfig, (unsigned int) acqRateHz);
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_AdaptRate
+**
+** Purpose: To follow the motion in the samples of the last read with the rate profile
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    MPU6050_Core_AddMotion
+**    MPU6050_ApplyRateProfile
+**
+** Called By:
+**    MPU6050_AppMain
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.InData
+**    g_MPU6050_AppData.ConfigTbl->rateProfiles
+**    g_MPU6050_AppData.ConfigTbl->motionWindowMsec
+**    g_MPU6050_AppData.ConfigTbl->motionHoldMsec
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Core.Motion
+**    g_MPU6050_AppData.uiQuietMsec
+**    g_MPU6050_AppData.HkTlm.uiRateSwitchCnt
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Does nothing unless the table enables adaptive sampling and the device is in
+**    MPU6050_POWER_ACTIVE.
+** 2: The motion is judged once per window.  A window over any profile's enter
+**    thresholds goes straight to the most active such profile; stepping down goes one
+**    profile at a time, so a brief lull in a maneuver does not drop the rate to idle.
+** 3: Runs after the samples of the cycle are streamed and recorded, so the switch
+**    takes effect from the next read.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_AdaptRate(void)
+{
+    const MPU6050_ConfigTbl_t   *cfgPtr = g_MPU6050_AppData.ConfigTbl;
+    const MPU6050_RateProfile_t *profPtr;
+    MPU6050_InData_t            *inData = &g_MPU6050_AppData.InData;
+    MPU6050_Motion_t            *motion = &g_MPU6050_AppData.Core.Motion;
+    int32                        target;
+    int32                        p;
+    uint32                       i;
+
+    /* Motion is judged on accel and gyro together, so only while both run */
+    if (g_MPU6050_AppData.ucRateProfile == MPU6050_RATE_PROFILE_FIXED ||
+        g_MPU6050_AppData.ucPowerState != MPU6050_POWER_ACTIVE)
+    {
+        return;
+    }
+
+    target = g_MPU6050_AppData.ucRateProfile;
+
+    for (i = 0; i < inData->uiSampleCnt && target == g_MPU6050_AppData.ucRateProfile; i++)
+    {
+        if (!MPU6050_Core_AddMotion(&g_MPU6050_AppData.Core, &inData->Samples[i]))
+        {
+            continue;
+        }
+
+        /* Most active profile the motion calls for, if above the current one */
+        for (p = g_MPU6050_AppData.ucRateProfileCnt - 1; p > target; p--)
+        {
+            profPtr = &cfgPtr->rateProfiles[p];
+            if (motion->fGyroRmsDps > profPtr->enterGyroDps || motion->fAccelStdMg > profPtr->enterAccelMg)
+            {
+                break;
+            }
+        }
+
+        if (p > target)
+        {
+            target = p;
+            continue;
+        }
+
+        /* Quiet for long enough under this profile's exit thresholds */
+        profPtr = &cfgPtr->rateProfiles[target];
+        if (target > 0 && motion->fGyroRmsDps < profPtr->exitGyroDps && motion->fAccelStdMg < profPtr->exitAccelMg)
+        {
+            g_MPU6050_AppData.uiQuietMsec += cfgPtr->motionWindowMsec;
+            if (g_MPU6050_AppData.uiQuietMsec >= cfgPtr->motionHoldMsec)
+            {
+                target--;
+            }
+        }
+        else
+        {
+            g_MPU6050_AppData.uiQuietMsec = 0;
+        }
+    }
+
+    if (target != g_MPU6050_AppData.ucRateProfile)
+    {
+        g_MPU6050_AppData.HkTlm.uiRateSwitchCnt++;
+        MPU6050_ApplyRateProfile((uint8) target);
+    }
+}
+
+/*=====================================================================================
+** Name: MPU6050_RestartSampling
+**
+** Purpose: To restart the FIFO, the sample timing and the acquisition tick after the
+**          rate profile or power state changed
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    MPU6050_GetSampleRateHz
+**    MPU6050_DmpDecimation
+**    MPU6050_ResetFifo
+**    MPU6050_TimeModel_SetPeriod
+**    MPU6050_StartTick
+**
+** Called By:
+**    MPU6050_ApplyRateProfile
+**    MPU6050_SetPowerState
+**    MPU6050_SetScale
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl
+**    g_MPU6050_AppData.ucRateProfile
+**    g_MPU6050_AppData.ucPowerState
+**    g_MPU6050_AppData.ucWakeRate
+**    g_MPU6050_AppData.VariantPtr
+**    g_MPU6050_AppData.bDmpOn
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Core.TimeModel
+**    g_MPU6050_AppData.Sched
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The FIFO is only drained while both sensors sample at the output data rate.  In
+**    cycle mode each wake-up is read from the data registers, one sample per read.
+** 2: The DMP queues one packet every MPU6050_DmpDecimation samples.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_RestartSampling(void)
+{
+    const MPU6050_ConfigTbl_t *cfgPtr = g_MPU6050_AppData.ConfigTbl;
+    uint8   sampleRateDiv = cfgPtr->sampleRateDiv;
+    uint8   dlpfConfig    = cfgPtr->dlpfConfig;
+    double  periodSec;
+
+    if (g_MPU6050_AppData.ucPowerState == MPU6050_POWER_CYCLE)
+    {
+        periodSec = 1.0 / g_MPU6050_AppData.VariantPtr->afWakeHz[g_MPU6050_AppData.ucWakeRate];
+    }
+    else
+    {
+        if (g_MPU6050_AppData.ucRateProfile != MPU6050_RATE_PROFILE_FIXED)
+        {
+            sampleRateDiv = cfgPtr->rateProfiles[g_MPU6050_AppData.ucRateProfile].sampleRateDiv;
+            dlpfConfig    = cfgPtr->rateProfiles[g_MPU6050_AppData.ucRateProfile].dlpfConfig;
+        }
+        periodSec = MPU6050_DmpDecimation() / MPU6050_GetSampleRateHz(sampleRateDiv, dlpfConfig);
+    }
+
+    /* What the FIFO queued under the old settings is of unknown rate */
+    if (cfgPtr->useFifo && g_MPU6050_AppData.ucPowerState <= MPU6050_POWER_GYRO_STANDBY)
+    {
+        MPU6050_ResetFifo(g_MPU6050_AppData.FileID, g_MPU6050_AppData.bDmpOn);
+    }
+
+    MPU6050_TimeModel_SetPeriod(&g_MPU6050_AppData.Core.TimeModel, periodSec);
+    MPU6050_StartTick();
+}
+
+/*=====================================================================================
+** Name: MPU6050_SetPowerState
+**
+** Purpose: To put the device in a power state and read it the way that state needs
+**
+** Arguments:
+**    uint8 State    - MPU6050_POWER_*
+**    uint8 WakeRate - LPWake* code, used by MPU6050_POWER_CYCLE
+**
+** Returns:
+**    int32 iStatus - Status of the change
+**
+** Routines Called:
+**    MPU6050_FlushStreams
+**    MPU6050_ConfigChannels
+**    MPU6050_write8
+**    MPU6050_DiagNow
+**    MPU6050_RestartSampling
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_InitApp
+**    MPU6050_RestartDevice
+**    MPU6050_ProcessNewAppCmds
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.FileID
+**    g_MPU6050_AppData.bDmpOn
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.ucPowerState
+**    g_MPU6050_AppData.ucWakeRate
+**    g_MPU6050_AppData.uiPowerStateStartNsec
+**    g_MPU6050_AppData.auiPowerStateNsec
+**    g_MPU6050_AppData.uiWakeStartNsec
+**    g_MPU6050_AppData.ucChannelMask
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Cycle mode wakes the accelerometer at the LP_WAKE_CTRL rate for one sample and
+**    sleeps in between; the gyros are in standby and the temperature sensor is off.
+**    DATA_RDY is enabled so that a read can tell whether a new sample was latched.
+** 2: Leaving sleep or cycle mode starts a wake-up, timed until the first sample is
+**    read by MPU6050_ReadDevice.  Gyro start-up is part of that time.
+** 3: Packets in progress are sent first, so no packet spans two power states.
+** 4: The channels the table disables stay in standby in every state.
+** 5: The DMP needs the gyros and the FIFO, so while it runs only active and sleep
+**    are allowed.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_SetPowerState(uint8 State, uint8 WakeRate)
+{
+    uint8  oldState  = g_MPU6050_AppData.ucPowerState;
+    uint8  intEnable = (State == MPU6050_POWER_CYCLE) ? (1 << IntEnableDataRdy) : 0;
+    int32  iStatus;
+    uint64 nowNsec;
+
+    if (State >= MPU6050_POWER_STATE_CNT || WakeRate > LPWake40Hz)
+    {
+        CFE_EVS_SendEvent(MPU6050_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Invalid power state %u, wake-up rate %u",
+                (unsigned int) State, (unsigned int) WakeRate);
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    if (g_MPU6050_AppData.bDmpOn && (State == MPU6050_POWER_GYRO_STANDBY || State == MPU6050_POWER_CYCLE))
+    {
+        CFE_EVS_SendEvent(MPU6050_DMP_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Power state %u is not allowed while the DMP runs", (unsigned int) State);
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    MPU6050_FlushStreams();
+
+    iStatus = MPU6050_ConfigChannels(State, WakeRate, NULL);
+    if (iStatus != CFE_SUCCESS)
+    {
+        return iStatus;
+    }
+
+    if (MPU6050_write8(g_MPU6050_AppData.FileID, RegIntEnable, intEnable) < 2)
+    {
+        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Failed to set power state %u", (unsigned int) State);
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    nowNsec = MPU6050_DiagNow();
+    g_MPU6050_AppData.auiPowerStateNsec[oldState] += nowNsec - g_MPU6050_AppData.uiPowerStateStartNsec;
+    g_MPU6050_AppData.uiPowerStateStartNsec        = nowNsec;
+
+    if (State == MPU6050_POWER_SLEEP)
+    {
+        g_MPU6050_AppData.uiWakeStartNsec = 0;
+    }
+    else if (oldState == MPU6050_POWER_SLEEP || oldState == MPU6050_POWER_CYCLE)
+    {
+        g_MPU6050_AppData.uiWakeStartNsec = nowNsec;
+    }
+
+    g_MPU6050_AppData.ucPowerState = State;
+    g_MPU6050_AppData.ucWakeRate   = WakeRate;
+
+    MPU6050_RestartSampling();
+
+    CFE_EVS_SendEvent(MPU6050_INF_EID, CFE_EVS_EventType_INFORMATION,
+            "MPU6050 - Power state %u (was %u), wake-up rate code %u",
+            (unsigned int) State, (unsigned int) oldState, (unsigned int) WakeRate);
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_StartCapture
+**
+** Purpose: To start recording every transfer with the device to a capture file
+**
+** Arguments:
+**    const char* Path - Capture file to create
+**
+** Returns:
+**    int32 iStatus - CFE_SUCCESS, or -1 if the file could not be started
+**
+** Routines Called:
+**    MPU6050_read8
+**    MPU6050_Capture_Start
+**
+** Called By:
+**    MPU6050_ProcessNewAppCmds
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.FileID
+**    g_MPU6050_AppData.ConfigTbl->deviceI2CAddr
+**
+** Global Outputs/Writes:
+**    None
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The configuration registers are read into the file header first, so a capture
+**    started mid-run can still be decoded.  Those reads are not recorded.
+** 2: Recording stops on MPU6050_CAPTURE_STOP_CC or when the app exits.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_StartCapture(const char *Path)
+{
+    /* Everything that decides what a read returns; no data, FIFO or status registers,
+     * whose reads have side effects */
+    static const uint8   configRegs[] =
+    {
+        RegSampleRateDiv, RegConfig, RegGyroConfig, RegAccelConfig, RegFifoEnable,
+        RegIntEnable, RegUserCtrl, RegPowerManagment1, RegPowerManagment2,
+    };
+    MPU6050_CapFileHdr_t hdr;
+    uint32               i;
+
+    memset(&hdr, 0x00, sizeof(hdr));
+    hdr.ucDeviceAddr = g_MPU6050_AppData.ConfigTbl->deviceI2CAddr;
+    for (i = 0; i < sizeof(configRegs); i++)
+    {
+        hdr.aucReg[configRegs[i]] = MPU6050_read8(g_MPU6050_AppData.FileID, configRegs[i]);
+    }
+
+    if (MPU6050_Capture_Start(g_MPU6050_AppData.FileID, Path, &hdr) != 0)
+    {
+        return -1;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_RestartDevice
+**
+** Purpose: To reset the device and bring back the configuration, rate profile and
+**          power state it had
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    int32 iStatus - Status of the restart
+**
+** Routines Called:
+**    MPU6050_FlushStreams
+**    MPU6050_ResetDevice
+**    MPU6050_ConfigDevice
+**    MPU6050_ApplyRateProfile
+**    MPU6050_SetPowerState
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_ProcessNewAppCmds
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.FileID
+**    g_MPU6050_AppData.ucRateProfile
+**    g_MPU6050_AppData.ucPowerState
+**    g_MPU6050_AppData.ucWakeRate
+**
+** Global Outputs/Writes:
+**    None
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Blocks for the 100 ms the reset takes.
+** 2: Scales set by command since startup are kept, since the commands write them
+**    into the loaded table.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_RestartDevice(void)
+{
+    int32 iStatus;
+
+    MPU6050_FlushStreams();
+
+    if (MPU6050_ResetDevice(g_MPU6050_AppData.FileID) != 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Device did not come out of reset");
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    iStatus = MPU6050_ConfigDevice();
+    if (iStatus != CFE_SUCCESS)
+    {
+        return iStatus;
+    }
+
+    /* The reset left the device active at the table rate */
+    iStatus = MPU6050_ApplyRateProfile(g_MPU6050_AppData.ucRateProfile);
+    if (iStatus == CFE_SUCCESS && g_MPU6050_AppData.ucPowerState != MPU6050_POWER_ACTIVE)
+    {
+        iStatus = MPU6050_SetPowerState(g_MPU6050_AppData.ucPowerState, g_MPU6050_AppData.ucWakeRate);
+    }
+
+    return iStatus;
+}
+
+/*=====================================================================================
+** Name: MPU6050_ProcessNewData
+**
+** Purpose: To process incoming data subscribed by MPU6050 application
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_SB_RcvMsg
+**    CFE_MSG_GetMsgId
+**    CFE_EVS_SendEvent
+**    MPU6050_FusionPeerNum
+**    MPU6050_FusionPeerData
+**
+** Called By:
+**    MPU6050_RcvMsg
+**    MPU6050_ServiceIdle
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    None
+**
+** Limitations, Assumptions, External Events, and Notes:
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2019-10-22
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_ProcessNewData()
+{
+    int            iStatus   = CFE_SUCCESS;
+    CFE_SB_Buffer_t*  TlmMsgPtr = NULL;
+    CFE_SB_MsgId_t TlmMsgId;
+
+    /* Process telemetry messages till the pipe is empty */
+    while (1)
+    {
+        iStatus = CFE_SB_ReceiveBuffer(&TlmMsgPtr, g_MPU6050_AppData.TlmPipeId, CFE_SB_POLL);
+        g_MPU6050_AppData.uiSbRcvCnt++;
+        if (iStatus == CFE_SUCCESS)
+        {
+            iStatus = CFE_MSG_GetMsgId(&TlmMsgPtr->Msg, &TlmMsgId);
+            if (iStatus == CFE_SUCCESS)
+            {
+                switch (CFE_SB_MsgIdToValue(TlmMsgId))
+                {
+                    /* TODO:  Add code to process all subscribed data here
+                     **
+                     ** Example:
+                     **     case NAV_OUT_DATA_MID:
+                     **         MPU6050_ProcessNavData(TlmMsgPtr);
+                     **         break;
+                     */
+
+                    default:
+                        /* Fusion peers are set by the table, so have no case of their own */
+                        if (MPU6050_FusionPeerNum(TlmMsgId) >= 0)
+                        {
+                            MPU6050_FusionPeerData(TlmMsgPtr);
+                            break;
+                        }
+
+                        CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
+                                "MPU6050 - Recvd invalid TLM msgId (0x%08X)", CFE_SB_MsgIdToValue(TlmMsgId));
+                        break;
+                }
+            }
+            else
+            {
+                    CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "MPU6050 - Could not get TLM msgId (0x%08X)", iStatus);
+            }
+        }
+        else if (iStatus == CFE_SB_NO_MESSAGE)
+        {
+            break;
+        }
+        else
+        {
+            CFE_EVS_SendEvent(MPU6050_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                  "MPU6050: CMD pipe read error (0x%08X)", iStatus);
+            g_MPU6050_AppData.uiRunStatus = CFE_ES_RunStatus_APP_ERROR;
+            break;
+        }
+    }
+}
+
+/*=====================================================================================
+** Name: MPU6050_ProcessNewCmds
+**
+** Purpose: To process incoming command messages for MPU6050 application
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_SB_RcvMsg
+**    CFE_MSG_GetMsgId
+**    CFE_EVS_SendEvent
+**    MPU6050_ProcessNewAppCmds
+**    MPU6050_ProcessSendHk
+**
+** Called By:
+**    MPU6050_RcvMsg
+**    MPU6050_ServiceIdle
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    None
+**
+** Limitations, Assumptions, External Events, and Notes:
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2019-10-22
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_ProcessNewCmds()
+{
+    int              iStatus   = CFE_SUCCESS;
+    CFE_SB_Buffer_t *CmdMsgPtr = NULL;
+    CFE_SB_MsgId_t   CmdMsgId;
+
+    /* Process command messages till the pipe is empty */
+    while (1)
+    {
+        iStatus = CFE_SB_ReceiveBuffer(&CmdMsgPtr, g_MPU6050_AppData.CmdPipeId, CFE_SB_POLL);
+        g_MPU6050_AppData.uiSbRcvCnt++;
+        if(iStatus == CFE_SUCCESS)
+        {
+            iStatus = CFE_MSG_GetMsgId(&CmdMsgPtr->Msg, &CmdMsgId);
+            if (iStatus == CFE_SUCCESS)
+            {
+                switch (CFE_SB_MsgIdToValue(CmdMsgId))
+                {
+                    case MPU6050_CMD_MID:
+                        MPU6050_ProcessNewAppCmds(&CmdMsgPtr->Msg);
+                        break;
+
+                    case MPU6050_SEND_HK_MID:
+                        MPU6050_ProcessSendHk();
+                        break;
+
+                    default:
+                        CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
+                                "MPU6050 - Recvd invalid CMD msgId (0x%08X)", CFE_SB_MsgIdToValue(CmdMsgId));
+                        break;
+                }
+            }
+            else
+            {
+                CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "MPU6050 - Could not get CMD msgId (0x%08X)", iStatus);
+            }
+        }
+        else if (iStatus == CFE_SB_NO_MESSAGE)
+        {
+            break;
+        }
+        else
+        {
+            CFE_EVS_SendEvent(MPU6050_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                  "MPU6050: CMD pipe read error (0x%08X)", iStatus);
+            g_MPU6050_AppData.uiRunStatus = CFE_ES_RunStatus_APP_ERROR;
+            break;
+        }
+    }
+}
+
+/*=====================================================================================
+** Name: MPU6050_ProcessSendHk
+**
+** Purpose: To service the housekeeping request: table updates, then telemetry
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_TBL_Manage
+**    CFE_EVS_SendEvent
+**    MPU6050_FlushStreams
+**    MPU6050_ConfigChannels
+**    MPU6050_RestartSampling
+**    MPU6050_ConfigureCore
+**    MPU6050_InitRateProfiles
+**    MPU6050_InitStreams
+**    MPU6050_InitFusion
+**    MPU6050_InitSched
+**    MPU6050_InitRealtime
+**    MPU6050_ReportHousekeeping
+**    MPU6050_ReportDiagnostics
+**
+** Called By:
+**    MPU6050_ProcessNewCmds
+**    MPU6050_Dispatch
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTblHandle
+**
+** Global Outputs/Writes:
+**    None
+**
+** Limitations, Assumptions, External Events, and Notes:
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_ProcessSendHk(void)
+{
+    int32 iStatus;
+
+    iStatus = CFE_TBL_Manage(g_MPU6050_AppData.ConfigTblHandle);
+    if (iStatus == CFE_TBL_INFO_UPDATED)
+    {
+        /* The stream table may have changed */
+        MPU6050_TRACE_EVENT(&g_MPU6050_AppData.TraceRing, MPU6050_TRACE_TBL_UPDATE);
+
+        /* New channels change the sample layout; packets of the old one go out first */
+        if (g_MPU6050_AppData.ConfigTbl->axisEnable != g_MPU6050_AppData.ucAxisEnable)
+        {
+            MPU6050_FlushStreams();
+            if (MPU6050_ConfigChannels(g_MPU6050_AppData.ucPowerState,
+                                       g_MPU6050_AppData.ucWakeRate, NULL) == CFE_SUCCESS)
+            {
+                MPU6050_RestartSampling();
+            }
+        }
+
+        MPU6050_ConfigureCore();
+        MPU6050_InitRateProfiles();
+        MPU6050_InitStreams();
+        MPU6050_InitFusion();
+        MPU6050_InitSched();
+        MPU6050_InitRealtime();
+    }
+    else if (iStatus != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MPU6050_ILOAD_ERR_EID, CFE_EVS_EventType_ERROR,
+                "Failed to manage table!");
+    }
+
+    MPU6050_ReportHousekeeping();
+    MPU6050_ReportDiagnostics();
+}
+
+/*=====================================================================================
+** Name: MPU6050_ProcessNewAppCmds
+**
+** Purpose: To process command messages targeting MPU6050 application
+**
+** Arguments:
+**    CFE_SB_Msg_t*  MsgPtr - new command message pointer
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_SB_GetCmdCode
+**    CFE_EVS_SendEvent
+**    MPU6050_VerifyCmdLength
+**    MPU6050_RecorderStartDump
+**    MPU6050_RecorderStopDump
+**    MPU6050_TraceDump
+**    MPU6050_RestartDevice
+**    MPU6050_SetPowerState
+**    MPU6050_SetScale
+**
+** Called By:
+**    MPU6050_ProcessNewCmds
+**    MPU6050_Dispatch
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.HkTlm.usCmdCnt
+**    g_MPU6050_AppData.HkTlm.usCmdErrCnt
+**
+** Limitations, Assumptions, External Events, and Notes:
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2019-10-22
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_ProcessNewAppCmds(CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_FcnCode_t uiCmdCode = 0;
+
+    if (MsgPtr != NULL)
+    {
+        CFE_MSG_GetFcnCode(MsgPtr, &uiCmdCode);
+        switch (uiCmdCode)
+        {
+            case MPU6050_NOOP_CC:
+                g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "MPU6050 - Recvd NOOP cmd (%d)", uiCmdCode);
+                break;
+
+            case MPU6050_RESET_APP_CC:
+                g_MPU6050_AppData.HkTlm.usCmdCnt = 0;
+                g_MPU6050_AppData.HkTlm.usCmdErrCnt = 0;
+                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "MPU6050 - Recvd RESET cmd (%d)", uiCmdCode);
+                break;
+
+            case MPU6050_RESET_DEVICE_CC:
+                if (MPU6050_VerifyCmdLength(MsgPtr, sizeof(MPU6050_NoArgCmd_t)))
+                {
+                    if (MPU6050_RestartDevice() == CFE_SUCCESS)
+                    {
+                        g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                        CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                          "MPU6050 - Device reset and reconfigured");
+                    }
+                    else
+                    {
+                        g_MPU6050_AppData.HkTlm.usCmdErrCnt++;
+                    }
+                }
+                break;
+
+            case MPU6050_SET_POWER_CC:
+                if (MPU6050_VerifyCmdLength(MsgPtr, sizeof(MPU6050_PowerCmd_t)))
+                {
+                    MPU6050_PowerCmd_t *CmdPtr = (MPU6050_PowerCmd_t*) MsgPtr;
+
+                    if (MPU6050_SetPowerState(CmdPtr->ucPowerState, CmdPtr->ucWakeRate) == CFE_SUCCESS)
+                    {
+                        g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                    }
+                    else
+                    {
+                        g_MPU6050_AppData.HkTlm.usCmdErrCnt++;
+                    }
+                }
+                break;
+
+            case MPU6050_SET_DEVICE_ACCELEROMETER_SCALE_2G_CC:
+                g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "MPU6050 - Setting accelerometer scale to +/- 2g");
+                MPU6050_SetScale(RegAccelConfig, MPU6050_ACCELSCALE_2G);
+                break;
+
+            case MPU6050_SET_DEVICE_ACCELEROMETER_SCALE_4G_CC:
+                g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "MPU6050 - Setting accelerometer scale to +/- 4g");
+                MPU6050_SetScale(RegAccelConfig, MPU6050_ACCELSCALE_4G);
+                break;
+
+            case MPU6050_SET_DEVICE_ACCELEROMETER_SCALE_8G_CC:
+                g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "MPU6050 - Setting accelerometer scale to +/- 8g");
+                MPU6050_SetScale(RegAccelConfig, MPU6050_ACCELSCALE_8G);
+                break;
+
+            case MPU6050_SET_DEVICE_ACCELEROMETER_SCALE_16G_CC:
+                g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "MPU6050 - Setting accelerometer scale to +/- 16g");
+                MPU6050_SetScale(RegAccelConfig, MPU6050_ACCELSCALE_16G);
+                break;
+
+            case MPU6050_SET_DEVICE_GYRO_SCALE_250DPS_CC:
+                g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "MPU6050 - Setting gyroscope scale to +/- 250 degs/s");
+                MPU6050_SetScale(RegGyroConfig, MPU6050_GYROSCALE_250DPS);
+                break;
+
+            case MPU6050_SET_DEVICE_GYRO_SCALE_500DPS_CC:
+                g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "MPU6050 - Setting gyroscope scale to +/- 500 degs/s");
+                MPU6050_SetScale(RegGyroConfig, MPU6050_GYROSCALE_500DPS);
+                break;
+
+            case MPU6050_SET_DEVICE_GYRO_SCALE_1000DPS_CC:
+                g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "MPU6050 - Setting gyroscope scale to +/- 1000 degs/s");
+                MPU6050_SetScale(RegGyroConfig, MPU6050_GYROSCALE_1000DPS);
+                break;
+
+            case MPU6050_SET_DEVICE_GYRO_SCALE_2000DPS_CC:
+                g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "MPU6050 - Setting gyroscope scale to +/- 2000 degs/s");
+                MPU6050_SetScale(RegGyroConfig, MPU6050_GYROSCALE_2000DPS);
+                break;
+
+            case MPU6050_REC_DUMP_FILE_CC:
+            case MPU6050_REC_DUMP_TLM_CC:
+                if (MPU6050_VerifyCmdLength(MsgPtr, sizeof(MPU6050_RecDumpCmd_t)))
+                {
+                    if (MPU6050_RecorderStartDump((const MPU6050_RecDumpCmd_t*) MsgPtr,
+                            (uiCmdCode == MPU6050_REC_DUMP_FILE_CC) ? MPU6050_REC_DUMP_FILE : MPU6050_REC_DUMP_TLM)
+                        == CFE_SUCCESS)
+                    {
+                        g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                    }
+                    else
+                    {
+                        g_MPU6050_AppData.HkTlm.usCmdErrCnt++;
+                    }
+                }
+                break;
+
+            case MPU6050_REC_DUMP_ABORT_CC:
+                if (MPU6050_VerifyCmdLength(MsgPtr, sizeof(MPU6050_NoArgCmd_t)))
+                {
+                    g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                    MPU6050_RecorderStopDump();
+                }
+                break;
+
+#if MPU6050_TRACE_LEVEL > MPU6050_TRACE_LEVEL_OFF
+            case MPU6050_TRACE_DUMP_CC:
+            case MPU6050_TRACE_DECODE_CC:
+                if (MPU6050_VerifyCmdLength(MsgPtr, sizeof(MPU6050_TraceDumpCmd_t)))
+                {
+                    MPU6050_TraceDumpCmd_t *CmdPtr = (MPU6050_TraceDumpCmd_t*) MsgPtr;
+                    int32                   recCnt;
+
+                    CmdPtr->dumpPath[sizeof(CmdPtr->dumpPath) - 1] = '\0';
+                    recCnt = MPU6050_TraceDump(&g_MPU6050_AppData.TraceRing, CmdPtr->dumpPath,
+                                               uiCmdCode == MPU6050_TRACE_DECODE_CC);
+                    if (recCnt >= 0)
+                    {
+                        g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                        CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                          "MPU6050 - Wrote %d trace records to %s", (int) recCnt, CmdPtr->dumpPath);
+                    }
+                    else
+                    {
+                        g_MPU6050_AppData.HkTlm.usCmdErrCnt++;
+                        CFE_EVS_SendEvent(MPU6050_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "MPU6050 - Failed to write trace to %s", CmdPtr->dumpPath);
+                    }
+                }
+                break;
+#endif
+
+            case MPU6050_RESET_DIAG_CC:
+                if (MPU6050_VerifyCmdLength(MsgPtr, sizeof(MPU6050_NoArgCmd_t)))
+                {
+                    g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                    MPU6050_ResetDiagnostics();
+                    CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                      "MPU6050 - Timing diagnostics reset");
+                }
+                break;
+
+            case MPU6050_CAPTURE_START_CC:
+                if (MPU6050_VerifyCmdLength(MsgPtr, sizeof(MPU6050_CaptureCmd_t)))
+                {
+                    MPU6050_CaptureCmd_t *CmdPtr = (MPU6050_CaptureCmd_t*) MsgPtr;
+
+                    CmdPtr->capturePath[sizeof(CmdPtr->capturePath) - 1] = '\0';
+                    if (MPU6050_StartCapture(CmdPtr->capturePath) == CFE_SUCCESS)
+                    {
+                        g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                        CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                          "MPU6050 - Capturing bus transfers to %s", CmdPtr->capturePath);
+                    }
+                    else
+                    {
+                        g_MPU6050_AppData.HkTlm.usCmdErrCnt++;
+                        CFE_EVS_SendEvent(MPU6050_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "MPU6050 - Failed to start a capture to %s", CmdPtr->capturePath);
+                    }
+                }
+                break;
+
+            case MPU6050_CAPTURE_STOP_CC:
+                if (MPU6050_VerifyCmdLength(MsgPtr, sizeof(MPU6050_NoArgCmd_t)))
+                {
+                    int32 recCnt = MPU6050_Capture_Stop();
+
+                    if (recCnt >= 0)
+                    {
+                        g_MPU6050_AppData.HkTlm.usCmdCnt++;
+                        CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                          "MPU6050 - Capture stopped after %d transfers", (int) recCnt);
+                    }
+                    else
+                    {
+                        g_MPU6050_AppData.HkTlm.usCmdErrCnt++;
+                        CFE_EVS_SendEvent(MPU6050_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "MPU6050 - Capture file could not be fully written");
+                    }
+                }
+                break;
+
+            /* TODO:  Add code to process the rest of the MPU6050 commands here */
+
+            default:
+                g_MPU6050_AppData.HkTlm.usCmdErrCnt++;
+                CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "MPU6050 - Recvd invalid cmdId (%d)", uiCmdCode);
+                break;
+        }
+    }
+}
+
+/*=====================================================================================
+** Name: MPU6050_ReportHousekeeping
+**
+** Purpose: To send housekeeping message
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_SB_TimeStampMsg
+**    MPU6050_TransmitCopy
+**    MPU6050_AgeTracker_Stats
+**    MPU6050_DiagNow
+**
+** Called By:
+**    MPU6050_ProcessSendHk
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    TBD
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The counters live in the global packet, so it is copied to send it.
+**
+** Algorithm:
+**
+** Author(s):  GSFC, Jacob Killelea
+**
+** History:  Date Written  2019-10-22
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_ReportHousekeeping()
+{
+    uint64           stateNsec;
+    uint32           i;
+
+    /* TODO:  Add code to update housekeeping data, if needed, here.  */
+    g_MPU6050_AppData.HkTlm.uiTimeResyncCnt = g_MPU6050_AppData.Core.TimeModel.ResyncCnt;
+    g_MPU6050_AppData.HkTlm.fClockDriftPpm  = (float) MPU6050_TimeModel_DriftPpm(&g_MPU6050_AppData.Core.TimeModel);
+    MPU6050_AgeTracker_Stats(&g_MPU6050_AppData.SampleAge, &g_MPU6050_AppData.HkTlm.SampleAge);
+    g_MPU6050_AppData.HkTlm.uiTickSkipCnt   = g_MPU6050_AppData.Sched.uiSkipCnt;
+    g_MPU6050_AppData.HkTlm.ucRateProfile   = g_MPU6050_AppData.ucRateProfile;
+    g_MPU6050_AppData.HkTlm.fMotionGyroDps  = g_MPU6050_AppData.Core.Motion.fGyroRmsDps;
+    g_MPU6050_AppData.HkTlm.fMotionAccelMg  = g_MPU6050_AppData.Core.Motion.fAccelStdMg;
+    g_MPU6050_AppData.HkTlm.ucPowerState    = g_MPU6050_AppData.ucPowerState;
+    g_MPU6050_AppData.HkTlm.ucWakeRate      = g_MPU6050_AppData.ucWakeRate;
+    g_MPU6050_AppData.HkTlm.ucChannelMask   = g_MPU6050_AppData.ucChannelMask;
+
+    /* Residency includes the time spent in the current state so far */
+    for (i = 0; i < MPU6050_POWER_STATE_CNT; i++)
+    {
+        stateNsec = g_MPU6050_AppData.auiPowerStateNsec[i];
+        if (i == g_MPU6050_AppData.ucPowerState)
+        {
+            stateNsec += MPU6050_DiagNow() - g_MPU6050_AppData.uiPowerStateStartNsec;
+        }
+        g_MPU6050_AppData.HkTlm.afPowerStateSec[i] = (float) (stateNsec / 1e9);
+    }
+
+    CFE_SB_TimeStampMsg((CFE_MSG_Message_t*) &g_MPU6050_AppData.HkTlm);
+    MPU6050_TransmitCopy((CFE_MSG_Message_t*) &g_MPU6050_AppData.HkTlm, sizeof(MPU6050_HkTlm_t));
+}
+
+/*=====================================================================================
+** Name: MPU6050_SendOutData
+**
+** Purpose: To publish 1-Wakeup cycle output data
+**
+** Arguments:
+**    CFE_SB_MsgId_t MsgId - MID of the latest sample stream
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_MSG_SetMsgId
+**    CFE_MSG_SetMsgTime
+**    MPU6050_TransmitCopy
+**    MPU6050_DiagNow
+**    MPU6050_AgeTracker_Publish
+**
+** Called By:
+**    MPU6050_StreamCycle
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.OutData
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.OutData.uiCounter
+**    g_MPU6050_AppData.OutData.uiPubTimeNsec
+**    g_MPU6050_AppData.SampleAge
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Does not account for uiCounter rollover
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2019-10-22
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_SendOutData(CFE_SB_MsgId_t MsgId)
+{
+    g_MPU6050_AppData.OutData.uiCounter++;
+
+    CFE_MSG_SetMsgId((CFE_MSG_Message_t*) &g_MPU6050_AppData.OutData, MsgId);
+
+    /* The packet time is the sample time, not the time it happened to be sent */
+    CFE_MSG_SetMsgTime((CFE_MSG_Message_t*) &g_MPU6050_AppData.OutData, g_MPU6050_AppData.OutData.timeTag);
+
+    g_MPU6050_AppData.OutData.uiPubTimeNsec = MPU6050_DiagNow();
+
+    MPU6050_TransmitCopy((CFE_MSG_Message_t*) &g_MPU6050_AppData.OutData, sizeof(MPU6050_OutData_t));
+
+    /* Subscribers have the packet once the transmit returns */
+    MPU6050_AgeTracker_Publish(&g_MPU6050_AppData.SampleAge, g_MPU6050_AppData.OutData.uiAcqTimeNsec);
+}
+
+/*=====================================================================================
+** Name: MPU6050_AllocPacket
+**
+** Purpose: To get an SB message buffer to build an outgoing packet in
+**
+** Arguments:
+**    CFE_MSG_Size_t Size - Largest size the packet can have
+**
+** Returns:
+**    CFE_SB_Buffer_t* - The buffer, or NULL if SB could not provide one
+**
+** Routines Called:
+**    CFE_SB_AllocateMessageBuffer
+**
+** Called By:
+**    MPU6050_StartStream
+**    MPU6050_SendStream
+**    MPU6050_RecDumpBlock
+**    MPU6050_TransmitCopy
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.HkTlm.uiBufAllocErrCnt
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The caller owns the buffer until it is passed to MPU6050_TransmitPacket.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+CFE_SB_Buffer_t *MPU6050_AllocPacket(CFE_MSG_Size_t Size)
+{
+    CFE_SB_Buffer_t *BufPtr = CFE_SB_AllocateMessageBuffer(Size);
+
+    if (BufPtr == NULL)
+    {
+        g_MPU6050_AppData.HkTlm.uiBufAllocErrCnt++;
+    }
+
+    return BufPtr;
+}
+
+/*=====================================================================================
+** Name: MPU6050_TransmitPacket
+**
+** Purpose: To hand a packet in an SB message buffer over to SB without a copy
+**
+** Arguments:
+**    CFE_SB_Buffer_t* BufPtr   - Buffer from MPU6050_AllocPacket
+**    bool             bInPlace - The packet was built in the buffer, not copied into it
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_SB_TransmitBuffer
+**    CFE_SB_ReleaseMessageBuffer
+**    MPU6050_StageBegin
+**    MPU6050_StageEnd
+**
+** Called By:
+**    MPU6050_SendStream
+**    MPU6050_RecDumpBlock
+**    MPU6050_TransmitCopy
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.HkTlm.uiZeroCopyPubCnt
+**    g_MPU6050_AppData.HkTlm.uiCopyPubCnt
+**    g_MPU6050_AppData.DiagTlm.Stage
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: SB only takes the buffer over when the transmit succeeds; otherwise it is still
+**    ours and is released here.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_TransmitPacket(CFE_SB_Buffer_t *BufPtr, bool bInPlace)
+{
+    MPU6050_StageBegin(MPU6050_STAGE_PUBLISH);
+
+    if (CFE_SB_TransmitBuffer(BufPtr, true) != CFE_SUCCESS)
+    {
+        CFE_SB_ReleaseMessageBuffer(BufPtr);
+    }
+    else if (bInPlace)
+    {
+        g_MPU6050_AppData.HkTlm.uiZeroCopyPubCnt++;
+    }
+    else
+    {
+        g_MPU6050_AppData.HkTlm.uiCopyPubCnt++;
+    }
+
+    MPU6050_StageEnd(MPU6050_STAGE_PUBLISH);
+}
+
+/*=====================================================================================
+** Name: MPU6050_TransmitCopy
+**
+** Purpose: To send a packet kept in the app's own memory
+**
+** Arguments:
+**    CFE_MSG_Message_t* MsgPtr - The packet
+**    CFE_MSG_Size_t     Size   - Its size
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    MPU6050_AllocPacket
+**    MPU6050_TransmitPacket
+**    CFE_SB_TransmitMsg
+**
+** Called By:
+**    MPU6050_SendOutData
+**    MPU6050_ReportHousekeeping
+**    MPU6050_ReportDiagnostics
 **
 ** Global Inputs/Reads:
 **    None
@@ -903,296 +3654,161 @@ int32 jPU6050_RcvMsg(int32 Timeout)
 **    None
 **
 ** Limitations, Assumptions, External Events, and Notes:
+** 1: The packet is copied into an SB buffer once here instead of by SB on transmit,
+**    and counted as a copied publish.  SB makes the copy if no buffer is available.
 **
 ** Algorithm:
 **
 ** Author(s):  Jacob Killelea
 **
-** History:  Date Written  2019-10-22
+** History:  Date Written  2026-10-19
 **           Unit Tested   yyyy-mm-dd
 **=====================================================================================*/
-void MPU6050_ProcessNewData()
+void MPU6050_TransmitCopy(CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t Size)
 {
-    int            iStatus   = CFE_SUCCESS;
-    CFE_SB_Buffer_t*  TlmMsgPtr = NULL;
-    CFE_SB_MsgId_t TlmMsgId;
+    CFE_SB_Buffer_t *BufPtr = MPU6050_AllocPacket(Size);
 
-    /* Process telemetry messages till the pipe is empty */
-    while (1)
+    if (BufPtr == NULL)
     {
-        iStatus = CFE_SB_ReceiveBuffer(&TlmMsgPtr, g_MPU6050_AppData.TlmPipeId, CFE_SB_POLL);
-        if (iStatus == CFE_SUCCESS)
-        {
-            iStatus = CFE_MSG_GetMsgId(&TlmMsgPtr->Msg, &TlmMsgId);
-            if (iStatus == CFE_SUCCESS)
-            {
-                switch (CFE_SB_MsgIdToValue(TlmMsgId))
-                {
-                    /* TODO:  Add code to process all subscribed data here
-                     **
-                     ** Example:
-                     **     case NAV_OUT_DATA_MID:
-                     **         MPU6050_ProcessNavData(TlmMsgPtr);
-                     **         break;
-                     */
-
-                    default:
-                        CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
-                                "MPU6050 - Recvd invalid TLM msgId (0x%08X)", CFE_SB_MsgIdToValue(TlmMsgId));
-                        break;
-                }
-            }
-            else
-            {
-                    CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "MPU6050 - Could not get TLM msgId (0x%08X)", iStatus);
-            }
-        }
-        else if (iStatus == CFE_SB_NO_MESSAGE)
-        {
-            break;
-        }
-        else
-        {
-            CFE_EVS_SendEvent(MPU6050_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
-                  "MPU6050: CMD pipe read error (0x%08X)", iStatus);
-            g_MPU6050_AppData.uiRunStatus = CFE_ES_RunStatus_APP_ERROR;
-            break;
-        }
+        CFE_SB_TransmitMsg(MsgPtr, true);
+        return;
     }
+
+    memcpy(BufPtr, MsgPtr, Size);
+    MPU6050_TransmitPacket(BufPtr, false);
 }
 
 /*=====================================================================================
-** Name: MPU6050_ProcessNewCmds
+** Name: MPU6050_StageBegin
 **
-** Purpose: To process incoming command messages for MPU6050 application
+** Purpose: To mark the start of one instrumented stage of a processing cycle
 **
 ** Arguments:
-**    None
+**    uint32 Stage - MPU6050_STAGE_*
 **
 ** Returns:
 **    None
 **
 ** Routines Called:
-**    CFE_SB_RcvMsg
-**    CFE_MSG_GetMsgId
-**    CFE_EVS_SendEvent
-**    MPU6050_ProcessNewAppCmds
-**    MPU6050_ReportHousekeeping
+**    CFE_ES_PerfLogEntry
+**    MPU6050_DiagNow
+**    MPU6050_Jitter_Add
 **
 ** Called By:
 **    MPU6050_RcvMsg
+**    MPU6050_TransmitPacket
+**    MPU6050_AppMain
 **
 ** Global Inputs/Reads:
 **    None
 **
 ** Global Outputs/Writes:
-**    None
+**    g_MPU6050_AppData.auiStageStartNsec
+**    g_MPU6050_AppData.DiagTlm.ReadJitter
 **
 ** Limitations, Assumptions, External Events, and Notes:
+** 1: The cycle stage is logged under MPU6050_MAIN_TASK_PERF_ID by the caller; every
+**    other stage has a perf ID of its own.
+** 2: Device reads start at the sampling instants when not draining the FIFO, so the
+**    jitter of the read starts is kept along with the read times.
 **
 ** Algorithm:
 **
 ** Author(s):  Jacob Killelea
 **
-** History:  Date Written  2019-10-22
+** History:  Date Written  2026-10-19
 **           Unit Tested   yyyy-mm-dd
 **=====================================================================================*/
-void MPU6050_ProcessNewCmds()
+void MPU6050_StageBegin(uint32 Stage)
 {
-    int              iStatus   = CFE_SUCCESS;
-    CFE_SB_Buffer_t *CmdMsgPtr = NULL;
-    CFE_SB_MsgId_t   CmdMsgId;
+    uint64 nowNsec;
 
-    /* Process command messages till the pipe is empty */
-    while (1)
+    if (Stage != MPU6050_STAGE_CYCLE)
     {
-        iStatus = CFE_SB_ReceiveBuffer(&CmdMsgPtr, g_MPU6050_AppData.CmdPipeId, CFE_SB_POLL);
-        if(iStatus == CFE_SUCCESS)
-        {
-            iStatus = CFE_MSG_GetMsgId(&CmdMsgPtr->Msg, &CmdMsgId);
-            if (iStatus == CFE_SUCCESS)
-            {
-                switch (CFE_SB_MsgIdToValue(CmdMsgId))
-                {
-                    case MPU6050_CMD_MID:
-                        MPU6050_ProcessNewAppCmds(&CmdMsgPtr->Msg);
-                        break;
+        CFE_ES_PerfLogEntry(MPU6050_StagePerfIds[Stage]);
+    }
 
-                    case MPU6050_SEND_HK_MID:
-                        if (CFE_TBL_Manage(g_MPU6050_AppData.ConfigTblHandle) != CFE_SUCCESS)
-                        {
-                            CFE_EVS_SendEvent(MPU6050_ILOAD_ERR_EID, CFE_EVS_EventType_ERROR,
-                                    "Failed to manage table!");
-                        }
-                        MPU6050_ReportHousekeeping();
-                        break;
+    nowNsec = MPU6050_DiagNow();
+    g_MPU6050_AppData.auiStageStartNsec[Stage] = nowNsec;
 
-                    default:
-                        CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
-                                "MPU6050 - Recvd invalid CMD msgId (0x%08X)", CFE_SB_MsgIdToValue(CmdMsgId));
-                        break;
-                }
-            }
-            else
-            {
-                CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
-                        "MPU6050 - Could not get CMD msgId (0x%08X)", iStatus);
-            }
-        }
-        else if (iStatus == CFE_SB_NO_MESSAGE)
-        {
-            break;
-        }
-        else
-        {
-            CFE_EVS_SendEvent(MPU6050_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
-                  "MPU6050: CMD pipe read error (0x%08X)", iStatus);
-            g_MPU6050_AppData.uiRunStatus = CFE_ES_RunStatus_APP_ERROR;
-            break;
-        }
+    if (Stage == MPU6050_STAGE_READ)
+    {
+        MPU6050_Jitter_Add(&g_MPU6050_AppData.DiagTlm.ReadJitter, nowNsec);
     }
 }
 
 /*=====================================================================================
-** Name: MPU6050_ProcessNewAppCmds
+** Name: MPU6050_StageEnd
 **
-** Purpose: To process command messages targeting MPU6050 application
+** Purpose: To account the time of one instrumented stage of a processing cycle
 **
 ** Arguments:
-**    CFE_SB_Msg_t*  MsgPtr - new command message pointer
+**    uint32 Stage - MPU6050_STAGE_*, begun with MPU6050_StageBegin
 **
 ** Returns:
 **    None
 **
 ** Routines Called:
-**    CFE_SB_GetCmdCode
-**    CFE_EVS_SendEvent
+**    CFE_ES_PerfLogExit
+**    MPU6050_DiagNow
+**    MPU6050_Hist_Add
 **
 ** Called By:
-**    MPU6050_ProcessNewCmds
+**    MPU6050_RcvMsg
+**    MPU6050_TransmitPacket
+**    MPU6050_AppMain
 **
 ** Global Inputs/Reads:
-**    None
+**    g_MPU6050_AppData.auiStageStartNsec
 **
 ** Global Outputs/Writes:
-**    g_MPU6050_AppData.HkTlm.usCmdCnt
-**    g_MPU6050_AppData.HkTlm.usCmdErrCnt
+**    g_MPU6050_AppData.DiagTlm.Stage
+**    g_MPU6050_AppData.DiagTlm.uiDeadlineMissCnt
+**    g_MPU6050_AppData.HkTlm.uiSbRcvCallCnt
+**    g_MPU6050_AppData.HkTlm.uiSbRcvCallMax
+**    g_MPU6050_AppData.uiSbRcvCnt
 **
 ** Limitations, Assumptions, External Events, and Notes:
+** 1: A cycle that runs longer than DiagTlm.uiDeadlineNsec, MPU6050_DIAG_DEADLINE_PCT
+**    of the acquisition period in effect, counts as a deadline miss.
 **
 ** Algorithm:
 **
 ** Author(s):  Jacob Killelea
 **
-** History:  Date Written  2019-10-22
+** History:  Date Written  2026-10-19
 **           Unit Tested   yyyy-mm-dd
 **=====================================================================================*/
-void MPU6050_ProcessNewAppCmds(CFE_MSG_Message_t *MsgPtr)
+void MPU6050_StageEnd(uint32 Stage)
 {
-    CFE_MSG_FcnCode_t uiCmdCode = 0;
+    uint64 elapsedNsec = MPU6050_DiagNow() - g_MPU6050_AppData.auiStageStartNsec[Stage];
 
-    if (MsgPtr != NULL)
+    MPU6050_Hist_Add(&g_MPU6050_AppData.DiagTlm.Stage[Stage], elapsedNsec);
+
+    if (Stage == MPU6050_STAGE_CYCLE)
     {
-        CFE_MSG_GetFcnCode(MsgPtr, &uiCmdCode);
-        switch (uiCmdCode)
+        if (elapsedNsec > g_MPU6050_AppData.DiagTlm.uiDeadlineNsec)
         {
-            case MPU6050_NOOP_CC:
-                g_MPU6050_AppData.HkTlm.usCmdCnt++;
-                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "MPU6050 - Recvd NOOP cmd (%d)", uiCmdCode);
-                break;
-
-            case MPU6050_RESET_APP_CC:
-                g_MPU6050_AppData.HkTlm.usCmdCnt = 0;
-                g_MPU6050_AppData.HkTlm.usCmdErrCnt = 0;
-                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "MPU6050 - Recvd RESET cmd (%d)", uiCmdCode);
-                break;
-
-            case MPU6050_RESET_DEVICE_CC:
-                MPU6050_ResetDevice();
-                break;
-
-            case MPU6050_SET_DEVICE_ACCELEROMETER_SCALE_2G_CC:
-                g_MPU6050_AppData.HkTlm.usCmdCnt++;
-                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "MPU6050 - Setting accelerometer scale to +/- 2g");
-                g_MPU6050_AppData.ConfigTbl->initialAccelScale = MPU6050_ACCELSCALE_2G;
-                MPU6050_write8(g_MPU6050_AppData.FileID, RegAccelConfig, MPU6050_ACCELSCALE_2G);
-                break;
-
-            case MPU6050_SET_DEVICE_ACCELEROMETER_SCALE_4G_CC:
-                g_MPU6050_AppData.HkTlm.usCmdCnt++;
-                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "MPU6050 - Setting accelerometer scale to +/- 4g");
-                g_MPU6050_AppData.ConfigTbl->initialAccelScale = MPU6050_ACCELSCALE_4G;
-                MPU6050_write8(g_MPU6050_AppData.FileID, RegAccelConfig, MPU6050_ACCELSCALE_4G);
-                break;
-
-            case MPU6050_SET_DEVICE_ACCELEROMETER_SCALE_8G_CC:
-                g_MPU6050_AppData.HkTlm.usCmdCnt++;
-                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "MPU6050 - Setting accelerometer scale to +/- 8g");
-                g_MPU6050_AppData.ConfigTbl->initialAccelScale = MPU6050_ACCELSCALE_8G;
-                MPU6050_write8(g_MPU6050_AppData.FileID, RegAccelConfig, MPU6050_ACCELSCALE_8G);
-                break;
-
-            case MPU6050_SET_DEVICE_ACCELEROMETER_SCALE_16G_CC:
-                g_MPU6050_AppData.HkTlm.usCmdCnt++;
-                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "MPU6050 - Setting accelerometer scale to +/- 16g");
-                g_MPU6050_AppData.ConfigTbl->initialAccelScale = MPU6050_ACCELSCALE_16G;
-                MPU6050_write8(g_MPU6050_AppData.FileID, RegAccelConfig, MPU6050_ACCELSCALE_16G);
-                break;
-
-            case MPU6050_SET_DEVICE_GYRO_SCALE_250DPS_CC:
-                g_MPU6050_AppData.HkTlm.usCmdCnt++;
-                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "MPU6050 - Setting gyroscope scale to +/- 250 degs/s");
-                g_MPU6050_AppData.ConfigTbl->initialGyroScale = MPU6050_GYROSCALE_250DPS;
-                MPU6050_write8(g_MPU6050_AppData.FileID, RegGyroConfig, MPU6050_GYROSCALE_250DPS);
-                break;
-
-            case MPU6050_SET_DEVICE_GYRO_SCALE_500DPS_CC:
-                g_MPU6050_AppData.HkTlm.usCmdCnt++;
-                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "MPU6050 - Setting gyroscope scale to +/- 500 degs/s");
-                g_MPU6050_AppData.ConfigTbl->initialGyroScale = MPU6050_GYROSCALE_500DPS;
-                MPU6050_write8(g_MPU6050_AppData.FileID, RegGyroConfig, MPU6050_GYROSCALE_500DPS);
-                break;
-
-            case MPU6050_SET_DEVICE_GYRO_SCALE_1000DPS_CC:
-                g_MPU6050_AppData.HkTlm.usCmdCnt++;
-                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "MPU6050 - Setting gyroscope scale to +/- 1000 degs/s");
-                g_MPU6050_AppData.ConfigTbl->initialGyroScale = MPU6050_GYROSCALE_1000DPS;
-                MPU6050_write8(g_MPU6050_AppData.FileID, RegGyroConfig, MPU6050_GYROSCALE_1000DPS);
-                break;
-
-            case MPU6050_SET_DEVICE_GYRO_SCALE_2000DPS_CC:
-                g_MPU6050_AppData.HkTlm.usCmdCnt++;
-                CFE_EVS_SendEvent(MPU6050_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "MPU6050 - Setting gyroscope scale to +/- 2000 degs/s");
-                g_MPU6050_AppData.ConfigTbl->initialGyroScale = MPU6050_GYROSCALE_2000DPS;
-                MPU6050_write8(g_MPU6050_AppData.FileID, RegGyroConfig, MPU6050_GYROSCALE_2000DPS);
-                break;
-
-            /* TODO:  Add code to process the rest of the MPU6050 commands here */
+            g_MPU6050_AppData.DiagTlm.uiDeadlineMissCnt++;
+        }
 
-            default:
-                g_MPU6050_AppData.HkTlm.usCmdErrCnt++;
-                CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "MPU6050 - Recvd invalid cmdId (%d)", uiCmdCode);
-                break;
+        g_MPU6050_AppData.HkTlm.uiSbRcvCallCnt = g_MPU6050_AppData.uiSbRcvCnt;
+        if (g_MPU6050_AppData.uiSbRcvCnt > g_MPU6050_AppData.HkTlm.uiSbRcvCallMax)
+        {
+            g_MPU6050_AppData.HkTlm.uiSbRcvCallMax = g_MPU6050_AppData.uiSbRcvCnt;
         }
+        g_MPU6050_AppData.uiSbRcvCnt = 0;
+    }
+    else
+    {
+        CFE_ES_PerfLogExit(MPU6050_StagePerfIds[Stage]);
     }
 }
 
 /*=====================================================================================
-** Name: MPU6050_ReportHousekeeping
+** Name: MPU6050_ResetDiagnostics
 **
-** Purpose: To send housekeeping message
+** Purpose: To clear the timing diagnostics
 **
 ** Arguments:
 **    None
@@ -1201,38 +3817,63 @@ void MPU6050_ProcessNewAppCmds(CFE_MSG_Message_t *MsgPtr)
 **    None
 **
 ** Routines Called:
-**    TBD
+**    MPU6050_Hist_Reset
+**    MPU6050_Jitter_Init
+**    MPU6050_AgeTracker_Init
 **
 ** Called By:
-**    MPU6050_ProcessNewCmds
+**    MPU6050_InitData
+**    MPU6050_ProcessNewAppCmds
 **
 ** Global Inputs/Reads:
-**    None
+**    g_MPU6050_AppData.Sched
 **
 ** Global Outputs/Writes:
-**    TBD
+**    g_MPU6050_AppData.DiagTlm
+**    g_MPU6050_AppData.SampleAge
 **
 ** Limitations, Assumptions, External Events, and Notes:
+** 1: The jitter trackers forget the last event too, so the first interval after a
+**    reset is not counted.
+** 2: Jitter and the cycle deadline are measured against the acquisition tick while it
+**    runs, and against the nominal SCH wakeup period otherwise.
 **
 ** Algorithm:
 **
-** Author(s):  GSFC, Jacob Killelea
+** Author(s):  Jacob Killelea
 **
-** History:  Date Written  2019-10-22
+** History:  Date Written  2026-10-19
 **           Unit Tested   yyyy-mm-dd
 **=====================================================================================*/
-void MPU6050_ReportHousekeeping()
+void MPU6050_ResetDiagnostics(void)
 {
-    /* TODO:  Add code to update housekeeping data, if needed, here.  */
+    MPU6050_DiagTlm_t *diagPtr = &g_MPU6050_AppData.DiagTlm;
+    uint32             periodNsec = 1000000000 / MPU6050_SAMPLE_RATE_HZ;
+    uint32             i;
 
-    CFE_SB_TimeStampMsg((CFE_MSG_Message_t*) &g_MPU6050_AppData.HkTlm);
-    CFE_SB_TransmitMsg((CFE_MSG_Message_t*)  &g_MPU6050_AppData.HkTlm, true);
+    if (g_MPU6050_AppData.Sched.iTimerFd >= 0)
+    {
+        periodNsec = g_MPU6050_AppData.Sched.uiPeriodNsec;
+    }
+
+    for (i = 0; i < MPU6050_STAGE_CNT; i++)
+    {
+        MPU6050_Hist_Reset(&diagPtr->Stage[i]);
+    }
+
+    MPU6050_Jitter_Init(&diagPtr->WakeJitter, periodNsec);
+    MPU6050_Jitter_Init(&diagPtr->ReadJitter, periodNsec);
+
+    diagPtr->uiDeadlineNsec    = (uint32) ((uint64) periodNsec * MPU6050_DIAG_DEADLINE_PCT / 100);
+    diagPtr->uiDeadlineMissCnt = 0;
+
+    MPU6050_AgeTracker_Init(&g_MPU6050_AppData.SampleAge);
 }
 
 /*=====================================================================================
-** Name: MPU6050_SendOutData
+** Name: MPU6050_ReportDiagnostics
 **
-** Purpose: To publish 1-Wakeup cycle output data
+** Purpose: To send the timing diagnostics packet
 **
 ** Arguments:
 **    None
@@ -1242,33 +3883,31 @@ void MPU6050_ReportHousekeeping()
 **
 ** Routines Called:
 **    CFE_SB_TimeStampMsg
-**    CFE_SB_SendMsg
+**    MPU6050_TransmitCopy
 **
 ** Called By:
-**    MPU6050_RcvMsg
+**    MPU6050_ProcessSendHk
 **
 ** Global Inputs/Reads:
-**    g_MPU6050_AppData.OutData
+**    g_MPU6050_AppData.DiagTlm
 **
 ** Global Outputs/Writes:
-**    g_MPU6050_AppData.OutData.uiCounter
+**    None
 **
 ** Limitations, Assumptions, External Events, and Notes:
-** 1: Does not account for uiCounter rollover
+** 1: Sent right after housekeeping, on the same request.
 **
 ** Algorithm:
 **
 ** Author(s):  Jacob Killelea
 **
-** History:  Date Written  2019-10-22
+** History:  Date Written  2026-10-19
 **           Unit Tested   yyyy-mm-dd
 **=====================================================================================*/
-void MPU6050_SendOutData()
+void MPU6050_ReportDiagnostics(void)
 {
-    g_MPU6050_AppData.OutData.uiCounter++;
-
-    CFE_SB_TimeStampMsg((CFE_MSG_Message_t*) &g_MPU6050_AppData.OutData);
-    CFE_SB_TransmitMsg((CFE_MSG_Message_t*)  &g_MPU6050_AppData.OutData, true);
+    CFE_SB_TimeStampMsg((CFE_MSG_Message_t*) &g_MPU6050_AppData.DiagTlm);
+    MPU6050_TransmitCopy((CFE_MSG_Message_t*) &g_MPU6050_AppData.DiagTlm, sizeof(MPU6050_DiagTlm_t));
 }
 
 /*=====================================================================================
@@ -1375,6 +4014,19 @@ bool MPU6050_VerifyCmdLength(CFE_MSG_Message_t* MsgPtr, uint16 expectedLen)
 **    CFE_ES_WaitForStartupSync
 **    MPU6050_InitApp
 **    MPU6050_RcvMsg
+**    MPU6050_WaitTick
+**    MPU6050_ServiceIdle
+**    MPU6050_StageBegin
+**    MPU6050_StageEnd
+**    MPU6050_StreamNewData
+**    MPU6050_RecordNewData
+**    MPU6050_PropagateAttitude
+**    MPU6050_Core_SetAttitude
+**    MPU6050_StreamContentUsed
+**    MPU6050_StreamCycle
+**    MPU6050_FusionNewData
+**    MPU6050_RecorderService
+**    MPU6050_AdaptRate
 **
 ** Called By:
 **    TBD
@@ -1412,56 +4064,80 @@ void MPU6050_AppMain()
         CFE_ES_PerfLogEntry(MPU6050_MAIN_TASK_PERF_ID);
     }
 
-    // TODO: something here causes problems.
-    static CFE_TIME_SysTime_t lasttimestamp = {.Seconds = 0, .Subseconds = 0,};
-    static double phi   = 0.0;
-    static double theta = 0.0;
-    static double psi   = 0.0;
-
     /* Application main loop */
     while (CFE_ES_RunLoop(&g_MPU6050_AppData.uiRunStatus) == true)
     {
 
-        MPU6050_RcvMsg(1000 / MPU6050_SAMPLE_RATE_HZ);
-
-        CFE_TIME_SysTime_t delta_t = CFE_TIME_Subtract(g_MPU6050_AppData.OutData.timeTag, lasttimestamp);
-        double dt = ((double) delta_t.Seconds) + (((double) CFE_TIME_Sub2MicroSecs(delta_t.Subseconds)) / 1e6);
-
-        double delta_phi   = 2.0 * M_PI * g_MPU6050_AppData.OutData.gyroXDegsSec * dt / 180.0;
-        double delta_theta = 2.0 * M_PI * g_MPU6050_AppData.OutData.gyroYDegsSec * dt / 180.0;
-        double delta_psi   = 2.0 * M_PI * g_MPU6050_AppData.OutData.gyroZDegsSec * dt / 180.0;
-
-        while (phi > 2.0 * M_PI)
-            phi -= 2.0 * M_PI;
-
-        while (theta > 2.0 * M_PI)
-            theta -= 2.0 * M_PI;
+        if (g_MPU6050_AppData.Sched.iTimerFd >= 0)
+        {
+            MPU6050_WaitTick();
+        }
+        else
+        {
+            MPU6050_RcvMsg(1000 / MPU6050_SAMPLE_RATE_HZ);
+        }
 
-        while (psi > 2.0 * M_PI)
-            psi -= 2.0 * M_PI;
+        /* Asleep there is nothing to process, only a dump to keep going */
+        if (g_MPU6050_AppData.ucPowerState == MPU6050_POWER_SLEEP)
+        {
+            g_MPU6050_AppData.bAttHaveLast = false;
+            MPU6050_RecorderService();
+            continue;
+        }
 
-        while (phi < -2.0 * M_PI)
-            phi += 2.0 * M_PI;
+        MPU6050_StageBegin(MPU6050_STAGE_CONVERT);
+        MPU6050_StreamNewData();
+        MPU6050_StageEnd(MPU6050_STAGE_CONVERT);
 
-        while (theta < -2.0 * M_PI)
-            theta += 2.0 * M_PI;
+        MPU6050_StageBegin(MPU6050_STAGE_RECORD);
+        MPU6050_RecordNewData();
+        MPU6050_StageEnd(MPU6050_STAGE_RECORD);
 
-        while (psi < -2.0 * M_PI)
-            psi += 2.0 * M_PI;
+        /* Attitude is only propagated while a stream publishes it; the DMP's quaternion,
+         * where it sends one, already is the attitude.  Propagation that stops starts
+         * over from its next sample rather than integrate over the gap. */
+        if (MPU6050_StreamContentUsed(MPU6050_STREAM_ATTITUDE) &&
+            (g_MPU6050_AppData.ucDmpFeatures & MPU6050_DMP_FEAT_QUAT))
+        {
+            MPU6050_StageBegin(MPU6050_STAGE_ATTITUDE);
+            if (g_MPU6050_AppData.InData.uiSampleCnt > 0)
+            {
+                MPU6050_Core_SetAttitude(&g_MPU6050_AppData.Core,
+                        &g_MPU6050_AppData.InData.Quats[g_MPU6050_AppData.InData.uiSampleCnt - 1]);
+            }
+            g_MPU6050_AppData.bAttHaveLast = false;
+            MPU6050_StageEnd(MPU6050_STAGE_ATTITUDE);
+        }
+        else if (MPU6050_StreamContentUsed(MPU6050_STREAM_ATTITUDE))
+        {
+            MPU6050_StageBegin(MPU6050_STAGE_ATTITUDE);
+            MPU6050_PropagateAttitude();
+            MPU6050_StageEnd(MPU6050_STAGE_ATTITUDE);
+        }
+        else
+        {
+            g_MPU6050_AppData.bAttHaveLast = false;
+        }
 
-        // Update pose with rotation matrix
-        phi   += (cos(theta)*cos(psi))*delta_phi + (sin(phi)*sin(theta)*cos(psi) - cos(phi)*sin(psi))*delta_theta + (cos(phi)*sin(theta)*cos(psi) + sin(phi)*sin(psi))*delta_psi;
-        theta += (cos(theta)*sin(psi))*delta_phi + (sin(phi)*sin(theta)*sin(psi) + cos(psi)*cos(psi))*delta_theta + (cos(phi)*sin(theta)*sin(psi) - sin(phi)*cos(psi))*delta_psi;
-        psi   += (-sin(theta))*delta_phi         + (sin(phi)*cos(theta))*delta_theta                              + (cos(phi)*cos(theta))*delta_psi;
+        /* Redundant devices are only voted on while a stream publishes the result */
+        if (MPU6050_StreamContentUsed(MPU6050_STREAM_FUSED))
+        {
+            MPU6050_StageBegin(MPU6050_STAGE_FUSE);
+            MPU6050_FusionNewData();
+            MPU6050_StageEnd(MPU6050_STAGE_FUSE);
+        }
 
-        OS_printf("%f %3.3f %3.3f %3.3f %3.3f %3.3f %3.3f\n",
-                dt,
-                phi, theta, psi,
-                delta_phi, delta_theta, delta_psi);
+        MPU6050_StreamCycle();
+        MPU6050_RecorderService();
 
-        lasttimestamp = g_MPU6050_AppData.OutData.timeTag;
+        /* Change rate once this cycle's samples are out under the old one */
+        MPU6050_AdaptRate();
 
-        MPU6050_SendOutData();
+        /* Commands and housekeeping fill the time left before the next tick */
+        if (g_MPU6050_AppData.Sched.iTimerFd >= 0)
+        {
+            MPU6050_ServiceIdle();
+        }
     }
 
     /* Stop Performance Log entry */
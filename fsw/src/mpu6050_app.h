@@ -43,6 +43,16 @@
 #include "mpu6050_perfids.h"
 #include "mpu6050_msgids.h"
 #include "mpu6050_msg.h"
+#include "mpu6050_core.h"
+#include "mpu6050_variant.h"
+#include "mpu6050_vote.h"
+#include "mpu6050_recorder.h"
+#include "mpu6050_trace.h"
+#include "mpu6050_diag.h"
+#include "mpu6050_age.h"
+#include "mpu6050_sched.h"
+#include "mpu6050_rt.h"
+#include "mpu6050_capture.h"
 
 
 
@@ -56,14 +66,172 @@
 ** Local Structure Declarations
 */
 
+/* Output stream content types */
+#define MPU6050_STREAM_LATEST     0  /* MPU6050_OutData_t, newest sample, once per cycle */
+#define MPU6050_STREAM_CALIBRATED 1  /* MPU6050_OutBatch_t                                */
+#define MPU6050_STREAM_RAW        2  /* MPU6050_OutRawBatch_t                             */
+#define MPU6050_STREAM_COMPRESSED 3  /* MPU6050_OutCompBatch_t                            */
+#define MPU6050_STREAM_ATTITUDE   4  /* MPU6050_OutAttBatch_t, once per cycle             */
+#define MPU6050_STREAM_SUMMARY    5  /* MPU6050_OutSummary_t, one entry per window        */
+#define MPU6050_STREAM_FUSED      6  /* MPU6050_OutFusedBatch_t, this device and its peers */
+#define MPU6050_STREAM_QUATERNION 7  /* MPU6050_OutQuatBatch_t, DMP attitude per sample   */
+#define MPU6050_STREAM_CONTENT_CNT 8
+
+/* Phases of bringing the device up, timed for the init event */
+#define MPU6050_INIT_PHASE_OPEN      0  /* Open the bus                                 */
+#define MPU6050_INIT_PHASE_IDENTIFY  1  /* Read WHO_AM_I                                */
+#define MPU6050_INIT_PHASE_CONFIG    2  /* Wake, sample rate, DLPF and scales           */
+#define MPU6050_INIT_PHASE_DMP       3  /* Write and check the DMP image, if any        */
+#define MPU6050_INIT_PHASE_START     4  /* FIFO reset, channels and power state         */
+#define MPU6050_INIT_PHASE_VERIFY    5  /* Read back all of it and WHO_AM_I             */
+#define MPU6050_INIT_PHASE_CNT       6
+
+/* One output stream.  Sample streams take every decimation'th sample (a summary
+** stream summarizes windows of that many samples); once per cycle streams count
+** cycles instead. */
 typedef struct
 {
+    uint32 msgId;            /* 0 leaves the entry unused */
+    uint8  contentType;      /* MPU6050_STREAM_* */
+    uint8  spare;
+    uint16 decimation;       /* 0 is taken as 1 */
+    uint16 batchSize;        /* Entries per packet, ignored by MPU6050_STREAM_LATEST */
+    uint16 batchTimeoutMsec; /* Send a partial packet once its first entry is this old */
+} MPU6050_StreamCfg_t;
+
+/* One sampling rate profile of an adaptive configuration.  Profiles are listed from
+** least to most active.  A profile is entered from below as soon as either motion
+** metric exceeds its enter threshold, and left for the one below once both metrics
+** have stayed under its exit thresholds for motionHoldMsec. */
+typedef struct
+{
+    uint8  sampleRateDiv;     /* SMPLRT_DIV under this profile */
+    uint8  dlpfConfig;        /* CONFIG DLPF_CFG under this profile */
+    uint16 acqRateHz;         /* FIFO drains per second, which sets the samples per read;
+                                 0 keeps the table's, ignored when reading on SCH wakeups */
+    uint16 publishDecimation; /* Extra decimation applied to every stream, 0 is taken as 1 */
+    uint16 spare;
+    float  enterGyroDps;      /* Gyro RMS (degs/sec) that enters this profile */
+    float  enterAccelMg;      /* Accel std-dev (milli-g) that enters this profile */
+    float  exitGyroDps;       /* Both metrics below these to fall back to the one below */
+    float  exitAccelMg;
+} MPU6050_RateProfile_t;
+
+/* Redundancy voting with other MPU6050 app instances.  Each peer publishes a calibrated
+** stream; its samples are voted on and averaged with this device's into the fused
+** streams.  With no peers a fused stream carries this device's samples alone. */
+typedef struct
+{
+    uint32 peerMsgIds[MPU6050_VOTE_MAX_PEERS]; /* Calibrated streams of the peers, 0 unused */
+    float  accelTolMg;        /* Farthest a device may be from the median, per axis */
+    float  gyroTolDps;
+    uint16 maxGapMsec;        /* Interpolate a device only between samples this close */
+    uint16 latencyMsec;       /* Longest a sample waits for the peers before it is fused */
+    uint16 faultPersist;      /* Outliers in a row that fault a device, 0 is taken as 1 */
+    uint16 recoverPersist;    /* Agreements in a row that clear a fault, 0 is taken as 1 */
+} MPU6050_FusionCfg_t;
+
+/* One write to DMP memory once the firmware image is in, such as a feature switch.
+** Addresses and values belong to the image, not to the device. */
+typedef struct
+{
+    uint16 addr;              /* bank << 8 | offset; the bytes stay within the bank */
+    uint8  len;               /* 0 leaves the entry unused */
+    uint8  spare;
+    uint8  data[MPU6050_DMP_PATCH_BYTES];
+} MPU6050_DmpPatch_t;
+
+/* Digital Motion Processor.  The image is loaded into DMP memory at address 0 and run
+** from startAddr; the DMP then fills the FIFO with packets of the given features in
+** place of the samples FIFO_EN would queue. */
+typedef struct
+{
+    char   imagePath[MPU6050_PATH_SIZE]; /* Firmware image; empty leaves the DMP off */
+    uint16 startAddr;         /* Program start address of the image (DMP_CFG_1/2) */
+    uint16 chunkBytes;        /* Largest memory write, for adapters that limit it;
+                                 0 writes a whole bank at a time */
+    uint16 rateAddr;          /* Where the image keeps its output rate divider, 0 if none */
+    uint16 rateDiv;           /* Packets at the sample rate / (1 + rateDiv) */
+    uint8  features;          /* MPU6050_DMP_FEAT_* in each packet, as the patches set up */
+    uint8  spare;
+    uint16 sampleRateHz;      /* Sample rate the image was built for, which the table's
+                                 sampleRateDiv and dlpfConfig must give; 0 for any */
+    MPU6050_DmpPatch_t patches[MPU6050_DMP_MAX_PATCHES]; /* Written in order after the image */
+} MPU6050_DmpCfg_t;
+
+typedef struct
+{
+    uint16 tableVersion;   /* Reported with raw data; bump whenever calibration changes */
     MPU6050_AcceleormeterScale_t initialAccelScale;
     MPU6050_GyroScale_t initialGyroScale;
+    uint8 sampleRateDiv;   /* SMPLRT_DIV: output rate = gyro rate / (1 + div) */
+    uint8 dlpfConfig;      /* CONFIG DLPF_CFG, 0-6; 0 and 7 give an 8 kHz gyro rate */
+    uint8 useFifo;         /* Drain every sample from the FIFO instead of polling */
+    uint8 axisEnable;      /* MPU6050_CHAN_* to sample; the other axes are put in standby */
+    uint16 acqRateHz;      /* Timer-paced reads per second; 0 reads on SCH wakeups */
+    MPU6050_RtCfg_t realtime; /* Priority, policy, CPUs and memory locking of the task */
+    uint8 adaptiveRate;       /* Switch between rateProfiles on motion; 0 keeps the rate above */
+    uint8 rateProfileCnt;     /* Profiles used, at most MPU6050_MAX_RATE_PROFILES */
+    uint16 motionWindowMsec;  /* Window the motion metrics are measured over */
+    uint16 motionHoldMsec;    /* Quiet time before stepping down a profile */
+    MPU6050_RateProfile_t rateProfiles[MPU6050_MAX_RATE_PROFILES];
+    uint8 powerState;         /* MPU6050_POWER_* to start in; commands change it after */
+    uint8 cycleWakeRate;      /* LPWake* code for MPU6050_POWER_CYCLE */
+    MPU6050_StreamCfg_t streams[MPU6050_MAX_STREAMS];
+    MPU6050_FusionCfg_t fusion; /* Used while a stream carries MPU6050_STREAM_FUSED */
+    MPU6050_DmpCfg_t dmp;       /* Loaded by MPU6050_InitDevice; needs useFifo */
+    MPU6050_Calibration_t calibration;
+    char recorderPath[MPU6050_PATH_SIZE]; /* Empty to turn the recorder off */
+    uint32 recorderBlocks;   /* File size in MPU6050_REC_BLOCK_BYTES blocks, 0 turns it off */
+    uint16 recorderSyncMsec; /* Interval between msyncs of the recorder file */
     uint8 deviceI2CAddr;
     char devicePath[MPU6050_PATH_SIZE];
 } MPU6050_ConfigTbl_t;
 
+/* Dispatch priorities, most urgent first */
+#define MPU6050_DISPATCH_PRIO_URGENT  0  /* Handled as soon as it is received         */
+#define MPU6050_DISPATCH_PRIO_HIGH    1  /* Handled after everything urgent received */
+#define MPU6050_DISPATCH_PRIO_NORMAL  2
+#define MPU6050_DISPATCH_PRIO_CNT     3
+
+/* Message held back by the consolidated dispatch until the urgent ones are handled */
+typedef struct
+{
+    uint16 usHandler;  /* Index into the dispatch table */
+    uint16 usSize;
+    uint64 auiMsg[MPU6050_DISPATCH_MSG_BYTES / sizeof(uint64)];
+} MPU6050_Deferred_t;
+
+/* Run time state of one output stream */
+typedef struct
+{
+    CFE_SB_Buffer_t     *BufPtr;      /* SB buffer the packet is built in, or NULL */
+    MPU6050_StreamPkt_t *PktPtr;      /* Packet being filled: BufPtr or Fallback */
+    CFE_SB_MsgId_t       MsgId;       /* Latched with the content type when a packet starts */
+    uint8                ucContent;
+    uint16               usCnt;       /* Entries in the packet being filled */
+    uint16               usSkipCnt;   /* Samples (or cycles) to drop before the next entry */
+    uint32               uiCounter;   /* Packets sent */
+    uint64               uiNextIdx;   /* Sample index the next entry must have */
+    double               dStartTime;  /* Monotonic time of the first entry */
+    CFE_TIME_SysTime_t   baseTime;    /* Time of the first entry */
+    CFE_TIME_SysTime_t   lastTime;    /* Time of the newest entry */
+
+    /* Summary window being accumulated */
+    uint16               usWinCnt;
+    int64                aiWinSum[MPU6050_COMP_CHANNELS];
+    MPU6050_RawSample_t  WinMin;
+    MPU6050_RawSample_t  WinMax;
+    uint64               uiWinIdx;
+    CFE_TIME_SysTime_t   winTime;
+
+    /* Compressed streams collect raw samples here and code them on send */
+    MPU6050_RawSample_t  Staging[MPU6050_MAX_BATCH_SAMPLES];
+
+    /* Holds the packet when SB has no buffer to give */
+    MPU6050_StreamPkt_t  Fallback;
+} MPU6050_Stream_t;
+
 typedef struct
 {
     /* OS level file ID for read/write/ioctl calls */
@@ -87,24 +255,106 @@ typedef struct
     uint16           usTlmPipeDepth;
     char             cTlmPipeName[OS_MAX_API_NAME];
 
+    /* CFE pipe taking the place of the three above with MPU6050_DISPATCH_SINGLE_PIPE */
+    CFE_SB_PipeId_t    DispatchPipeId;
+    uint16             usDispatchPipeDepth;
+    char               cDispatchPipeName[OS_MAX_API_NAME];
+    MPU6050_Deferred_t Deferred[MPU6050_DISPATCH_BUDGET];
+
+    /* SB receive calls made so far in this cycle */
+    uint32           uiSbRcvCnt;
+
     CFE_TBL_Handle_t     ConfigTblHandle;
     MPU6050_ConfigTbl_t *ConfigTbl;
 
     /* Task-related */
     uint32  uiRunStatus;
 
+    /* Fixed rate tick that paces device reads, when the table asks for one, and the
+       ticks since the SCH pipe was last serviced */
+    MPU6050_Sched_t  Sched;
+    uint16           usIdleDeferTicks;
+
     /* Input data - from I/O devices or subscribed from other apps' output data.
        Data structure should be defined in mpu6050/fsw/src/mpu6050_private_types.h */
     MPU6050_InData_t   InData;
 
+    /* Processing state: conversion settings, the sensor clock model used to time
+       stamp FIFO samples, motion metrics, and the attitude propagated sample by
+       sample while an attitude stream is configured, with the latch time (monotonic
+       s) of the last sample it was propagated to, if any */
+    MPU6050_Core_t     Core;
+    double             dAttLastTime;
+    bool               bAttHaveLast;
+
+    /* Rate profile in effect (MPU6050_RATE_PROFILE_FIXED unless adaptive), and the
+       motion and quiet time that decide the next one */
+    uint8              ucRateProfile;
+    uint8              ucRateProfileCnt;
+    uint16             usPublishDecimation;
+    uint32             uiQuietMsec;
+
+    /* Chip found behind the bus, by its WHO_AM_I, and how long each phase of the last
+       init of it took (us) */
+    const MPU6050_Variant_t *VariantPtr;
+    uint32             auiInitPhaseUsec[MPU6050_INIT_PHASE_CNT];
+
+    /* Device power state, time spent in each (CLOCK_MONOTONIC ns), and the start of
+       the wake-up whose first sample is awaited (0 if none) */
+    uint8              ucPowerState;
+    uint8              ucWakeRate;
+    uint64             uiPowerStateStartNsec;
+    uint64             auiPowerStateNsec[MPU6050_POWER_STATE_CNT];
+    uint64             uiWakeStartNsec;
+
+    /* Channels sampled now (the table's, less those the power state idles), the
+       table mask they came from, and the channels and bytes of a FIFO sample */
+    uint8              ucChannelMask;
+    uint8              ucAxisEnable;
+    uint8              ucFifoChannels;
+    uint8              ucFifoSampleBytes;
+
+    /* DMP firmware image read at startup, kept to load it again after a device reset,
+       and whether the DMP is running, with the features of its packets */
+    uint8              aucDmpImage[MPU6050_DMP_MEM_SIZE];
+    uint32             uiDmpImageBytes;
+    bool               bDmpOn;
+    uint8              ucDmpFeatures;
+
     /* Output data - to be published at the end of a Wakeup cycle.
        Data structure should be defined in mpu6050/fsw/src/mpu6050_private_types.h */
     MPU6050_OutData_t  OutData;
 
+    /* Output streams, one per stream table entry.  Each packet is filled directly in
+       an SB message buffer as entries are taken, and sent when full or timed out. */
+    MPU6050_Stream_t   Streams[MPU6050_MAX_STREAMS];
+
+    /* Onboard recorder of the raw sample stream */
+    MPU6050_Recorder_t Recorder;
+
+    /* Redundancy voting of this device (member 0) with the peers subscribed to, in
+       table order, and the fused samples of the cycle on their way to the streams */
+    MPU6050_Vote_t     Vote;
+    uint32             auiPeerMsgIds[MPU6050_VOTE_MAX_PEERS];
+    uint32             uiPeerCnt;
+    MPU6050_VoteOut_t  FusedOut[MPU6050_FIFO_MAX_SAMPLES];
+
+#if MPU6050_TRACE_LEVEL > MPU6050_TRACE_LEVEL_OFF
+    /* Trace records of the main task */
+    MPU6050_TraceRing_t TraceRing;
+#endif
+
     /* Housekeeping telemetry - for downlink only.
        Data structure should be defined in mpu6050/fsw/src/mpu6050_msg.h */
     MPU6050_HkTlm_t  HkTlm;
 
+    /* Timing diagnostics, and the CLOCK_MONOTONIC start of each stage in progress */
+    MPU6050_DiagTlm_t DiagTlm;
+    uint64            auiStageStartNsec[MPU6050_STAGE_CNT];
+
+    /* Age of the latest sample packets when their transmit completes */
+    MPU6050_AgeTracker_t SampleAge;
+
     /* TODO:  Add declarations for additional private data here */
 } MPU6050_AppData_t;
 
@@ -128,20 +378,72 @@ int32 MPU6050_InitEvent(void);
 int32 MPU6050_InitData(void);
 int32 MPU6050_InitPipe(void);
 int32 MPU6050_InitDevice(void);
+int32 MPU6050_ConfigDevice(void);
+int32 MPU6050_ConfigChannels(uint8, uint8, MPU6050_RegList_t *);
+int32 MPU6050_RestartDevice(void);
+int32 MPU6050_StartCapture(const char*);
+int32 MPU6050_SetPowerState(uint8, uint8);
+void  MPU6050_RestartSampling(void);
+uint32 MPU6050_AcqPeriodNsec(void);
+void  MPU6050_StartTick(void);
 
 void  MPU6050_AppMain(void);
 
 void  MPU6050_CleanupCallback(void);
 
 int32  MPU6050_RcvMsg(int32 iBlocking);
+int32 MPU6050_InitSched(void);
+int32 MPU6050_InitRealtime(void);
+void  MPU6050_WaitTick(void);
+void  MPU6050_ServiceIdle(void);
+int32 MPU6050_InitRateProfiles(void);
+int32 MPU6050_ApplyRateProfile(uint8);
+void  MPU6050_AdaptRate(void);
 
 void  MPU6050_ReadDevice(void);
+CFE_TIME_SysTime_t MPU6050_GetSampleTime(uint32 SampleNum);
+void  MPU6050_PropagateAttitude(void);
+void  MPU6050_ConfigureCore(void);
+void  MPU6050_SetScale(uint8, uint8);
 void  MPU6050_ProcessNewData(void);
 void  MPU6050_ProcessNewCmds(void);
+void  MPU6050_ProcessSendHk(void);
 void  MPU6050_ProcessNewAppCmds(CFE_MSG_Message_t*);
 
 void  MPU6050_ReportHousekeeping(void);
-void  MPU6050_SendOutData(void);
+void  MPU6050_ReportDiagnostics(void);
+void  MPU6050_ResetDiagnostics(void);
+void  MPU6050_StageBegin(uint32);
+void  MPU6050_StageEnd(uint32);
+void  MPU6050_SendOutData(CFE_SB_MsgId_t);
+
+int32 MPU6050_InitStreams(void);
+void  MPU6050_FlushStreams(void);
+bool  MPU6050_StreamContentUsed(uint8);
+void  MPU6050_StreamNewData(void);
+void  MPU6050_StreamCycle(void);
+void  MPU6050_StartStream(uint32);
+void  MPU6050_SendStream(uint32);
+void  MPU6050_StreamFused(const MPU6050_VoteOut_t*, uint32);
+void  MPU6050_CleanupStreams(void);
+
+int32 MPU6050_InitFusion(void);
+int32 MPU6050_FusionPeerNum(CFE_SB_MsgId_t);
+void  MPU6050_FusionPeerData(CFE_SB_Buffer_t*);
+void  MPU6050_FusionNewData(void);
+uint64 MPU6050_TimeToNsec(CFE_TIME_SysTime_t);
+CFE_TIME_SysTime_t MPU6050_NsecToTime(uint64);
+
+int32 MPU6050_DmpLoadImage(void);
+int32 MPU6050_DmpStart(void);
+uint32 MPU6050_DmpDecimation(void);
+
+int32 MPU6050_InitDispatchPipe(void);
+void  MPU6050_Dispatch(CFE_SB_Buffer_t*);
+
+CFE_SB_Buffer_t *MPU6050_AllocPacket(CFE_MSG_Size_t);
+void  MPU6050_TransmitPacket(CFE_SB_Buffer_t*, bool);
+void  MPU6050_TransmitCopy(CFE_MSG_Message_t*, CFE_MSG_Size_t);
 
 bool  MPU6050_VerifyCmdLength(CFE_MSG_Message_t*, uint16);
 
@@ -0,0 +1,337 @@
+/*=======================================================================================
+** File Name:  mpu6050_capture.c
+**
+** Title:  Bus Capture and Replay for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To record every transfer with the device, with its time, and to stand in
+**           for the device by playing a recording back.
+**
+** Functions Defined:
+**    MPU6050_Capture_Start      - Open a capture file and start recording a handle
+**    MPU6050_Capture_Stop       - Stop recording and close the file
+**    MPU6050_Capture_Active     - Whether a handle is being recorded
+**    MPU6050_Capture_Transfer   - Record one transfer
+**    MPU6050_Replay_Open        - Load a capture file to play back
+**    MPU6050_Replay_Close       - Release it
+**    MPU6050_Replay_IsReplay    - Whether a handle is a playback
+**    MPU6050_Replay_Write       - Take the next recorded write
+**    MPU6050_Replay_Read        - Give the bytes of the next recorded read
+**    MPU6050_Replay_TimeNsec    - Recorded time of the last transfer played
+**    MPU6050_Replay_MismatchCnt - Transfers that did not match the recording
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Records go through a stdio buffer, so the bus path only pays for a copy until
+**    the buffer fills.  Everything is kept in host byte order.
+** 2: One capture and one playback at a time.
+** 3: Playback is driven by the reader: transfers are matched to the recording in
+**    order, by direction.  A write that differs, or a recorded transfer the reader
+**    skips, counts as a mismatch and playback carries on from the next one.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mpu6050_capture.h"
+#include "mpu6050_diag.h"
+
+/*
+** Local Defines
+*/
+#define MPU6050_CAP_STDIO_BYTES  (64 * 1024)
+
+/*
+** Local Structure Declarations
+*/
+typedef struct
+{
+    FILE   *FilePtr;
+    int     iFd;               /* Handle being recorded */
+    uint32  uiRecCnt;
+    bool    bWriteErr;
+    char    acBuf[MPU6050_CAP_STDIO_BYTES];
+} MPU6050_Capture_t;
+
+typedef struct
+{
+    bool    bOpen;
+    uint8  *pucData;           /* Whole capture file */
+    uint32  uiSize;
+    uint32  uiPos;             /* Offset of the next record */
+    uint64  uiTimeNsec;
+    uint32  uiMismatchCnt;
+} MPU6050_Replay_t;
+
+/*
+** Local Variables
+*/
+static MPU6050_Capture_t MPU6050_Cap = {.FilePtr = NULL, .iFd = -1};
+static MPU6050_Replay_t  MPU6050_Replay;
+
+/*
+** Local Function Definitions
+*/
+
+/* Next recorded transfer in direction Dir; false at the end.  Records are packed, so
+ * headers are copied out rather than accessed in place. */
+static bool MPU6050_Replay_Next(uint8 Dir, MPU6050_CapRecHdr_t *RecPtr, const uint8 **BytesPtr)
+{
+    MPU6050_Replay_t *repPtr = &MPU6050_Replay;
+
+    while (repPtr->uiPos + sizeof(*RecPtr) <= repPtr->uiSize)
+    {
+        memcpy(RecPtr, &repPtr->pucData[repPtr->uiPos], sizeof(*RecPtr));
+        if (repPtr->uiPos + sizeof(*RecPtr) + RecPtr->usLen > repPtr->uiSize)
+        {
+            break;
+        }
+
+        *BytesPtr      = &repPtr->pucData[repPtr->uiPos + sizeof(*RecPtr)];
+        repPtr->uiPos += sizeof(*RecPtr) + RecPtr->usLen;
+        if (RecPtr->ucDir == Dir)
+        {
+            repPtr->uiTimeNsec = RecPtr->uiTimeNsec;
+            return true;
+        }
+
+        repPtr->uiMismatchCnt++;
+    }
+
+    errno = ENODATA;
+    return false;
+}
+
+/*
+** Function Definitions
+*/
+
+/* Start recording the transfers on Fd to Path.  HdrPtr gives the device address and
+ * configuration registers; the rest of the header is filled in here. */
+int32 MPU6050_Capture_Start(int Fd, const char *Path, const MPU6050_CapFileHdr_t *HdrPtr)
+{
+    MPU6050_Capture_t   *capPtr = &MPU6050_Cap;
+    MPU6050_CapFileHdr_t hdr    = *HdrPtr;
+
+    if (capPtr->FilePtr != NULL)
+    {
+        errno = EBUSY;
+        return -1;
+    }
+
+    capPtr->FilePtr = fopen(Path, "wb");
+    if (capPtr->FilePtr == NULL)
+    {
+        return -1;
+    }
+    setvbuf(capPtr->FilePtr, capPtr->acBuf, _IOFBF, sizeof(capPtr->acBuf));
+
+    hdr.uiMagic     = MPU6050_CAP_MAGIC;
+    hdr.usVersion   = MPU6050_CAP_VERSION;
+    hdr.usHdrBytes  = sizeof(hdr);
+    hdr.uiStartNsec = MPU6050_DiagNow();
+
+    capPtr->iFd       = Fd;
+    capPtr->uiRecCnt  = 0;
+    capPtr->bWriteErr = fwrite(&hdr, sizeof(hdr), 1, capPtr->FilePtr) != 1;
+
+    return 0;
+}
+
+/* Stop recording.  Returns the transfers recorded, or -1 if any could not be written. */
+int32 MPU6050_Capture_Stop(void)
+{
+    MPU6050_Capture_t *capPtr = &MPU6050_Cap;
+    bool               err;
+
+    if (capPtr->FilePtr == NULL)
+    {
+        return 0;
+    }
+
+    err = (fclose(capPtr->FilePtr) != 0) || capPtr->bWriteErr;
+    capPtr->FilePtr = NULL;
+    capPtr->iFd     = -1;
+
+    return err ? -1 : (int32) capPtr->uiRecCnt;
+}
+
+bool MPU6050_Capture_Active(int Fd)
+{
+    return MPU6050_Cap.FilePtr != NULL && MPU6050_Cap.iFd == Fd;
+}
+
+void MPU6050_Capture_Transfer(uint8 Dir, const uint8 *Buf, int32 Len, uint64 TimeNsec)
+{
+    MPU6050_Capture_t  *capPtr = &MPU6050_Cap;
+    MPU6050_CapRecHdr_t rec;
+
+    /* Failed transfers moved nothing */
+    if (capPtr->FilePtr == NULL || Len <= 0)
+    {
+        return;
+    }
+
+    memset(&rec, 0x00, sizeof(rec));
+    rec.uiTimeNsec = TimeNsec;
+    rec.ucDir      = Dir;
+    rec.usLen      = (uint16) Len;
+
+    if (fwrite(&rec, sizeof(rec), 1, capPtr->FilePtr) != 1 ||
+        fwrite(Buf, rec.usLen, 1, capPtr->FilePtr) != 1)
+    {
+        capPtr->bWriteErr = true;
+    }
+
+    capPtr->uiRecCnt++;
+}
+
+/* Load a capture to play back in place of a device; -1 if it cannot be read or is not
+ * a capture */
+int MPU6050_Replay_Open(const char *Path)
+{
+    MPU6050_Replay_t     *repPtr = &MPU6050_Replay;
+    MPU6050_CapFileHdr_t *hdrPtr;
+    FILE *filePtr;
+    long  size;
+
+    if (repPtr->bOpen)
+    {
+        errno = EMFILE;
+        return -1;
+    }
+
+    filePtr = fopen(Path, "rb");
+    if (filePtr == NULL)
+    {
+        return -1;
+    }
+
+    if (fseek(filePtr, 0, SEEK_END) != 0 || (size = ftell(filePtr)) < (long) sizeof(*hdrPtr) ||
+        fseek(filePtr, 0, SEEK_SET) != 0 || (repPtr->pucData = malloc((size_t) size)) == NULL)
+    {
+        fclose(filePtr);
+        errno = EINVAL;
+        return -1;
+    }
+
+    if (fread(repPtr->pucData, (size_t) size, 1, filePtr) != 1)
+    {
+        fclose(filePtr);
+        free(repPtr->pucData);
+        errno = EIO;
+        return -1;
+    }
+    fclose(filePtr);
+
+    hdrPtr = (MPU6050_CapFileHdr_t*) repPtr->pucData;
+    if (hdrPtr->uiMagic != MPU6050_CAP_MAGIC || hdrPtr->usVersion != MPU6050_CAP_VERSION ||
+        hdrPtr->usHdrBytes != sizeof(*hdrPtr))
+    {
+        free(repPtr->pucData);
+        errno = EINVAL;
+        return -1;
+    }
+
+    repPtr->bOpen         = true;
+    repPtr->uiSize        = (uint32) size;
+    repPtr->uiPos         = sizeof(*hdrPtr);
+    repPtr->uiTimeNsec    = hdrPtr->uiStartNsec;
+    repPtr->uiMismatchCnt = 0;
+
+    return MPU6050_REPLAY_FD_BASE;
+}
+
+void MPU6050_Replay_Close(int Fd)
+{
+    if (MPU6050_Replay_IsReplay(Fd))
+    {
+        free(MPU6050_Replay.pucData);
+        memset(&MPU6050_Replay, 0x00, sizeof(MPU6050_Replay));
+    }
+}
+
+bool MPU6050_Replay_IsReplay(int Fd)
+{
+    return Fd == MPU6050_REPLAY_FD_BASE && MPU6050_Replay.bOpen;
+}
+
+int32 MPU6050_Replay_Write(int Fd, const uint8 *Buf, uint32 Len)
+{
+    MPU6050_CapRecHdr_t rec;
+    const uint8        *bytes;
+
+    if (!MPU6050_Replay_IsReplay(Fd))
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    if (!MPU6050_Replay_Next(MPU6050_CAP_DIR_WRITE, &rec, &bytes))
+    {
+        return -1;
+    }
+
+    if (rec.usLen != Len || memcmp(bytes, Buf, Len) != 0)
+    {
+        MPU6050_Replay.uiMismatchCnt++;
+    }
+
+    return (int32) Len;
+}
+
+int32 MPU6050_Replay_Read(int Fd, uint8 *Buf, uint32 Len)
+{
+    MPU6050_CapRecHdr_t rec;
+    const uint8        *bytes;
+    uint32              n;
+
+    if (!MPU6050_Replay_IsReplay(Fd))
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    if (!MPU6050_Replay_Next(MPU6050_CAP_DIR_READ, &rec, &bytes))
+    {
+        return -1;
+    }
+
+    /* A read of a different length gets what was recorded, then zeros */
+    n = (rec.usLen < Len) ? rec.usLen : Len;
+    memcpy(Buf, bytes, n);
+    memset(Buf + n, 0x00, Len - n);
+    if (rec.usLen != Len)
+    {
+        MPU6050_Replay.uiMismatchCnt++;
+    }
+
+    return (int32) Len;
+}
+
+uint64 MPU6050_Replay_TimeNsec(int Fd)
+{
+    return MPU6050_Replay_IsReplay(Fd) ? MPU6050_Replay.uiTimeNsec : 0;
+}
+
+uint32 MPU6050_Replay_MismatchCnt(int Fd)
+{
+    return MPU6050_Replay_IsReplay(Fd) ? MPU6050_Replay.uiMismatchCnt : 0;
+}
+
+/*=======================================================================================
+** End of file mpu6050_capture.c
+**=====================================================================================*/
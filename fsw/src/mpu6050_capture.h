@@ -0,0 +1,89 @@
+/*=======================================================================================
+** File Name:  mpu6050_capture.h
+**
+** Title:  Bus Capture and Replay Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the capture file format and the functions that write one from
+**           the live bus and play one back in its place.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_CAPTURE_H_
+#define _MPU6050_CAPTURE_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*
+** Local Defines
+*/
+#define MPU6050_CAP_MAGIC        0x5041434D  /* "MCAP" */
+#define MPU6050_CAP_VERSION      1
+#define MPU6050_CAP_REG_CNT      128
+
+/* Transfer directions */
+#define MPU6050_CAP_DIR_WRITE    0
+#define MPU6050_CAP_DIR_READ     1
+
+/* Handles given out by MPU6050_Replay_Open, far above any real file descriptor */
+#define MPU6050_REPLAY_FD_BASE   0x52504C00
+
+/*
+** Local Structure Declarations
+*/
+
+/* Start of a capture file.  Followed by the transfers in bus order, each a
+** MPU6050_CapRecHdr_t and usLen bytes. */
+typedef struct
+{
+    uint32  uiMagic;           /* MPU6050_CAP_MAGIC */
+    uint16  usVersion;         /* MPU6050_CAP_VERSION */
+    uint16  usHdrBytes;        /* sizeof(MPU6050_CapFileHdr_t) */
+    uint64  uiStartNsec;       /* CLOCK_MONOTONIC when the capture started */
+    uint8   ucDeviceAddr;
+    uint8   aucSpare[7];
+    uint8   aucReg[MPU6050_CAP_REG_CNT];  /* Configuration registers at the start;
+                                             data, FIFO and status registers are 0 */
+} MPU6050_CapFileHdr_t;
+
+typedef struct
+{
+    uint64  uiTimeNsec;        /* CLOCK_MONOTONIC when the transfer completed */
+    uint8   ucDir;             /* MPU6050_CAP_DIR_* */
+    uint8   ucSpare;
+    uint16  usLen;             /* Bytes transferred; for a write the first selects the register */
+    uint32  uiSpare;
+} MPU6050_CapRecHdr_t;
+
+/*
+** Local Function Prototypes
+*/
+int32  MPU6050_Capture_Start(int Fd, const char *Path, const MPU6050_CapFileHdr_t *HdrPtr);
+int32  MPU6050_Capture_Stop(void);
+bool   MPU6050_Capture_Active(int Fd);
+void   MPU6050_Capture_Transfer(uint8 Dir, const uint8 *Buf, int32 Len, uint64 TimeNsec);
+
+int    MPU6050_Replay_Open(const char *Path);
+void   MPU6050_Replay_Close(int Fd);
+bool   MPU6050_Replay_IsReplay(int Fd);
+int32  MPU6050_Replay_Write(int Fd, const uint8 *Buf, uint32 Len);
+int32  MPU6050_Replay_Read(int Fd, uint8 *Buf, uint32 Len);
+uint64 MPU6050_Replay_TimeNsec(int Fd);
+uint32 MPU6050_Replay_MismatchCnt(int Fd);
+
+#endif /* _MPU6050_CAPTURE_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_capture.h
+**=====================================================================================*/
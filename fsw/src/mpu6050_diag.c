@@ -0,0 +1,144 @@
+/*=======================================================================================
+** File Name:  mpu6050_diag.c
+**
+** Title:  Timing Diagnostics for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To keep log-bucketed latency histograms and interval jitter, measured with
+**           CLOCK_MONOTONIC.
+**
+** Functions Defined:
+**    MPU6050_DiagNow         - CLOCK_MONOTONIC in nanoseconds
+**    MPU6050_Hist_Reset      - Empty a histogram
+**    MPU6050_Hist_Add        - Count one duration
+**    MPU6050_Hist_Percentile - Upper bound on a percentile of the counted durations
+**    MPU6050_Jitter_Init     - Set the nominal interval and forget the last event
+**    MPU6050_Jitter_Add      - Count the interval ending at an event
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Adding a duration is a clz and a few adds, cheap enough for every stage of every
+**    cycle.  Percentiles are only resolved to a power of two.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <string.h>
+#include <time.h>
+
+#include "mpu6050_diag.h"
+
+/*
+** Local Function Definitions
+*/
+
+uint64 MPU6050_DiagNow(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64) now.tv_sec * 1000000000ull + (uint64) now.tv_nsec;
+}
+
+void MPU6050_Hist_Reset(MPU6050_Histogram_t *HistPtr)
+{
+    memset(HistPtr, 0x00, sizeof(*HistPtr));
+    HistPtr->uiMinNsec = 0xFFFFFFFF;
+}
+
+void MPU6050_Hist_Add(MPU6050_Histogram_t *HistPtr, uint64 Nsec)
+{
+    uint32 nsec   = (Nsec > 0xFFFFFFFFull) ? 0xFFFFFFFF : (uint32) Nsec;
+    uint32 bucket = (nsec < 2) ? 0 : 31 - (uint32) __builtin_clz(nsec);
+
+    if (bucket >= MPU6050_HIST_BUCKETS)
+    {
+        bucket = MPU6050_HIST_BUCKETS - 1;
+    }
+
+    HistPtr->auiBucket[bucket]++;
+    HistPtr->uiCount++;
+    HistPtr->uiSumNsec += nsec;
+
+    if (nsec < HistPtr->uiMinNsec)
+    {
+        HistPtr->uiMinNsec = nsec;
+    }
+
+    if (nsec > HistPtr->uiMaxNsec)
+    {
+        HistPtr->uiMaxNsec = nsec;
+    }
+}
+
+uint32 MPU6050_Hist_Percentile(const MPU6050_Histogram_t *HistPtr, double Pct)
+{
+    uint64 rank;
+    uint64 seen = 0;
+    uint32 b;
+
+    if (HistPtr->uiCount == 0)
+    {
+        return 0;
+    }
+
+    /* Smallest bucket holding at least Pct percent of the counts */
+    rank = (uint64) (Pct / 100.0 * HistPtr->uiCount + 0.5);
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+
+    for (b = 0; b < MPU6050_HIST_BUCKETS; b++)
+    {
+        seen += HistPtr->auiBucket[b];
+        if (seen >= rank)
+        {
+            break;
+        }
+    }
+
+    /* The bucket's upper edge, but never beyond the largest value actually seen */
+    if (b >= 31 || (2u << b) - 1 > HistPtr->uiMaxNsec)
+    {
+        return HistPtr->uiMaxNsec;
+    }
+
+    return (2u << b) - 1;
+}
+
+void MPU6050_Jitter_Init(MPU6050_Jitter_t *JitterPtr, uint32 PeriodNsec)
+{
+    JitterPtr->uiLastNsec   = 0;
+    JitterPtr->uiPeriodNsec = PeriodNsec;
+    MPU6050_Hist_Reset(&JitterPtr->Hist);
+}
+
+void MPU6050_Jitter_Add(MPU6050_Jitter_t *JitterPtr, uint64 NowNsec)
+{
+    uint64 interval;
+
+    if (JitterPtr->uiLastNsec != 0 && NowNsec >= JitterPtr->uiLastNsec)
+    {
+        interval = NowNsec - JitterPtr->uiLastNsec;
+        MPU6050_Hist_Add(&JitterPtr->Hist, (interval > JitterPtr->uiPeriodNsec) ?
+                                           interval - JitterPtr->uiPeriodNsec :
+                                           JitterPtr->uiPeriodNsec - interval);
+    }
+
+    JitterPtr->uiLastNsec = NowNsec;
+}
+
+/*=======================================================================================
+** End of file mpu6050_diag.c
+**=====================================================================================*/
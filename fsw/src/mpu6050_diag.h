@@ -0,0 +1,83 @@
+/*=======================================================================================
+** File Name:  mpu6050_diag.h
+**
+** Title:  Timing Diagnostics Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the latency histograms and jitter trackers used to account for
+**           where each processing cycle spends its time.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_DIAG_H_
+#define _MPU6050_DIAG_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*
+** Local Defines
+*/
+
+/* Bucket b counts durations of [2^b, 2^(b+1)) ns; bucket 0 also counts 0 and 1 ns,
+** the last bucket everything from 2^31 ns (about 2.1 s) up */
+#define MPU6050_HIST_BUCKETS  32
+
+/* Instrumented stages of a processing cycle */
+#define MPU6050_STAGE_READ      0  /* Device read, MPU6050_ReadDevice                     */
+#define MPU6050_STAGE_CONVERT   1  /* Stream conversion and batching, MPU6050_StreamNewData */
+#define MPU6050_STAGE_RECORD    2  /* Onboard recorder, MPU6050_RecordNewData              */
+#define MPU6050_STAGE_ATTITUDE  3  /* Attitude propagation                                 */
+#define MPU6050_STAGE_FUSE      4  /* Redundancy voting, MPU6050_FusionNewData            */
+#define MPU6050_STAGE_PUBLISH   5  /* SB transmit, nested in the stages above              */
+#define MPU6050_STAGE_CYCLE     6  /* Wakeup to the end of the cycle                       */
+#define MPU6050_STAGE_CNT       7
+
+/*
+** Local Structure Declarations
+*/
+
+/* Log-bucketed latency histogram */
+typedef struct
+{
+    uint32  uiCount;
+    uint32  uiMinNsec;
+    uint32  uiMaxNsec;         /* Worst case since the last reset */
+    uint32  uiSpare;
+    uint64  uiSumNsec;
+    uint32  auiBucket[MPU6050_HIST_BUCKETS];
+} MPU6050_Histogram_t;
+
+/* Deviation of the interval between events from its nominal value */
+typedef struct
+{
+    uint64  uiLastNsec;        /* Previous event, 0 before the first */
+    uint32  uiPeriodNsec;      /* Nominal interval */
+    MPU6050_Histogram_t Hist;  /* |interval - nominal| */
+} MPU6050_Jitter_t;
+
+/*
+** Local Function Prototypes
+*/
+uint64 MPU6050_DiagNow(void);
+void   MPU6050_Hist_Reset(MPU6050_Histogram_t *HistPtr);
+void   MPU6050_Hist_Add(MPU6050_Histogram_t *HistPtr, uint64 Nsec);
+uint32 MPU6050_Hist_Percentile(const MPU6050_Histogram_t *HistPtr, double Pct);
+void   MPU6050_Jitter_Init(MPU6050_Jitter_t *JitterPtr, uint32 PeriodNsec);
+void   MPU6050_Jitter_Add(MPU6050_Jitter_t *JitterPtr, uint64 NowNsec);
+
+#endif /* _MPU6050_DIAG_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_diag.h
+**=====================================================================================*/
@@ -0,0 +1,352 @@
+/*=======================================================================================
+** File Name:  mpu6050_dispatch.c
+**
+** Title:  Consolidated Message Dispatch for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To take wakeups, commands and subscribed data off a single pipe and hand
+**           them to handlers by MID, most urgent first.
+**
+** Functions Defined:
+**    MPU6050_InitDispatchPipe - Create the pipe and subscribe it to every handled MID
+**    MPU6050_Dispatch         - Handle a received message and whatever else is waiting
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Only built into the cycle with MPU6050_DISPATCH_SINGLE_PIPE.  One SB receive is
+**    made per message plus one to find the pipe empty, instead of one per pipe.
+** 2: At most MPU6050_DISPATCH_BUDGET messages are taken per cycle; the rest wait on
+**    the pipe for the next one.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Pragmas
+*/
+
+/*
+** Include Files
+*/
+#include <string.h>
+
+#include "cfe.h"
+#include "cfe_evs.h"
+#include "cfe_msg.h"
+#include "cfe_sb.h"
+#include "mpu6050_app.h"
+
+/*
+** Local Defines
+*/
+
+/*
+** Local Structure Declarations
+*/
+typedef struct
+{
+    uint32  MsgId;
+    uint8   ucPriority;  /* MPU6050_DISPATCH_PRIO_* */
+    void  (*Handler)(CFE_SB_Buffer_t *BufPtr);
+} MPU6050_DispatchEntry_t;
+
+/*
+** External Global Variables
+*/
+extern MPU6050_AppData_t  g_MPU6050_AppData;
+
+/*
+** Global Variables
+*/
+
+/*
+** Local Function Prototypes
+*/
+static void MPU6050_DispatchWakeup(CFE_SB_Buffer_t *BufPtr);
+static void MPU6050_DispatchSendHk(CFE_SB_Buffer_t *BufPtr);
+static void MPU6050_DispatchCmd(CFE_SB_Buffer_t *BufPtr);
+static void MPU6050_DispatchPeer(CFE_SB_Buffer_t *BufPtr);
+
+/*
+** Local Variables
+*/
+
+/* Handlers by MID.  Subscribed data from other apps gets an entry here too.  MID 0
+** stands for the fusion peers in the table, which MPU6050_InitFusion subscribes to;
+** their packets are too large to hold back, and only copied when handled. */
+static const MPU6050_DispatchEntry_t MPU6050_DispatchTbl[] =
+{
+    {MPU6050_WAKEUP_MID,  MPU6050_DISPATCH_PRIO_URGENT, MPU6050_DispatchWakeup},
+    {MPU6050_SEND_HK_MID, MPU6050_DISPATCH_PRIO_HIGH,   MPU6050_DispatchSendHk},
+    {MPU6050_CMD_MID,     MPU6050_DISPATCH_PRIO_NORMAL, MPU6050_DispatchCmd},
+    {0,                   MPU6050_DISPATCH_PRIO_URGENT, MPU6050_DispatchPeer},
+};
+
+#define MPU6050_DISPATCH_TBL_CNT  (sizeof(MPU6050_DispatchTbl) / sizeof(MPU6050_DispatchTbl[0]))
+
+/*
+** Local Function Definitions
+*/
+
+/* A wakeup reads the device, unless the acquisition tick does that */
+static void MPU6050_DispatchWakeup(CFE_SB_Buffer_t *BufPtr)
+{
+    (void) BufPtr;
+
+    if (g_MPU6050_AppData.Sched.iTimerFd >= 0)
+    {
+        return;
+    }
+
+    MPU6050_Jitter_Add(&g_MPU6050_AppData.DiagTlm.WakeJitter,
+                       g_MPU6050_AppData.auiStageStartNsec[MPU6050_STAGE_CYCLE]);
+    MPU6050_StageBegin(MPU6050_STAGE_READ);
+    MPU6050_ReadDevice();
+    MPU6050_StageEnd(MPU6050_STAGE_READ);
+}
+
+static void MPU6050_DispatchSendHk(CFE_SB_Buffer_t *BufPtr)
+{
+    (void) BufPtr;
+
+    MPU6050_ProcessSendHk();
+}
+
+static void MPU6050_DispatchCmd(CFE_SB_Buffer_t *BufPtr)
+{
+    MPU6050_ProcessNewAppCmds(&BufPtr->Msg);
+}
+
+static void MPU6050_DispatchPeer(CFE_SB_Buffer_t *BufPtr)
+{
+    MPU6050_FusionPeerData(BufPtr);
+}
+
+/* Dispatch table index of a message, or -1 */
+static int32 MPU6050_DispatchLookup(CFE_SB_Buffer_t *BufPtr)
+{
+    CFE_SB_MsgId_t MsgId;
+    int32          iStatus;
+    uint32         i;
+
+    iStatus = CFE_MSG_GetMsgId(&BufPtr->Msg, &MsgId);
+    if (iStatus != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Could not get message ID (0x%08X)", iStatus);
+        return -1;
+    }
+
+    for (i = 0; i < MPU6050_DISPATCH_TBL_CNT; i++)
+    {
+        if ((MPU6050_DispatchTbl[i].MsgId == 0) ? MPU6050_FusionPeerNum(MsgId) >= 0 :
+                                                  CFE_SB_MsgIdToValue(MsgId) == MPU6050_DispatchTbl[i].MsgId)
+        {
+            return (int32) i;
+        }
+    }
+
+    CFE_EVS_SendEvent(MPU6050_MSGID_ERR_EID, CFE_EVS_EventType_ERROR,
+            "MPU6050 - Recvd invalid msgId (0x%08X)", CFE_SB_MsgIdToValue(MsgId));
+    return -1;
+}
+
+/*=====================================================================================
+** Name: MPU6050_InitDispatchPipe
+**
+** Purpose: To create the consolidated pipe and subscribe it to every MID with a handler
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    int32 iStatus - Status of initialization
+**
+** Routines Called:
+**    CFE_SB_CreatePipe
+**    CFE_SB_Subscribe
+**    CFE_ES_WriteToSysLog
+**
+** Called By:
+**    MPU6050_InitPipe
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.usDispatchPipeDepth
+**    g_MPU6050_AppData.cDispatchPipeName
+**    g_MPU6050_AppData.DispatchPipeId
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Fusion peers depend on the table and are subscribed to later, by
+**    MPU6050_InitFusion.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_InitDispatchPipe(void)
+{
+    int32  iStatus;
+    uint32 i;
+
+    g_MPU6050_AppData.usDispatchPipeDepth = MPU6050_DISPATCH_PIPE_DEPTH;
+    memset((void*) g_MPU6050_AppData.cDispatchPipeName, '\0', sizeof(g_MPU6050_AppData.cDispatchPipeName));
+    strncpy(g_MPU6050_AppData.cDispatchPipeName, "MPU6050_PIPE", OS_MAX_API_NAME-1);
+
+    iStatus = CFE_SB_CreatePipe(&g_MPU6050_AppData.DispatchPipeId,
+                                 g_MPU6050_AppData.usDispatchPipeDepth,
+                                 g_MPU6050_AppData.cDispatchPipeName);
+    if (iStatus != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("MPU6050 - Failed to create dispatch pipe (0x%08X)\n", iStatus);
+        return iStatus;
+    }
+
+    for (i = 0; i < MPU6050_DISPATCH_TBL_CNT; i++)
+    {
+        if (MPU6050_DispatchTbl[i].MsgId == 0)
+        {
+            continue;
+        }
+
+        iStatus = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(MPU6050_DispatchTbl[i].MsgId),
+                                   g_MPU6050_AppData.DispatchPipeId);
+        if (iStatus != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("MPU6050 - Dispatch pipe failed to subscribe to 0x%04X. (0x%08X)\n",
+                                 (unsigned int) MPU6050_DispatchTbl[i].MsgId, iStatus);
+            return iStatus;
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_Dispatch
+**
+** Purpose: To handle a message received from the consolidated pipe, and the messages
+**          behind it, most urgent first
+**
+** Arguments:
+**    CFE_SB_Buffer_t* FirstPtr - Message just received from the dispatch pipe
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_SB_ReceiveBuffer
+**    CFE_MSG_GetSize
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_RcvMsg
+**    MPU6050_ServiceIdle
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.DispatchPipeId
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Deferred
+**    g_MPU6050_AppData.uiSbRcvCnt
+**    g_MPU6050_AppData.uiRunStatus
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Urgent messages are handled as they come off the pipe.  The others are copied
+**    aside, since SB reclaims a buffer on the next receive, and handled by priority
+**    once the pipe is empty or the budget is spent.
+** 2: Messages longer than MPU6050_DISPATCH_MSG_BYTES can only be handled urgently.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_Dispatch(CFE_SB_Buffer_t *FirstPtr)
+{
+    CFE_SB_Buffer_t    *BufPtr      = FirstPtr;
+    MPU6050_Deferred_t *deferredPtr;
+    CFE_MSG_Size_t      size        = 0;
+    uint32              msgCnt      = 0;
+    uint32              deferredCnt = 0;
+    uint32              prio;
+    uint32              i;
+    int32               handler;
+    int32               iStatus;
+
+    while (BufPtr != NULL)
+    {
+        handler = MPU6050_DispatchLookup(BufPtr);
+        if (handler >= 0)
+        {
+            if (MPU6050_DispatchTbl[handler].ucPriority == MPU6050_DISPATCH_PRIO_URGENT)
+            {
+                MPU6050_DispatchTbl[handler].Handler(BufPtr);
+            }
+            else if (CFE_MSG_GetSize(&BufPtr->Msg, &size) == CFE_SUCCESS &&
+                     size <= MPU6050_DISPATCH_MSG_BYTES)
+            {
+                deferredPtr = &g_MPU6050_AppData.Deferred[deferredCnt++];
+                deferredPtr->usHandler = (uint16) handler;
+                deferredPtr->usSize    = (uint16) size;
+                memcpy(deferredPtr->auiMsg, BufPtr, size);
+            }
+            else
+            {
+                CFE_EVS_SendEvent(MPU6050_MSGLEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "MPU6050 - Dropped a %u byte message, more than can be held for dispatch",
+                        (unsigned int) size);
+            }
+        }
+
+        /* The rest waits for the next cycle */
+        if (++msgCnt >= MPU6050_DISPATCH_BUDGET)
+        {
+            break;
+        }
+
+        BufPtr  = NULL;
+        iStatus = CFE_SB_ReceiveBuffer(&BufPtr, g_MPU6050_AppData.DispatchPipeId, CFE_SB_POLL);
+        g_MPU6050_AppData.uiSbRcvCnt++;
+        if (iStatus != CFE_SUCCESS)
+        {
+            BufPtr = NULL;
+            if (iStatus != CFE_SB_NO_MESSAGE)
+            {
+                CFE_EVS_SendEvent(MPU6050_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                        "MPU6050: SB pipe read error (0x%08X), app will exit", iStatus);
+                g_MPU6050_AppData.uiRunStatus = CFE_ES_RunStatus_APP_ERROR;
+            }
+        }
+    }
+
+    /* Everything held back, by priority and then in order of arrival */
+    for (prio = MPU6050_DISPATCH_PRIO_URGENT + 1; prio < MPU6050_DISPATCH_PRIO_CNT; prio++)
+    {
+        for (i = 0; i < deferredCnt; i++)
+        {
+            deferredPtr = &g_MPU6050_AppData.Deferred[i];
+            if (MPU6050_DispatchTbl[deferredPtr->usHandler].ucPriority == prio)
+            {
+                MPU6050_DispatchTbl[deferredPtr->usHandler].Handler((CFE_SB_Buffer_t*) deferredPtr->auiMsg);
+            }
+        }
+    }
+}
+
+/*=======================================================================================
+** End of file mpu6050_dispatch.c
+**=====================================================================================*/
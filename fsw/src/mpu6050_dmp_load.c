@@ -0,0 +1,453 @@
+/*=======================================================================================
+** File Name:  mpu6050_dmp_load.c
+**
+** Title:  Digital Motion Processor Loading for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To load a firmware image into the Digital Motion Processor, set it up and
+**           start it, so the device fills the FIFO with attitude quaternions computed
+**           on chip.
+**
+** Functions Defined:
+**    MPU6050_DmpLoadImage  - Read the table's firmware image into memory
+**    MPU6050_DmpStart      - Write, verify and set up the image on the device
+**    MPU6050_DmpDecimation - Samples per DMP packet
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: No image ships with the app; the table names one (e.g. the InvenSense Motion
+**    Driver 6.12 image) and says how it was built to be driven: start address, rate
+**    divider address, packet features and the memory writes that switch them on.
+** 2: DMP memory is written in as few transfers as the bus allows: one per bank, or
+**    per chunkBytes where the adapter limits message size, each preceded by a single
+**    write of BANK_SEL and MEM_START_ADDR.  Verification reads each bank back in one
+**    transfer once everything is written.  The Motion Driver writes and reads back
+**    16 bytes at a time, about four times as many transfers.
+** 3: The image is kept, so MPU6050_RestartDevice can load it again after the reset
+**    clears DMP memory.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Pragmas
+*/
+
+/*
+** Include Files
+*/
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cfe.h"
+#include "cfe_evs.h"
+#include "mpu6050_app.h"
+#include "mpu6050_diag.h"
+#include "mpu6050_hw_drv.h"
+#include "mpu6050_dmp.h"
+
+/*
+** Local Defines
+*/
+
+/*
+** External Global Variables
+*/
+extern MPU6050_AppData_t  g_MPU6050_AppData;
+
+/*
+** Local Function Definitions
+*/
+
+/* Largest memory write the table allows, at most a bank */
+static uint32 MPU6050_DmpChunkBytes(void)
+{
+    uint32 chunk = g_MPU6050_AppData.ConfigTbl->dmp.chunkBytes;
+
+    return (chunk == 0 || chunk > MPU6050_DMP_BANK_SIZE) ? MPU6050_DMP_BANK_SIZE : chunk;
+}
+
+/* Write the image to DMP memory from address 0.  Returns the writes made, or 0 if one
+** failed. */
+static uint32 MPU6050_DmpUpload(void)
+{
+    const uint8 *imagePtr = g_MPU6050_AppData.aucDmpImage;
+    uint32       size     = g_MPU6050_AppData.uiDmpImageBytes;
+    uint32       chunk    = MPU6050_DmpChunkBytes();
+    uint32       writes   = 0;
+    uint32       addr;
+    uint32       len;
+
+    for (addr = 0; addr < size; addr += len)
+    {
+        len = MPU6050_DMP_BANK_SIZE - addr % MPU6050_DMP_BANK_SIZE;
+        if (len > chunk)
+        {
+            len = chunk;
+        }
+        if (len > size - addr)
+        {
+            len = size - addr;
+        }
+
+        if (MPU6050_WriteMemory(g_MPU6050_AppData.FileID, (uint16) addr, &imagePtr[addr], len) != len)
+        {
+            CFE_EVS_SendEvent(MPU6050_DMP_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - DMP memory write of %u bytes at 0x%04X failed",
+                    (unsigned int) len, (unsigned int) addr);
+            return 0;
+        }
+        writes++;
+    }
+
+    return writes;
+}
+
+/* Read the image back a bank at a time; false at the first difference */
+static bool MPU6050_DmpVerify(void)
+{
+    const uint8 *imagePtr = g_MPU6050_AppData.aucDmpImage;
+    uint32       size     = g_MPU6050_AppData.uiDmpImageBytes;
+    uint8        bank[MPU6050_DMP_BANK_SIZE];
+    uint32       addr;
+    uint32       len;
+    uint32       i;
+
+    for (addr = 0; addr < size; addr += len)
+    {
+        len = (size - addr < MPU6050_DMP_BANK_SIZE) ? size - addr : MPU6050_DMP_BANK_SIZE;
+
+        if (MPU6050_ReadMemory(g_MPU6050_AppData.FileID, (uint16) addr, bank, len) != len)
+        {
+            CFE_EVS_SendEvent(MPU6050_DMP_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - DMP memory read of %u bytes at 0x%04X failed",
+                    (unsigned int) len, (unsigned int) addr);
+            return false;
+        }
+
+        if (memcmp(bank, &imagePtr[addr], len) != 0)
+        {
+            for (i = 0; bank[i] == imagePtr[addr + i]; i++)
+            {
+            }
+            CFE_EVS_SendEvent(MPU6050_DMP_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - DMP memory at 0x%04X reads 0x%02X, image has 0x%02X",
+                    (unsigned int) (addr + i), (unsigned int) bank[i], (unsigned int) imagePtr[addr + i]);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Point the DMP at its program, set its output rate and switch on its features */
+static bool MPU6050_DmpConfigure(void)
+{
+    const MPU6050_DmpCfg_t   *cfgPtr = &g_MPU6050_AppData.ConfigTbl->dmp;
+    const MPU6050_DmpPatch_t *patchPtr;
+    uint8  rate[2];
+    uint32 p;
+
+    if (MPU6050_write16(g_MPU6050_AppData.FileID, RegDmpCfg1,
+                        (uint8) (cfgPtr->startAddr >> 8), (uint8) cfgPtr->startAddr) < 3)
+    {
+        CFE_EVS_SendEvent(MPU6050_DMP_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Failed to set DMP start address 0x%04X", (unsigned int) cfgPtr->startAddr);
+        return false;
+    }
+
+    if (cfgPtr->rateAddr != 0)
+    {
+        rate[0] = (uint8) (cfgPtr->rateDiv >> 8);
+        rate[1] = (uint8) cfgPtr->rateDiv;
+        if (MPU6050_WriteMemory(g_MPU6050_AppData.FileID, cfgPtr->rateAddr, rate, sizeof(rate)) != sizeof(rate))
+        {
+            CFE_EVS_SendEvent(MPU6050_DMP_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - Failed to set DMP rate divider at 0x%04X", (unsigned int) cfgPtr->rateAddr);
+            return false;
+        }
+    }
+
+    for (p = 0; p < MPU6050_DMP_MAX_PATCHES; p++)
+    {
+        patchPtr = &cfgPtr->patches[p];
+        if (patchPtr->len == 0)
+        {
+            continue;
+        }
+
+        if (patchPtr->len > MPU6050_DMP_PATCH_BYTES ||
+            MPU6050_WriteMemory(g_MPU6050_AppData.FileID, patchPtr->addr, patchPtr->data, patchPtr->len) !=
+                patchPtr->len)
+        {
+            CFE_EVS_SendEvent(MPU6050_DMP_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - Failed to write DMP patch %u, %u bytes at 0x%04X",
+                    (unsigned int) p, (unsigned int) patchPtr->len, (unsigned int) patchPtr->addr);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*=====================================================================================
+** Name: MPU6050_DmpLoadImage
+**
+** Purpose: To read the DMP firmware image the table names, if any
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    int32 iStatus - Status of the load
+**
+** Routines Called:
+**    MPU6050_Dmp_PacketBytes
+**    MPU6050_GetSampleRateHz
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_InitDevice
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->dmp
+**    g_MPU6050_AppData.ConfigTbl->useFifo
+**    g_MPU6050_AppData.ConfigTbl->sampleRateDiv
+**    g_MPU6050_AppData.ConfigTbl->dlpfConfig
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.aucDmpImage
+**    g_MPU6050_AppData.uiDmpImageBytes
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: An empty imagePath leaves uiDmpImageBytes 0 and the DMP off.
+** 2: The DMP delivers its packets through the FIFO, so it needs useFifo, and the
+**    features must describe a packet.  An image larger than DMP memory is refused.
+** 3: An image integrates over the sample period it was built for, so a table whose
+**    fixed rate differs from its sampleRateHz is refused rather than run with a
+**    quaternion scaled wrong.  The DMP keeps that rate; adaptive profiles are off.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_DmpLoadImage(void)
+{
+    const MPU6050_DmpCfg_t *cfgPtr = &g_MPU6050_AppData.ConfigTbl->dmp;
+    FILE  *filePtr;
+    size_t bytes;
+    double rateHz;
+
+    g_MPU6050_AppData.uiDmpImageBytes = 0;
+
+    if (cfgPtr->imagePath[0] == '\0')
+    {
+        return CFE_SUCCESS;
+    }
+
+    if (!g_MPU6050_AppData.ConfigTbl->useFifo || MPU6050_Dmp_PacketBytes(cfgPtr->features) == 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_DMP_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - The DMP needs useFifo and packet features (have %u, 0x%02X)",
+                (unsigned int) g_MPU6050_AppData.ConfigTbl->useFifo, (unsigned int) cfgPtr->features);
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    rateHz = MPU6050_GetSampleRateHz(g_MPU6050_AppData.ConfigTbl->sampleRateDiv,
+                                     g_MPU6050_AppData.ConfigTbl->dlpfConfig);
+    if (cfgPtr->sampleRateHz != 0 && fabs(rateHz - cfgPtr->sampleRateHz) > 0.5)
+    {
+        CFE_EVS_SendEvent(MPU6050_DMP_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - DMP image %s is built for %u Hz sampling, the table gives %.1f Hz "
+                "(sampleRateDiv %u, dlpfConfig %u)",
+                cfgPtr->imagePath, (unsigned int) cfgPtr->sampleRateHz, rateHz,
+                (unsigned int) g_MPU6050_AppData.ConfigTbl->sampleRateDiv,
+                (unsigned int) g_MPU6050_AppData.ConfigTbl->dlpfConfig);
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    filePtr = fopen(cfgPtr->imagePath, "rb");
+    if (filePtr == NULL)
+    {
+        CFE_EVS_SendEvent(MPU6050_DMP_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Failed to open DMP image %s", cfgPtr->imagePath);
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    /* One byte more than fits tells an image that is too large */
+    bytes = fread(g_MPU6050_AppData.aucDmpImage, 1, sizeof(g_MPU6050_AppData.aucDmpImage), filePtr);
+    if (bytes == sizeof(g_MPU6050_AppData.aucDmpImage) && fgetc(filePtr) != EOF)
+    {
+        bytes = 0;
+    }
+    fclose(filePtr);
+
+    if (bytes == 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_DMP_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - DMP image %s is empty or larger than the %u bytes of DMP memory",
+                cfgPtr->imagePath, (unsigned int) MPU6050_DMP_MEM_SIZE);
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    g_MPU6050_AppData.uiDmpImageBytes = (uint32) bytes;
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_DmpStart
+**
+** Purpose: To write the DMP image to the device, verify it and set the DMP up, ready
+**          to be enabled with the FIFO
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    int32 iStatus - Status of the start
+**
+** Routines Called:
+**    MPU6050_DiagNow
+**    MPU6050_WriteMemory
+**    MPU6050_ReadMemory
+**    MPU6050_write16
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_ConfigDevice
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->dmp
+**    g_MPU6050_AppData.aucDmpImage
+**    g_MPU6050_AppData.uiDmpImageBytes
+**    g_MPU6050_AppData.FileID
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.bDmpOn
+**    g_MPU6050_AppData.ucDmpFeatures
+**    g_MPU6050_AppData.HkTlm.ucDmpFeatures
+**    g_MPU6050_AppData.HkTlm.uiDmpLoadUsec
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Without an image the DMP is left off and this succeeds.
+** 2: The device must be awake.  USER_CTRL DMP_EN is set by the FIFO reset that
+**    follows, so the first packet starts the FIFO.
+** 3: The event gives the time taken to write, to read back and to set up, and the
+**    writes it took, so the effect of chunkBytes on a given bus can be seen.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_DmpStart(void)
+{
+    const MPU6050_DmpCfg_t *cfgPtr = &g_MPU6050_AppData.ConfigTbl->dmp;
+    uint64 startNsec;
+    uint64 writtenNsec;
+    uint64 verifiedNsec;
+    uint64 doneNsec;
+    uint32 writes;
+
+    g_MPU6050_AppData.bDmpOn                 = false;
+    g_MPU6050_AppData.ucDmpFeatures          = 0;
+    g_MPU6050_AppData.HkTlm.ucDmpFeatures    = 0;
+
+    if (g_MPU6050_AppData.uiDmpImageBytes == 0)
+    {
+        return CFE_SUCCESS;
+    }
+
+    startNsec = MPU6050_DiagNow();
+
+    writes = MPU6050_DmpUpload();
+    writtenNsec = MPU6050_DiagNow();
+    if (writes == 0 || !MPU6050_DmpVerify())
+    {
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    verifiedNsec = MPU6050_DiagNow();
+    if (!MPU6050_DmpConfigure())
+    {
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+    doneNsec = MPU6050_DiagNow();
+
+    g_MPU6050_AppData.bDmpOn              = true;
+    g_MPU6050_AppData.ucDmpFeatures       = cfgPtr->features;
+    g_MPU6050_AppData.HkTlm.ucDmpFeatures = cfgPtr->features;
+    g_MPU6050_AppData.HkTlm.uiDmpLoadUsec = (uint32) ((doneNsec - startNsec) / 1000);
+
+    CFE_EVS_SendEvent(MPU6050_DMP_INF_EID, CFE_EVS_EventType_INFORMATION,
+            "MPU6050 - DMP image %s: %u bytes in %u writes, written in %u us, verified in %u us, "
+            "set up in %u us, features 0x%02X",
+            cfgPtr->imagePath, (unsigned int) g_MPU6050_AppData.uiDmpImageBytes, (unsigned int) writes,
+            (unsigned int) ((writtenNsec - startNsec) / 1000), (unsigned int) ((verifiedNsec - writtenNsec) / 1000),
+            (unsigned int) ((doneNsec - verifiedNsec) / 1000), (unsigned int) cfgPtr->features);
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_DmpDecimation
+**
+** Purpose: To give the samples behind each DMP packet, which sets the FIFO rate
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    uint32 - 1 + the table's rateDiv while a DMP image is loaded, 1 otherwise
+**
+** Routines Called:
+**    None
+**
+** Called By:
+**    MPU6050_InitDevice
+**    MPU6050_RestartSampling
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->dmp.rateDiv
+**    g_MPU6050_AppData.uiDmpImageBytes
+**
+** Global Outputs/Writes:
+**    None
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Goes by the image rather than bDmpOn, so the time model can be started at the
+**    DMP rate before the DMP itself is.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+uint32 MPU6050_DmpDecimation(void)
+{
+    if (g_MPU6050_AppData.uiDmpImageBytes == 0)
+    {
+        return 1;
+    }
+
+    return 1 + (uint32) g_MPU6050_AppData.ConfigTbl->dmp.rateDiv;
+}
+
+/*=======================================================================================
+** End of file mpu6050_dmp_load.c
+**=====================================================================================*/
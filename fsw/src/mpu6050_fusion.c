@@ -0,0 +1,519 @@
+/*=======================================================================================
+** File Name:  mpu6050_fusion.c
+**
+** Title:  Redundant Device Fusion for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To fuse the samples of this device with those of other MPU6050 app
+**           instances ("peers") into one voted and averaged sample stream, with the
+**           health of every device behind each sample.
+**
+** Functions Defined:
+**    MPU6050_InitFusion     - Subscribe to the peers in the table and start voting over
+**    MPU6050_FusionPeerNum  - Peer a MID belongs to
+**    MPU6050_FusionPeerData - Take the samples of a peer's calibrated stream packet
+**    MPU6050_FusionNewData  - Vote on the samples of the last device read
+**    MPU6050_TimeToNsec     - CFE time to nanoseconds
+**    MPU6050_NsecToTime     - The reverse
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Each peer is another instance of this app publishing an MPU6050_STREAM_CALIBRATED
+**    stream, on the same CFE time.  Its calibration must bring it into this device's
+**    body frame.
+** 2: This device is the reference: a fused sample is made for each of its samples,
+**    with the peers interpolated to its time.  The voting itself is in mpu6050_vote.c.
+**    It is vote member 0; peer n, numbered from 1 in table order, is member n.
+** 3: A sample is fused once every peer has sent samples past it, or after the table's
+**    latency, so fused streams lag the others by about the peers' batch period.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Pragmas
+*/
+
+/*
+** Include Files
+*/
+#include <string.h>
+#include <stddef.h>
+
+#include "cfe.h"
+#include "cfe_evs.h"
+#include "cfe_msg.h"
+#include "cfe_sb.h"
+#include "cfe_time.h"
+#include "mpu6050_app.h"
+#include "mpu6050_conv.h"
+#include "mpu6050_vote.h"
+
+/*
+** Local Defines
+*/
+
+/*
+** External Global Variables
+*/
+extern MPU6050_AppData_t  g_MPU6050_AppData;
+
+/*
+** Local Function Definitions
+*/
+
+/* Pipe that subscribed data arrives on */
+static CFE_SB_PipeId_t MPU6050_FusionPipe(void)
+{
+#if MPU6050_DISPATCH_SINGLE_PIPE
+    return g_MPU6050_AppData.DispatchPipeId;
+#else
+    return g_MPU6050_AppData.TlmPipeId;
+#endif
+}
+
+/* Report the devices faulted or cleared since the last fused sample */
+static void MPU6050_FusionReportHealth(uint8 FaultMask)
+{
+    uint8  changed = FaultMask ^ g_MPU6050_AppData.HkTlm.ucFusionFaultMask;
+    uint32 m;
+
+    for (m = 0; m < g_MPU6050_AppData.Vote.uiMemberCnt; m++)
+    {
+        if (!(changed & (1 << m)))
+        {
+            continue;
+        }
+
+        if (FaultMask & (1 << m))
+        {
+            CFE_EVS_SendEvent(MPU6050_FUSION_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - Fusion faulted device %u (0 is this one) after %u outliers in a row",
+                    (unsigned int) m, (unsigned int) g_MPU6050_AppData.Vote.Cfg.usFaultPersist);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(MPU6050_FUSION_INF_EID, CFE_EVS_EventType_INFORMATION,
+                    "MPU6050 - Fusion cleared device %u (0 is this one)", (unsigned int) m);
+        }
+    }
+}
+
+/*=====================================================================================
+** Name: MPU6050_InitFusion
+**
+** Purpose: To subscribe to the peers in the table and start voting over
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    int32 iStatus - Status of initialization
+**
+** Routines Called:
+**    CFE_SB_Subscribe
+**    CFE_SB_Unsubscribe
+**    CFE_EVS_SendEvent
+**    MPU6050_StreamContentUsed
+**    MPU6050_Vote_Init
+**
+** Called By:
+**    MPU6050_InitApp
+**    MPU6050_ProcessSendHk
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->fusion
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Vote
+**    g_MPU6050_AppData.auiPeerMsgIds
+**    g_MPU6050_AppData.uiPeerCnt
+**    g_MPU6050_AppData.HkTlm
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Called again after a table update.  Every device starts over healthy, and the
+**    samples waiting to be fused are dropped.
+** 2: Peers are only subscribed to while a stream publishes fused samples.  A peer
+**    that cannot be subscribed to is reported and left out.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_InitFusion(void)
+{
+    const MPU6050_FusionCfg_t *CfgPtr = &g_MPU6050_AppData.ConfigTbl->fusion;
+    MPU6050_VoteCfg_t          voteCfg;
+    int32                      iStatus;
+    uint32                     i;
+
+    for (i = 0; i < g_MPU6050_AppData.uiPeerCnt; i++)
+    {
+        CFE_SB_Unsubscribe(CFE_SB_ValueToMsgId(g_MPU6050_AppData.auiPeerMsgIds[i]), MPU6050_FusionPipe());
+    }
+    g_MPU6050_AppData.uiPeerCnt = 0;
+
+    for (i = 0; i < MPU6050_VOTE_MAX_PEERS && MPU6050_StreamContentUsed(MPU6050_STREAM_FUSED); i++)
+    {
+        if (CfgPtr->peerMsgIds[i] == 0)
+        {
+            continue;
+        }
+
+        iStatus = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(CfgPtr->peerMsgIds[i]), MPU6050_FusionPipe());
+        if (iStatus != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(MPU6050_FUSION_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - Fusion failed to subscribe to peer 0x%04X (0x%08X), not used",
+                    (unsigned int) CfgPtr->peerMsgIds[i], (unsigned int) iStatus);
+            continue;
+        }
+
+        g_MPU6050_AppData.auiPeerMsgIds[g_MPU6050_AppData.uiPeerCnt++] = CfgPtr->peerMsgIds[i];
+    }
+
+    voteCfg.dAccelTolG       = CfgPtr->accelTolMg / 1000.0;
+    voteCfg.dGyroTolDps      = CfgPtr->gyroTolDps;
+    voteCfg.uiMaxGapNsec     = (uint64) CfgPtr->maxGapMsec * 1000000u;
+    voteCfg.uiLatencyNsec    = (uint64) CfgPtr->latencyMsec * 1000000u;
+    voteCfg.usFaultPersist   = CfgPtr->faultPersist;
+    voteCfg.usRecoverPersist = CfgPtr->recoverPersist;
+    MPU6050_Vote_Init(&g_MPU6050_AppData.Vote, g_MPU6050_AppData.uiPeerCnt + 1, &voteCfg);
+
+    g_MPU6050_AppData.HkTlm.ucFusionDevices   = MPU6050_StreamContentUsed(MPU6050_STREAM_FUSED) ?
+                                                (uint8) (g_MPU6050_AppData.uiPeerCnt + 1) : 0;
+    g_MPU6050_AppData.HkTlm.ucFusionUsedMask  = 0;
+    g_MPU6050_AppData.HkTlm.ucFusionStaleMask = 0;
+    g_MPU6050_AppData.HkTlm.ucFusionFaultMask = 0;
+
+    if (g_MPU6050_AppData.HkTlm.ucFusionDevices > 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_FUSION_INF_EID, CFE_EVS_EventType_INFORMATION,
+                "MPU6050 - Fusing %u peers with this device", (unsigned int) g_MPU6050_AppData.uiPeerCnt);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_FusionPeerNum
+**
+** Purpose: To tell which peer, if any, publishes on a MID
+**
+** Arguments:
+**    CFE_SB_MsgId_t MsgId - MID of a received message
+**
+** Returns:
+**    int32 - Peer number, from 1 in table order, or -1
+**
+** Routines Called:
+**    None
+**
+** Called By:
+**    MPU6050_ProcessNewData
+**    MPU6050_Dispatch
+**    MPU6050_FusionPeerData
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.auiPeerMsgIds
+**    g_MPU6050_AppData.uiPeerCnt
+**
+** Global Outputs/Writes:
+**    None
+**
+** Limitations, Assumptions, External Events, and Notes:
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_FusionPeerNum(CFE_SB_MsgId_t MsgId)
+{
+    uint32 i;
+
+    for (i = 0; i < g_MPU6050_AppData.uiPeerCnt; i++)
+    {
+        if (CFE_SB_MsgIdToValue(MsgId) == g_MPU6050_AppData.auiPeerMsgIds[i])
+        {
+            return (int32) i + 1;
+        }
+    }
+
+    return -1;
+}
+
+/*=====================================================================================
+** Name: MPU6050_FusionPeerData
+**
+** Purpose: To take the samples of a packet of a peer's calibrated stream
+**
+** Arguments:
+**    CFE_SB_Buffer_t* BufPtr - MPU6050_OutBatch_t received from a peer
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_MSG_GetMsgId
+**    CFE_MSG_GetSize
+**    CFE_EVS_SendEvent
+**    MPU6050_FusionPeerNum
+**    MPU6050_UnpackCalibrated
+**    MPU6050_TimeToNsec
+**    MPU6050_Vote_Add
+**
+** Called By:
+**    MPU6050_ProcessNewData
+**    MPU6050_Dispatch
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Vote
+**    g_MPU6050_AppData.HkTlm.uiFusionPeerErrCnt
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Only copies the samples; they are voted on with this device's in
+**    MPU6050_FusionNewData.
+** 2: A packet whose length does not match its header is dropped whole.  Samples no
+**    newer than the peer's last are dropped one by one.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_FusionPeerData(CFE_SB_Buffer_t *BufPtr)
+{
+    const MPU6050_OutBatch_t *pktPtr = (const MPU6050_OutBatch_t*) BufPtr;
+    const double             *packed = (const double*) pktPtr->Samples;
+    MPU6050_Sample_t          sample;
+    CFE_SB_MsgId_t            msgId;
+    CFE_MSG_Size_t            size = 0;
+    uint64                    baseNsec;
+    uint8                     channels;
+    uint32                    chanCnt;
+    int32                     peer;
+    uint32                    n;
+
+    if (CFE_MSG_GetMsgId(&BufPtr->Msg, &msgId) != CFE_SUCCESS ||
+        (peer = MPU6050_FusionPeerNum(msgId)) < 0)
+    {
+        return;
+    }
+
+    CFE_MSG_GetSize(&BufPtr->Msg, &size);
+    channels = pktPtr->Batch.ucChannelMask & ~MPU6050_CHAN_TEMP;
+    chanCnt  = MPU6050_ChannelCnt(channels);
+    if (size < offsetof(MPU6050_OutBatch_t, Samples) || chanCnt == 0 ||
+        pktPtr->Batch.usSampleCnt > MPU6050_MAX_BATCH_SAMPLES ||
+        size < offsetof(MPU6050_OutBatch_t, Samples) + pktPtr->Batch.usSampleCnt * chanCnt * sizeof(double))
+    {
+        g_MPU6050_AppData.HkTlm.uiFusionPeerErrCnt++;
+        CFE_EVS_SendEvent(MPU6050_FUSION_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Dropped a %u byte packet from peer %u, not a calibrated stream",
+                (unsigned int) size, (unsigned int) peer);
+        return;
+    }
+
+    baseNsec = MPU6050_TimeToNsec(pktPtr->Batch.baseTime);
+    for (n = 0; n < pktPtr->Batch.usSampleCnt; n++)
+    {
+        packed += MPU6050_UnpackCalibrated(packed, channels, &sample);
+        MPU6050_Vote_Add(&g_MPU6050_AppData.Vote, (uint32) peer,
+                         baseNsec + (uint64) n * pktPtr->Batch.uiSamplePeriodNsec, channels, &sample);
+    }
+}
+
+/*=====================================================================================
+** Name: MPU6050_FusionNewData
+**
+** Purpose: To vote on the samples of the last device read with the peers', and hand
+**          what could be fused to the fused streams
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    MPU6050_Core_Convert
+**    MPU6050_GetSampleTime
+**    MPU6050_TimeToNsec
+**    MPU6050_Vote_Add
+**    MPU6050_Vote_Fuse
+**    MPU6050_StreamFused
+**    CFE_TIME_GetTime
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_AppMain
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.InData
+**    g_MPU6050_AppData.Core
+**    g_MPU6050_AppData.ucChannelMask
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Vote
+**    g_MPU6050_AppData.FusedOut
+**    g_MPU6050_AppData.HkTlm
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Only called while a stream publishes fused samples.
+** 2: Samples wait in the vote for peers, so a cycle can fuse more or fewer samples than
+**    it read.  The work per sample is linear in the number of devices.
+** 3: A device faulted or cleared by the vote is reported once per change.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_FusionNewData(void)
+{
+    const MPU6050_InData_t *inData   = &g_MPU6050_AppData.InData;
+    MPU6050_Vote_t         *votePtr  = &g_MPU6050_AppData.Vote;
+    MPU6050_Sample_t        sample;
+    const MPU6050_FusedSample_t *fusedPtr;
+    uint8                   channels = g_MPU6050_AppData.ucChannelMask & ~MPU6050_CHAN_TEMP;
+    uint64                  nowNsec;
+    uint32                  cnt;
+    uint32                  i;
+
+    for (i = 0; i < inData->uiSampleCnt; i++)
+    {
+        MPU6050_Core_Convert(&g_MPU6050_AppData.Core, &inData->Samples[i], &sample);
+        MPU6050_Vote_Add(votePtr, 0, MPU6050_TimeToNsec(MPU6050_GetSampleTime(i)), channels, &sample);
+    }
+
+    nowNsec = MPU6050_TimeToNsec(CFE_TIME_GetTime());
+    do
+    {
+        cnt = MPU6050_Vote_Fuse(votePtr, nowNsec, g_MPU6050_AppData.FusedOut, MPU6050_FIFO_MAX_SAMPLES);
+        if (cnt > 0)
+        {
+            fusedPtr = &g_MPU6050_AppData.FusedOut[cnt - 1].Fused;
+            MPU6050_FusionReportHealth(fusedPtr->ucFaultMask);
+
+            g_MPU6050_AppData.HkTlm.ucFusionUsedMask  = fusedPtr->ucUsedMask;
+            g_MPU6050_AppData.HkTlm.ucFusionStaleMask = fusedPtr->ucStaleMask;
+            g_MPU6050_AppData.HkTlm.ucFusionFaultMask = fusedPtr->ucFaultMask;
+        }
+
+        MPU6050_StreamFused(g_MPU6050_AppData.FusedOut, cnt);
+    }
+    while (cnt == MPU6050_FIFO_MAX_SAMPLES);
+
+    g_MPU6050_AppData.HkTlm.uiFusionFaultCnt = 0;
+    for (i = 0; i < votePtr->uiMemberCnt; i++)
+    {
+        g_MPU6050_AppData.HkTlm.uiFusionFaultCnt += votePtr->Members[i].uiFaultCnt;
+    }
+    g_MPU6050_AppData.HkTlm.uiFusionLostCnt = votePtr->uiLostCnt;
+}
+
+/*=====================================================================================
+** Name: MPU6050_TimeToNsec
+**
+** Purpose: To express a CFE time in nanoseconds
+**
+** Arguments:
+**    CFE_TIME_SysTime_t Time - Time to convert
+**
+** Returns:
+**    uint64 - Nanoseconds since the CFE epoch
+**
+** Routines Called:
+**    None
+**
+** Called By:
+**    MPU6050_FusionPeerData
+**    MPU6050_FusionNewData
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    None
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Subseconds are truncated to the nanosecond; MPU6050_NsecToTime gives the same
+**    nanosecond back.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+uint64 MPU6050_TimeToNsec(CFE_TIME_SysTime_t Time)
+{
+    return (uint64) Time.Seconds * 1000000000u + (((uint64) Time.Subseconds * 1000000000u) >> 32);
+}
+
+/*=====================================================================================
+** Name: MPU6050_NsecToTime
+**
+** Purpose: To express nanoseconds as a CFE time
+**
+** Arguments:
+**    uint64 TimeNsec - Nanoseconds since the CFE epoch
+**
+** Returns:
+**    CFE_TIME_SysTime_t - The same time
+**
+** Routines Called:
+**    None
+**
+** Called By:
+**    MPU6050_StreamFused
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    None
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Rounds subseconds up, so that MPU6050_TimeToNsec gives TimeNsec back.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+CFE_TIME_SysTime_t MPU6050_NsecToTime(uint64 TimeNsec)
+{
+    CFE_TIME_SysTime_t time;
+
+    time.Seconds    = (uint32) (TimeNsec / 1000000000u);
+    time.Subseconds = (uint32) ((((TimeNsec % 1000000000u) << 32) + 999999999u) / 1000000000u);
+
+    return time;
+}
+
+/*=======================================================================================
+** End of file mpu6050_fusion.c
+**=====================================================================================*/
@@ -1,18 +1,293 @@
+#include <errno.h>
 #include <stdio.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <sys/ioctl.h>
 #include "cfe.h"
 #include "cfe_evs.h"
 #include "cfe_psp.h"
 #include "mpu6050_app.h"
+#include "mpu6050_sim.h"
+#include "mpu6050_spi.h"
+#include "mpu6050_capture.h"
+#include "mpu6050_variant.h"
+
+/* Completion time of the last transfer */
+static uint64 MPU6050_BusNsec;
+
+/* Address of the I2C device, which every message of an I2C_RDWR batch names, and
+ * whether its adapter takes I2C_RDWR at all */
+static uint8 MPU6050_BusAddr;
+static bool  MPU6050_BusRdwrOk;
+
+/* One message of a batch: a write of len bytes, or a read of them into buf */
+typedef struct
+{
+    uint8   *pucBuf;
+    uint16   usLen;
+    bool     bRead;
+} MPU6050_BusMsg_t;
+
+/* Every transfer goes through these two, so a simulated device or a replayed capture
+ * can take the device's place, a capture can record it, and SPI can carry it */
+static ssize_t MPU6050_BusWrite(int fd, const uint8 *buffer, uint32 len)
+{
+    ssize_t bytes;
+
+#if MPU6050_REPLAY_ENABLE
+    if (MPU6050_Replay_IsReplay(fd))
+    {
+        bytes = MPU6050_Replay_Write(fd, buffer, len);
+        MPU6050_BusNsec = MPU6050_Replay_TimeNsec(fd);
+        return bytes;
+    }
+#endif
+#if MPU6050_SIM_ENABLE
+    if (MPU6050_Sim_IsSim(fd))
+    {
+        bytes = MPU6050_Sim_Write(fd, buffer, len);
+    }
+    else
+#endif
+    if (MPU6050_Spi_IsSpi(fd))
+    {
+        bytes = MPU6050_Spi_Write(fd, buffer, len);
+    }
+    else
+    {
+        bytes = write(fd, buffer, len);
+    }
+
+    MPU6050_BusNsec = MPU6050_DiagNow();
+    if (MPU6050_Capture_Active(fd))
+    {
+        MPU6050_Capture_Transfer(MPU6050_CAP_DIR_WRITE, buffer, (int32) bytes, MPU6050_BusNsec);
+    }
+
+    return bytes;
+}
+
+static ssize_t MPU6050_BusRead(int fd, uint8 *buffer, uint32 len)
+{
+    ssize_t bytes;
+
+#if MPU6050_REPLAY_ENABLE
+    if (MPU6050_Replay_IsReplay(fd))
+    {
+        bytes = MPU6050_Replay_Read(fd, buffer, len);
+        MPU6050_BusNsec = MPU6050_Replay_TimeNsec(fd);
+        return bytes;
+    }
+#endif
+#if MPU6050_SIM_ENABLE
+    if (MPU6050_Sim_IsSim(fd))
+    {
+        bytes = MPU6050_Sim_Read(fd, buffer, len);
+    }
+    else
+#endif
+    if (MPU6050_Spi_IsSpi(fd))
+    {
+        bytes = MPU6050_Spi_Read(fd, buffer, len);
+    }
+    else
+    {
+        bytes = read(fd, buffer, len);
+    }
+
+    MPU6050_BusNsec = MPU6050_DiagNow();
+    if (MPU6050_Capture_Active(fd))
+    {
+        MPU6050_Capture_Transfer(MPU6050_CAP_DIR_READ, buffer, (int32) bytes, MPU6050_BusNsec);
+    }
+
+    return bytes;
+}
+
+/* Whether fd is an i2c-dev device rather than a replay, simulation or SPI device */
+static bool MPU6050_BusIsI2c(int fd)
+{
+#if MPU6050_REPLAY_ENABLE
+    if (MPU6050_Replay_IsReplay(fd))
+    {
+        return false;
+    }
+#endif
+#if MPU6050_SIM_ENABLE
+    if (MPU6050_Sim_IsSim(fd))
+    {
+        return false;
+    }
+#endif
+    return !MPU6050_Spi_IsSpi(fd);
+}
+
+/* Whether batches to fd go out as I2C_RDWR ioctls rather than one transfer each */
+bool MPU6050_BusBatched(int fd)
+{
+    return MPU6050_BusIsI2c(fd) && MPU6050_BusRdwrOk;
+}
+
+/* Run the messages in order. On I2C they go out as few I2C_RDWR ioctls as the
+ * adapter takes, joined by repeated starts; elsewhere, or on an SMBus-only adapter,
+ * one transfer each. A capture records them the same either way. Returns the
+ * messages completed. */
+static uint32 MPU6050_BusBatch(int fd, MPU6050_BusMsg_t *msgs, uint32 cnt)
+{
+    struct i2c_msg             i2cMsgs[I2C_RDWR_IOCTL_MAX_MSGS];
+    struct i2c_rdwr_ioctl_data xfer;
+    uint32  done = 0;
+    uint32  n;
+    uint32  i;
+    ssize_t bytes;
+
+    while (done < cnt && MPU6050_BusBatched(fd))
+    {
+        n = (cnt - done < I2C_RDWR_IOCTL_MAX_MSGS) ? cnt - done : I2C_RDWR_IOCTL_MAX_MSGS;
+        for (i = 0; i < n; i++)
+        {
+            i2cMsgs[i].addr  = MPU6050_BusAddr;
+            i2cMsgs[i].flags = msgs[done + i].bRead ? I2C_M_RD : 0;
+            i2cMsgs[i].len   = msgs[done + i].usLen;
+            i2cMsgs[i].buf   = msgs[done + i].pucBuf;
+        }
+        xfer.msgs  = i2cMsgs;
+        xfer.nmsgs = n;
+
+        if (ioctl(fd, I2C_RDWR, &xfer) < 0)
+        {
+            if (errno != EOPNOTSUPP)
+            {
+                return done;
+            }
+
+            /* The adapter only does SMBus; the plain write() and read() it took
+               before still work */
+            MPU6050_BusRdwrOk = false;
+            break;
+        }
+
+        MPU6050_BusNsec = MPU6050_DiagNow();
+        if (MPU6050_Capture_Active(fd))
+        {
+            for (i = 0; i < n; i++)
+            {
+                MPU6050_Capture_Transfer(msgs[done + i].bRead ? MPU6050_CAP_DIR_READ : MPU6050_CAP_DIR_WRITE,
+                                         msgs[done + i].pucBuf, msgs[done + i].usLen, MPU6050_BusNsec);
+            }
+        }
+        done += n;
+    }
+
+    for (; done < cnt; done++)
+    {
+        bytes = msgs[done].bRead ? MPU6050_BusRead(fd, msgs[done].pucBuf, msgs[done].usLen)
+                                 : MPU6050_BusWrite(fd, msgs[done].pucBuf, msgs[done].usLen);
+        if (bytes != (ssize_t) msgs[done].usLen)
+        {
+            break;
+        }
+    }
+
+    return done;
+}
+
+/* CLOCK_MONOTONIC (ns) when the last transfer completed; for a replay, when it did
+ * in the capture */
+uint64 MPU6050_BusTimeNsec(void)
+{
+    return MPU6050_BusNsec;
+}
+
+/* Open the bus to the device at addr, a simulated device for a "sim:<profile>" path,
+ * a capture to play back for a "replay:<file>" path, or the SPI device at a spidev
+ * path (addr unused). Returns the handle, or -1 with errno set. */
+int MPU6050_OpenDevice(const char *path, uint8 addr)
+{
+    int fd;
+
+#if MPU6050_REPLAY_ENABLE
+    if (strncmp(path, MPU6050_REPLAY_PATH_PREFIX, strlen(MPU6050_REPLAY_PATH_PREFIX)) == 0)
+    {
+        return MPU6050_Replay_Open(path + strlen(MPU6050_REPLAY_PATH_PREFIX));
+    }
+#endif
+
+#if MPU6050_SIM_ENABLE
+    if (strncmp(path, MPU6050_SIM_PATH_PREFIX, strlen(MPU6050_SIM_PATH_PREFIX)) == 0)
+    {
+        return MPU6050_Sim_Open(path + strlen(MPU6050_SIM_PATH_PREFIX));
+    }
+#endif
+
+    if (strncmp(path, MPU6050_SPI_PATH_PREFIX, strlen(MPU6050_SPI_PATH_PREFIX)) == 0)
+    {
+        return MPU6050_Spi_Open(path);
+    }
+
+    fd = open(path, O_RDWR);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    if (ioctl(fd, I2C_SLAVE, addr) < 0)
+    {
+        close(fd);
+        return -1;
+    }
+    MPU6050_BusAddr   = addr;
+    MPU6050_BusRdwrOk = true;
+
+    return fd;
+}
+
+/* Close a handle from MPU6050_OpenDevice */
+void MPU6050_CloseDevice(int fd)
+{
+#if MPU6050_REPLAY_ENABLE
+    if (MPU6050_Replay_IsReplay(fd))
+    {
+        MPU6050_Replay_Close(fd);
+        return;
+    }
+#endif
+#if MPU6050_SIM_ENABLE
+    if (MPU6050_Sim_IsSim(fd))
+    {
+        MPU6050_Sim_Close(fd);
+        return;
+    }
+#endif
+    if (MPU6050_Spi_IsSpi(fd))
+    {
+        MPU6050_Spi_Close(fd);
+        return;
+    }
+    close(fd);
+}
+
+/* Read an 8 bit register */
+uint8 MPU6050_read8(int fd, uint8 reg)
+{
+    uint8 buffer[1];
+    buffer[0] = reg;
+    MPU6050_BusWrite(fd, buffer, 1);     /* Select register     */
+    MPU6050_BusRead(fd, buffer, 1);      /* Read 8 bits         */
+    return buffer[0];
+}
 
 /* Read a 16 bit register */
 uint16 MPU6050_read16(int fd, uint8 reg)
 {
     uint8 buffer[2];
     buffer[0] = reg;
-    write(fd, buffer, 1);                /* Select register     */
-    read(fd, buffer, 2);                 /* Read 16 bits        */
+    MPU6050_BusWrite(fd, buffer, 1);     /* Select register     */
+    MPU6050_BusRead(fd, buffer, 2);      /* Read 16 bits        */
     return (buffer[0] << 8) | buffer[1]; /* Return (big endian) */
 }
 
@@ -20,14 +295,14 @@ uint16 MPU6050_read16(int fd, uint8 reg)
 uint32 MPU6050_write8(int fd, uint8 reg, uint8 val)
 {
     uint8 buffer[2] = {reg, val}; /* 8 bit register addr and 8 bit data */
-    return write(fd, buffer, 2);
+    return MPU6050_BusWrite(fd, buffer, 2);
 }
 
 /* Write a 16 bit register */
 uint32 MPU6050_write16(int fd, uint8 reg, uint8 val1, uint8 val2)
 {
     uint8 buffer[3] = {reg, val1, val2}; /* 8 bit register addr and 16 bit data */
-    return write(fd, buffer, 3);
+    return MPU6050_BusWrite(fd, buffer, 3);
 }
 
 /* Read a buffer of arbitrary size from the chip */
@@ -42,10 +317,288 @@ uint32 MPU6050_ReadArbitrary(int fd, uint8 startingAddr, uint8 *buffer, uint32 b
 
     /* Select Register */
     buffer[0] = startingAddr;
-    write(fd, buffer, 1);
+    MPU6050_BusWrite(fd, buffer, 1);
 
     /* Read to fill buffer */
-    return read(fd, buffer, bufferLen);
+    return MPU6050_BusRead(fd, buffer, bufferLen);
+}
+
+/* Variant of the device behind fd by its WHO_AM_I, which is returned in whoAmI; NULL
+ * if no variant answers it. A replay is taken to be an MPU-6050, as nothing was
+ * recorded to tell. */
+const MPU6050_Variant_t *MPU6050_DetectVariant(int fd, uint8 *whoAmI)
+{
+#if MPU6050_REPLAY_ENABLE
+    if (MPU6050_Replay_IsReplay(fd))
+    {
+        *whoAmI = MPU6050_Variant_Default()->ucWhoAmI;
+        return MPU6050_Variant_Default();
+    }
+#endif
+
+    *whoAmI = MPU6050_read8(fd, RegWhoAmI);
+
+    return MPU6050_Variant_Lookup(*whoAmI);
+}
+
+/* FIFO_EN bits that queue the given channels */
+uint8 MPU6050_FifoEnableBits(uint8 channels)
+{
+    return ((channels & MPU6050_CHAN_ACCEL)  ? (1 << FifoEnAccel) : 0) |
+           ((channels & MPU6050_CHAN_TEMP)   ? (1 << FifoEnTemp)  : 0) |
+           ((channels & MPU6050_CHAN_GYRO_X) ? (1 << FifoEnXG)    : 0) |
+           ((channels & MPU6050_CHAN_GYRO_Y) ? (1 << FifoEnYG)    : 0) |
+           ((channels & MPU6050_CHAN_GYRO_Z) ? (1 << FifoEnZG)    : 0);
+}
+
+/* PWR_MGMT_2 bits that put every axis outside the given channels in standby */
+uint8 MPU6050_StandbyBits(uint8 channels)
+{
+    return ((channels & MPU6050_CHAN_ACCEL_X) ? 0 : (1 << PwrMgmt2StbyXA)) |
+           ((channels & MPU6050_CHAN_ACCEL_Y) ? 0 : (1 << PwrMgmt2StbyYA)) |
+           ((channels & MPU6050_CHAN_ACCEL_Z) ? 0 : (1 << PwrMgmt2StbyZA)) |
+           ((channels & MPU6050_CHAN_GYRO_X)  ? 0 : (1 << PwrMgmt2StbyXG)) |
+           ((channels & MPU6050_CHAN_GYRO_Y)  ? 0 : (1 << PwrMgmt2StbyYG)) |
+           ((channels & MPU6050_CHAN_GYRO_Z)  ? 0 : (1 << PwrMgmt2StbyZG));
+}
+
+/* Queue a register write at the end of the list; one past its capacity is dropped */
+void MPU6050_RegListAdd(MPU6050_RegList_t *list, uint8 reg, uint8 val)
+{
+    if (list->uiCnt < MPU6050_MAX_REG_WRITES)
+    {
+        list->Writes[list->uiCnt].ucReg = reg;
+        list->Writes[list->uiCnt].ucVal = val;
+        list->uiCnt++;
+    }
+}
+
+/* Write the list in order, in one batch. Writes to consecutive registers share a
+ * message, as the register pointer moves on by itself; USER_CTRL, FIFO_R_W and
+ * MEM_R_W are never run into. Returns 0, or -1 if a message failed. */
+int32 MPU6050_WriteRegs(int fd, const MPU6050_RegList_t *list)
+{
+    uint8            buffer[2 * MPU6050_MAX_REG_WRITES];
+    MPU6050_BusMsg_t msgs[MPU6050_MAX_REG_WRITES];
+    uint32 cnt  = 0;
+    uint32 used = 0;
+    uint32 i;
+    uint8  reg;
+    uint8  prev = 0;
+
+    for (i = 0; i < list->uiCnt; i++)
+    {
+        reg = list->Writes[i].ucReg;
+        if (cnt > 0 && reg == (uint8) (prev + 1) && reg != RegUserCtrl &&
+            prev != RegFifoRW && prev != RegMemRW)
+        {
+            msgs[cnt - 1].usLen++;
+        }
+        else
+        {
+            msgs[cnt].pucBuf = &buffer[used];
+            msgs[cnt].usLen  = 2;
+            msgs[cnt].bRead  = false;
+            buffer[used++]   = reg;
+            cnt++;
+        }
+        buffer[used++] = list->Writes[i].ucVal;
+        prev = reg;
+    }
+
+    return (MPU6050_BusBatch(fd, msgs, cnt) == cnt) ? 0 : -1;
+}
+
+/* Bits of a register that read back as written: the reset bits clear themselves,
+ * and SPI sets I2C_IF_DIS on its own */
+static uint8 MPU6050_VerifyMask(uint8 reg)
+{
+    switch (reg)
+    {
+        case RegUserCtrl:
+            return (1 << UserCtrlFifoEn) | (1 << UserCtrlDmpEn);
+
+        case RegPowerManagment1:
+            return (uint8) ~(1 << PwrMgmt1DeviceReset);
+
+        default:
+            return 0xFF;
+    }
+}
+
+/* Read back, in one batch, the registers the lists wrote and WHO_AM_I. The registers
+ * come in one burst from the lowest to the highest, so those from BANK_SEL up, whose
+ * reads move the DMP memory and FIFO pointers, are left out; reading INT_STATUS on
+ * the way clears it. Returns 0, or -1 with the first register that does not hold the
+ * last value written to it in badReg, with what it read and that value. A failed
+ * transfer, or another chip, gives WHO_AM_I. A replay is not checked, only kept in
+ * step, as its device was when it was recorded. */
+int32 MPU6050_VerifyRegs(int fd, const MPU6050_RegList_t *lists, uint32 listCnt, uint8 whoAmI,
+                         uint8 *badReg, uint8 *readVal, uint8 *expectVal)
+{
+    uint8            expected[RegBankSel];
+    uint8            mask[RegBankSel];
+    uint8            buffer[RegBankSel];
+    uint8            first = 0xFF;
+    uint8            last  = 0;
+    uint8            whoSel  = RegWhoAmI;
+    uint8            whoRead = 0;
+    MPU6050_BusMsg_t msgs[4];
+    uint32           cnt = 0;
+    uint32           l;
+    uint32           i;
+    uint8            reg;
+
+    CFE_PSP_MemSet(expected, 0, sizeof(expected));
+    CFE_PSP_MemSet(mask, 0, sizeof(mask));
+    for (l = 0; l < listCnt; l++)
+    {
+        for (i = 0; i < lists[l].uiCnt; i++)
+        {
+            reg = lists[l].Writes[i].ucReg;
+            if (reg >= RegBankSel)
+            {
+                continue;
+            }
+            expected[reg] = lists[l].Writes[i].ucVal;
+            mask[reg]     = MPU6050_VerifyMask(reg);
+            first         = (reg < first) ? reg : first;
+            last          = (reg > last)  ? reg : last;
+        }
+    }
+
+    if (first <= last)
+    {
+        msgs[cnt++] = (MPU6050_BusMsg_t) {&first, 1, false};
+        msgs[cnt++] = (MPU6050_BusMsg_t) {&buffer[first], (uint16) (last - first + 1), true};
+    }
+    msgs[cnt++] = (MPU6050_BusMsg_t) {&whoSel, 1, false};
+    msgs[cnt++] = (MPU6050_BusMsg_t) {&whoRead, 1, true};
+
+    *badReg    = RegWhoAmI;
+    *readVal   = whoRead;
+    *expectVal = whoAmI;
+
+    if (MPU6050_BusBatch(fd, msgs, cnt) != cnt)
+    {
+        return -1;
+    }
+
+#if MPU6050_REPLAY_ENABLE
+    if (MPU6050_Replay_IsReplay(fd))
+    {
+        return 0;
+    }
+#endif
+
+    for (reg = first; reg <= last; reg++)
+    {
+        if ((buffer[reg] & mask[reg]) != (expected[reg] & mask[reg]))
+        {
+            *badReg    = reg;
+            *readVal   = buffer[reg];
+            *expectVal = expected[reg];
+            return -1;
+        }
+    }
+
+    if (whoRead != whoAmI)
+    {
+        *readVal = whoRead;
+        return -1;
+    }
+
+    return 0;
+}
+
+/* Queue the sample rate divider and DLPF; variants with an accelerometer DLPF of
+ * their own get the same setting there */
+void MPU6050_SampleRateWrites(MPU6050_RegList_t *list, const MPU6050_Variant_t *variant,
+                              uint8 sampleRateDiv, uint8 dlpfConfig)
+{
+    MPU6050_RegListAdd(list, RegSampleRateDiv, sampleRateDiv);
+    MPU6050_RegListAdd(list, RegConfig, dlpfConfig << ConfigDlpf);
+    if (variant->ucRegAccelConfig2 != 0)
+    {
+        MPU6050_RegListAdd(list, variant->ucRegAccelConfig2, dlpfConfig << AccelConfig2Dlpf);
+    }
+}
+
+/* Program the sample rate divider and DLPF, the variant's accelerometer DLPF too.
+ * Returns 0, or -1 if a write failed. */
+int32 MPU6050_SetSampleRate(int fd, const MPU6050_Variant_t *variant, uint8 sampleRateDiv, uint8 dlpfConfig)
+{
+    MPU6050_RegList_t list = {0};
+
+    MPU6050_SampleRateWrites(&list, variant, sampleRateDiv, dlpfConfig);
+
+    return MPU6050_WriteRegs(fd, &list);
+}
+
+/* Queue a FIFO reset that leaves it enabled; with dmp, one that restarts the DMP */
+void MPU6050_FifoResetWrites(MPU6050_RegList_t *list, bool dmp)
+{
+    if (!dmp)
+    {
+        MPU6050_RegListAdd(list, RegUserCtrl, (1 << UserCtrlFifoEn) | (1 << UserCtrlFifoReset));
+        return;
+    }
+
+    /* A DMP left running would go on from the middle of a packet */
+    MPU6050_RegListAdd(list, RegUserCtrl, (1 << UserCtrlFifoReset) | (1 << UserCtrlDmpReset));
+    MPU6050_RegListAdd(list, RegUserCtrl, (1 << UserCtrlFifoEn) | (1 << UserCtrlDmpEn));
+}
+
+/* Discard the FIFO contents and keep it enabled; with dmp, restart the DMP with it.
+ * Returns 0, or -1 if a write failed. */
+int32 MPU6050_ResetFifo(int fd, bool dmp)
+{
+    MPU6050_RegList_t list = {0};
+
+    MPU6050_FifoResetWrites(&list, dmp);
+
+    return MPU6050_WriteRegs(fd, &list);
+}
+
+/* Write len bytes of DMP memory from addr (bank << 8 | offset) in one transfer. The
+ * bytes must not run past the end of the bank. Returns the data bytes written. */
+uint32 MPU6050_WriteMemory(int fd, uint16 addr, const uint8 *data, uint32 len)
+{
+    uint8   buffer[1 + MPU6050_DMP_BANK_SIZE];
+    ssize_t bytes;
+
+    if (len == 0 || (addr % MPU6050_DMP_BANK_SIZE) + len > MPU6050_DMP_BANK_SIZE)
+    {
+        return 0;
+    }
+
+    /* BANK_SEL and MEM_START_ADDR in one write */
+    if (MPU6050_write16(fd, RegBankSel, (uint8) (addr >> 8), (uint8) addr) < 3)
+    {
+        return 0;
+    }
+
+    buffer[0] = RegMemRW;
+    memcpy(&buffer[1], data, len);
+    bytes = MPU6050_BusWrite(fd, buffer, len + 1);
+
+    return (bytes > 1) ? (uint32) (bytes - 1) : 0;
+}
+
+/* Read len bytes of DMP memory from addr in one transfer, under the same rule */
+uint32 MPU6050_ReadMemory(int fd, uint16 addr, uint8 *data, uint32 len)
+{
+    if (len == 0 || (addr % MPU6050_DMP_BANK_SIZE) + len > MPU6050_DMP_BANK_SIZE)
+    {
+        return 0;
+    }
+
+    if (MPU6050_write16(fd, RegBankSel, (uint8) (addr >> 8), (uint8) addr) < 3)
+    {
+        return 0;
+    }
+
+    return MPU6050_ReadArbitrary(fd, RegMemRW, data, len);
 }
 
 int32 MPU6050_SetAccelScale(MPU6050_AcceleormeterScale_t scale)
@@ -60,8 +613,37 @@ int32 MPU6050_SetGyroScale(MPU6050_GyroScale_t scale)
     return -1;
 }
 
-int32 MPU6050_ResetDevice(void)
+/* Reset every register to its power-on value; the device is left asleep */
+int32 MPU6050_ResetDevice(int fd)
 {
-    CFE_EVS_SendEvent(MPU6050_DEVICE_ERR_EID, CFE_EVS_EventType_ERROR, "Unimpliemented!");
-    return -1;
+    if (MPU6050_write8(fd, RegPowerManagment1, 1 << PwrMgmt1DeviceReset) < 2)
+    {
+        return -1;
+    }
+
+    /* DEVICE_RESET clears itself once the reset is done, within 100 ms */
+    usleep(100000);
+
+    if (MPU6050_read8(fd, RegPowerManagment1) & (1 << PwrMgmt1DeviceReset))
+    {
+        return -1;
+    }
+
+    /* On SPI the data sheets want the signal paths reset too, and the reset turned
+     * the I2C interface back on */
+    if (MPU6050_Spi_IsSpi(fd))
+    {
+        if (MPU6050_write8(fd, RegSignalPathReset, SignalPathResetAll) < 2)
+        {
+            return -1;
+        }
+        usleep(100000);
+
+        if (MPU6050_write8(fd, RegUserCtrl, 1 << UserCtrlI2cIfDis) < 2)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
 }
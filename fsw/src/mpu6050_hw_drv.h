@@ -3,6 +3,11 @@
 
 #include "cfe.h"
 #include "mpu6050_registers.h"
+#include "mpu6050_private_types.h"
+#include "mpu6050_variant.h"
+
+/* Read an 8 bit register */
+uint8 MPU6050_read8(int fd, uint8 reg);
 
 /* Read a 16 bit register */
 uint16 MPU6050_read16(int fd, uint8 reg);
@@ -13,11 +18,76 @@ uint32 MPU6050_write8(int fd, uint8 reg, uint8 val);
 /* Write a 16 bit register */
 uint32 MPU6050_write16(int fd, uint8 reg, uint8 val1, uint8 val2);
 
+/* Open the bus to the device at addr, a simulated device for a "sim:<profile>" path,
+ * a capture to play back for a "replay:<file>" path, or the SPI device at a spidev
+ * path (addr unused). Returns the handle, or -1 with errno set. */
+int MPU6050_OpenDevice(const char *path, uint8 addr);
+
+/* Close a handle from MPU6050_OpenDevice */
+void MPU6050_CloseDevice(int fd);
+
+/* Variant of the device behind fd by its WHO_AM_I, which is returned in whoAmI; NULL
+ * if no variant answers it */
+const MPU6050_Variant_t *MPU6050_DetectVariant(int fd, uint8 *whoAmI);
+
+/* Whether batches to fd go out as I2C_RDWR ioctls; false off I2C, and once the
+ * adapter has refused one (SMBus only), when they are sent one transfer each */
+bool MPU6050_BusBatched(int fd);
+
+/* CLOCK_MONOTONIC (ns) when the last transfer completed; for a replay, when it did
+ * in the capture */
+uint64 MPU6050_BusTimeNsec(void);
+
 /* Read a buffer of arbitrary size from the chip */
 uint32 MPU6050_ReadArbitrary(int fd, uint8 startingAddr, uint8 *buffer, uint32 bufferLen);
 
-/* Set or reset parts of the device */
-int32 MPU6050_ResetDevice(void);
+/* FIFO_EN bits that queue the given channels */
+uint8 MPU6050_FifoEnableBits(uint8 channels);
+
+/* PWR_MGMT_2 bits that put every axis outside the given channels in standby */
+uint8 MPU6050_StandbyBits(uint8 channels);
+
+/* Queue a register write at the end of the list; one past its capacity is dropped */
+void MPU6050_RegListAdd(MPU6050_RegList_t *list, uint8 reg, uint8 val);
+
+/* Write the list in order, in as few transfers as the bus allows: one I2C_RDWR for
+ * up to 42 messages, with writes to consecutive registers merged, or one write()
+ * per message where the adapter has no I2C_RDWR. Returns 0, or -1 if a write
+ * failed. */
+int32 MPU6050_WriteRegs(int fd, const MPU6050_RegList_t *list);
+
+/* Read back every register the lists wrote below BANK_SEL in one burst, and WHO_AM_I,
+ * in one batch. Returns 0, or -1 with the first register that differs in badReg, what
+ * it read and what was written last; WHO_AM_I if the transfers failed. */
+int32 MPU6050_VerifyRegs(int fd, const MPU6050_RegList_t *lists, uint32 listCnt, uint8 whoAmI,
+                         uint8 *badReg, uint8 *readVal, uint8 *expectVal);
+
+/* Queue the sample rate divider and DLPF, the variant's accelerometer DLPF too */
+void MPU6050_SampleRateWrites(MPU6050_RegList_t *list, const MPU6050_Variant_t *variant,
+                              uint8 sampleRateDiv, uint8 dlpfConfig);
+
+/* Program the sample rate divider and DLPF, the variant's accelerometer DLPF too.
+ * Returns 0, or -1 if a write failed. */
+int32 MPU6050_SetSampleRate(int fd, const MPU6050_Variant_t *variant, uint8 sampleRateDiv, uint8 dlpfConfig);
+
+/* Queue a FIFO reset that keeps it enabled; with dmp, one that restarts the DMP */
+void MPU6050_FifoResetWrites(MPU6050_RegList_t *list, bool dmp);
+
+/* Discard the FIFO contents and keep it enabled; with dmp, restart the DMP with it.
+ * Returns 0, or -1 if a write failed. */
+int32 MPU6050_ResetFifo(int fd, bool dmp);
+
+/* Write len bytes of DMP memory from addr (bank << 8 | offset) in one transfer. The
+ * bytes must not run past the end of the bank. Returns the data bytes written. */
+uint32 MPU6050_WriteMemory(int fd, uint16 addr, const uint8 *data, uint32 len);
+
+/* Read len bytes of DMP memory from addr in one transfer, under the same rule */
+uint32 MPU6050_ReadMemory(int fd, uint16 addr, uint8 *data, uint32 len);
+
+/* Reset every register to its power-on value; the device is left asleep */
+int32 MPU6050_ResetDevice(int fd);
+
+/* Set parts of the device */
 int32 MPU6050_SetAccelScale(MPU6050_AcceleormeterScale_t scale);
 int32 MPU6050_SetGyroScale(MPU6050_GyroScale_t scale);
 
@@ -29,6 +29,9 @@
 #include "cfe.h"
 #include "cfe_msg.h"
 #include "common_types.h"
+#include "mpu6050_diag.h"
+#include "mpu6050_age.h"
+#include "mpu6050_rt.h"
 
 /*
 ** Local Defines
@@ -53,6 +56,42 @@
 #define MPU6050_SET_DEVICE_GYRO_SCALE_1000DPS_CC      9
 #define MPU6050_SET_DEVICE_GYRO_SCALE_2000DPS_CC     10
 
+/*
+** Onboard recorder commands
+*/
+#define MPU6050_REC_DUMP_FILE_CC                     11
+#define MPU6050_REC_DUMP_TLM_CC                      12
+#define MPU6050_REC_DUMP_ABORT_CC                    13
+
+/*
+** Trace commands
+*/
+#define MPU6050_TRACE_DUMP_CC                        14
+#define MPU6050_TRACE_DECODE_CC                      15
+
+/*
+** Diagnostics commands
+*/
+#define MPU6050_RESET_DIAG_CC                        16
+
+/*
+** Power commands
+*/
+#define MPU6050_SET_POWER_CC                         17
+
+/*
+** Bus capture commands
+*/
+#define MPU6050_CAPTURE_START_CC                     18
+#define MPU6050_CAPTURE_STOP_CC                      19
+
+/* Device power states (MPU6050_PowerCmd_t) */
+#define MPU6050_POWER_ACTIVE        0  /* Accel and gyro sampling                          */
+#define MPU6050_POWER_GYRO_STANDBY  1  /* Accel only, gyros in standby                     */
+#define MPU6050_POWER_CYCLE         2  /* Accel only, one sample per low-power wake-up     */
+#define MPU6050_POWER_SLEEP         3  /* Nothing sampled and nothing read                 */
+#define MPU6050_POWER_STATE_CNT     4
+
 /*
 ** Local Structure Declarations
 */
@@ -61,10 +100,62 @@ typedef struct
     CFE_MSG_TelemetryHeader_t TlmHeader;
     uint32                    usCmdCnt;
     uint32                    usCmdErrCnt;
+    uint32                    uiFifoOverflowCnt; /* FIFO overflows, each loses samples  */
+    uint32                    uiTimeResyncCnt;   /* Sample clock fit restarts            */
+    float                     fClockDriftPpm;    /* Sensor oscillator error vs. nominal  */
+    uint32                    uiZeroCopyPubCnt;  /* Packets built in place in SB buffers  */
+    uint32                    uiBufAllocErrCnt;  /* SB buffer allocation failures         */
+    uint32                    uiRecBlockSeq;     /* Newest recorder block, 0 when off     */
+    uint32                    uiRecDumpCnt;      /* Blocks dumped by the last dump        */
+    uint32                    uiRecSyncErrCnt;   /* Failed recorder msyncs                */
+    MPU6050_AgeStats_t        SampleAge;         /* Latest sample acquisition to publish  */
+    uint32                    uiTickSkipCnt;     /* Acquisition ticks lost to overruns    */
+    MPU6050_RtStatus_t        Realtime;          /* Scheduling settings in effect          */
+    uint32                    uiSbRcvCallCnt;    /* SB receive calls in the last cycle     */
+    uint32                    uiSbRcvCallMax;    /* Most SB receive calls in any cycle     */
+    uint8                     ucRateProfile;     /* Rate profile in effect, 0xFF if fixed  */
+    uint8                     aucSpare[3];
+    uint32                    uiRateSwitchCnt;   /* Adaptive rate profile changes          */
+    float                     fMotionGyroDps;    /* Gyro RMS over the last motion window   */
+    float                     fMotionAccelMg;    /* Accel std-dev over the last window     */
+    uint8                     ucPowerState;      /* MPU6050_POWER_*                        */
+    uint8                     ucWakeRate;        /* LP_WAKE_CTRL code used in cycle mode   */
+    uint8                     ucChannelMask;     /* MPU6050_CHAN_* being sampled           */
+    uint8                     ucPowerSpare;
+    uint32                    uiWakeLatencyUsec; /* Wake command to first sample, last wake */
+    uint32                    uiWakeLatencyMaxUsec;
+    float                     afPowerStateSec[MPU6050_POWER_STATE_CNT]; /* Residency since start */
+    uint8                     ucFusionDevices;   /* Devices fused, this one included; 0 if off */
+    uint8                     ucFusionUsedMask;  /* Newest fused sample: bit 0 this device,  */
+    uint8                     ucFusionStaleMask; /*   bit n the n'th peer in the table        */
+    uint8                     ucFusionFaultMask;
+    uint32                    uiFusionFaultCnt;  /* Devices faulted by the vote, all told     */
+    uint32                    uiFusionLostCnt;   /* Samples lost before they could be fused   */
+    uint32                    uiFusionPeerErrCnt; /* Peer packets that could not be used      */
+    uint8                     ucDmpFeatures;     /* MPU6050_DMP_FEAT_* of the DMP packets,   */
+    uint8                     aucDmpSpare[3];    /*   0 while the DMP is off                  */
+    uint32                    uiDmpLoadUsec;     /* Image load, verify and setup, last time   */
+    uint32                    uiDmpPacketErrCnt; /* FIFO restarts for a packet out of step    */
+    uint8                     ucWhoAmI;          /* Of the device found; sets its variant     */
+    uint8                     aucVariantSpare[3];
+    uint32                    uiIdleDeferCnt;    /* Ticks the SCH pipe waited for idle time   */
+    uint32                    uiCopyPubCnt;      /* Packets built here, then copied to SB     */
 
     /* TODO:  Add declarations for additional housekeeping data here */
 } MPU6050_HkTlm_t;
 
+/* Timing diagnostics, sent with housekeeping.  Accumulates until MPU6050_RESET_DIAG_CC. */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader;
+    uint32                    uiDeadlineNsec;    /* Cycle budget, MPU6050_DIAG_DEADLINE_PCT
+                                                    of the acquisition period            */
+    uint32                    uiDeadlineMissCnt; /* Cycles that ran past it                 */
+    MPU6050_Histogram_t       Stage[MPU6050_STAGE_CNT]; /* Time spent per MPU6050_STAGE_*  */
+    MPU6050_Jitter_t          WakeJitter;        /* Wakeup to wakeup vs. the sample period  */
+    MPU6050_Jitter_t          ReadJitter;        /* Device read to device read              */
+} MPU6050_DiagTlm_t;
+
 
 #endif /* _MPU6050_MSG_H_ */
 
@@ -39,6 +39,9 @@
 #define MPU6050_ILOAD_INF_EID  3
 #define MPU6050_CDS_INF_EID    4
 #define MPU6050_CMD_INF_EID    5
+#define MPU6050_REC_INF_EID    6
+#define MPU6050_FUSION_INF_EID 7
+#define MPU6050_DMP_INF_EID    8
 
 #define MPU6050_ERR_EID         51
 #define MPU6050_INIT_ERR_EID    52
@@ -49,8 +52,11 @@
 #define MPU6050_MSGID_ERR_EID   57
 #define MPU6050_MSGLEN_ERR_EID  58
 #define MPU6050_DEVICE_ERR_EID  59
+#define MPU6050_REC_ERR_EID     60
+#define MPU6050_FUSION_ERR_EID  61
+#define MPU6050_DMP_ERR_EID     62
 
-#define MPU6050_EVT_CNT  15
+#define MPU6050_EVT_CNT  21
 
 #endif /* _MPU6050_PRIVATE_IDS_H_ */
 
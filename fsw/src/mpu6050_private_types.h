@@ -29,11 +29,23 @@
 */
 #include "cfe.h"
 #include "cfe_msg.h"
+#include "mpu6050_platform_cfg.h"
+#include "mpu6050_registers.h"
+#include "mpu6050_core_types.h"
+#include "mpu6050_compress.h"
+#include "mpu6050_vote.h"
+#include "mpu6050_dmp.h"
 
 /*
 ** Local Defines
 */
 
+/* Rate profile tag of samples taken at the fixed rate in the configuration table */
+#define MPU6050_RATE_PROFILE_FIXED  0xFF
+
+/* Register writes a MPU6050_RegList_t holds, a full device configuration and more */
+#define MPU6050_MAX_REG_WRITES  24
+
 /*
 ** Local Structure Declarations
 */
@@ -43,15 +55,55 @@ typedef struct
     CFE_MSG_CommandHeader_t ucCmdHeader;
 } MPU6050_NoArgCmd_t;
 
+/* Register writes sent together, in order (see MPU6050_WriteRegs) */
+typedef struct
+{
+    uint8   ucReg;
+    uint8   ucVal;
+} MPU6050_RegWrite_t;
+
+typedef struct
+{
+    uint32  uiCnt;
+    MPU6050_RegWrite_t Writes[MPU6050_MAX_REG_WRITES];
+} MPU6050_RegList_t;
+
+/* MPU6050_TRACE_DUMP_CC and MPU6050_TRACE_DECODE_CC */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t ucCmdHeader;
+    char    dumpPath[OS_MAX_PATH_LEN];
+} MPU6050_TraceDumpCmd_t;
+
+
+/* MPU6050_CAPTURE_START_CC */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t ucCmdHeader;
+    char    capturePath[OS_MAX_PATH_LEN];
+} MPU6050_CaptureCmd_t;
+
+/* MPU6050_SET_POWER_CC */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t ucCmdHeader;
+    uint8   ucPowerState;      /* MPU6050_POWER_* */
+    uint8   ucWakeRate;        /* LPWake* code, used by MPU6050_POWER_CYCLE */
+    uint16  usSpare;
+} MPU6050_PowerCmd_t;
 
 typedef struct
 {
     uint32  counter;
 
-    /* TODO:  Add input data to this application here, such as raw data read from I/O
-    **        devices or data subscribed from other apps' output data.
-    */
+    uint32  uiSampleCnt;       /* Samples returned by the last device read */
+    uint64  uiFirstSampleIdx;  /* Time model index of Samples[0] */
+    double  dReadTime;         /* CLOCK_MONOTONIC time the read was sampled (s) */
+    CFE_TIME_SysTime_t readTimeTag; /* CFE time at dReadTime */
 
+    MPU6050_RawSample_t Samples[MPU6050_FIFO_MAX_SAMPLES];
+    MPU6050_DmpQuat_t   Quats[MPU6050_FIFO_MAX_SAMPLES]; /* With the DMP on, its attitude
+                                                            at each sample */
 } MPU6050_InData_t;
 
 typedef struct
@@ -65,8 +117,122 @@ typedef struct
     double  gyroXDegsSec; /* Gyro angular rates, X, Y, and Z BF (degs/sec)*/
     double  gyroYDegsSec;
     double  gyroZDegsSec;
+    uint64  uiAcqTimeNsec; /* CLOCK_MONOTONIC when the sensor latched the sample */
+    uint64  uiPubTimeNsec; /* CLOCK_MONOTONIC when the packet was handed to SB */
+    uint8   ucRateProfile; /* Rate profile the sample was taken under */
+    uint8   aucSpare[7];
 } MPU6050_OutData_t;
 
+/* Statistics over one decimation window of samples */
+typedef struct
+{
+    MPU6050_Sample_t    mean;        /* Calibrated mean, from the rounded mean counts */
+    MPU6050_RawSample_t minRaw;      /* Per channel extremes, ADC counts */
+    MPU6050_RawSample_t maxRaw;
+    uint16              usSampleCnt; /* Samples in the window */
+    uint16              usSpare;
+} MPU6050_Summary_t;
+
+/* Header shared by all stream packets. Entry n was taken at
+** baseTime + n * uiSamplePeriodNsec. Only the first usSampleCnt entries
+** are sent; the packet length is trimmed to match. The scale codes and
+** table version name everything needed to convert raw counts with mpu6050_conv.h.
+** Raw and calibrated entries hold only the channels in ucChannelMask, in order,
+** packed back to back (see MPU6050_PackRaw and MPU6050_PackCalibrated). */
+typedef struct
+{
+    uint32  uiCounter;         /* Packets sent on the stream */
+    uint16  usSampleCnt;       /* Entries in the packet */
+    uint8   ucAccelScale;      /* ACCEL_CONFIG scale code (MPU6050_AcceleormeterScale_t) */
+    uint8   ucGyroScale;       /* GYRO_CONFIG scale code (MPU6050_GyroScale_t) */
+    CFE_TIME_SysTime_t baseTime;
+    uint32  uiSamplePeriodNsec;
+    uint16  usTableVersion;    /* Config table (calibration) version */
+    uint8   ucStreamNum;       /* Stream table entry the packet was built for */
+    uint8   ucRateProfile;     /* Rate profile of every entry, or MPU6050_RATE_PROFILE_FIXED */
+    uint8   ucChannelMask;     /* MPU6050_CHAN_* sampled for every entry */
+    uint8   aucSpare[7];
+} MPU6050_BatchHdr_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t ucTlmHeader;
+    MPU6050_BatchHdr_t Batch;
+} MPU6050_OutBatchHdr_t;
+
+/* Calibrated samples */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t ucTlmHeader;
+    MPU6050_BatchHdr_t Batch;
+    MPU6050_Sample_t Samples[MPU6050_MAX_BATCH_SAMPLES];
+} MPU6050_OutBatch_t;
+
+/* Samples left in ADC counts */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t ucTlmHeader;
+    MPU6050_BatchHdr_t Batch;
+    MPU6050_RawSample_t Samples[MPU6050_MAX_BATCH_SAMPLES];
+} MPU6050_OutRawBatch_t;
+
+/* Raw samples coded as one self-contained block by MPU6050_CompressBlock.
+** Only usBlockBytes of aucBlock are sent. */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t ucTlmHeader;
+    MPU6050_BatchHdr_t Batch;
+    uint16  usBlockBytes;
+    uint16  usSpare;
+    uint8   aucBlock[MPU6050_COMP_MAX_BLOCK_BYTES(MPU6050_MAX_BATCH_SAMPLES)];
+} MPU6050_OutCompBatch_t;
+
+/* Attitude, one entry per processing cycle */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t ucTlmHeader;
+    MPU6050_BatchHdr_t Batch;
+    MPU6050_Attitude_t Attitude[MPU6050_MAX_BATCH_SAMPLES];
+} MPU6050_OutAttBatch_t;
+
+/* Window statistics; baseTime and the period refer to the first sample of each window */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t ucTlmHeader;
+    MPU6050_BatchHdr_t Batch;
+    MPU6050_Summary_t Summary[MPU6050_MAX_BATCH_SAMPLES];
+} MPU6050_OutSummary_t;
+
+/* Fused samples of this device and its peers, one entry per sample of this device.
+** Bit 0 of the health masks is this device, bit n the n'th peer in the table (from 1). */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t ucTlmHeader;
+    MPU6050_BatchHdr_t Batch;
+    MPU6050_FusedSample_t Fused[MPU6050_MAX_BATCH_SAMPLES];
+} MPU6050_OutFusedBatch_t;
+
+/* DMP attitude quaternions [w x y z] (Q30), one entry per packet the DMP sent */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t ucTlmHeader;
+    MPU6050_BatchHdr_t Batch;
+    MPU6050_DmpQuat_t Quat[MPU6050_MAX_BATCH_SAMPLES];
+} MPU6050_OutQuatBatch_t;
+
+/* Any stream packet. All members start with the same header. */
+typedef union
+{
+    MPU6050_OutBatchHdr_t  Hdr;
+    MPU6050_OutBatch_t     Cal;
+    MPU6050_OutRawBatch_t  Raw;
+    MPU6050_OutCompBatch_t Comp;
+    MPU6050_OutAttBatch_t  Att;
+    MPU6050_OutSummary_t   Sum;
+    MPU6050_OutFusedBatch_t Fus;
+    MPU6050_OutQuatBatch_t Quat;
+} MPU6050_StreamPkt_t;
+
 /* TODO:  Add more private structure definitions here, if necessary. */
 
 /*
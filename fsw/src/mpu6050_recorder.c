@@ -0,0 +1,698 @@
+/*=======================================================================================
+** File Name:  mpu6050_recorder.c
+**
+** Title:  Onboard Recorder for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To keep the most recent raw samples in a fixed-size, preallocated circular
+**           file that is mapped into memory, and to dump time windows of it to a file
+**           or to telemetry on command.
+**
+** Functions Defined:
+**    MPU6050_RecorderOpen      - Map the recorder file and recover the write cursor
+**    MPU6050_RecordNewData     - Append the samples of the last device read
+**    MPU6050_RecorderService   - Sync the file and make progress on a dump
+**    MPU6050_RecorderStartDump - Start dumping a time window
+**    MPU6050_RecorderStopDump  - Finish or abort a dump
+**    MPU6050_RecorderClose     - Sync and unmap the recorder file
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Recording is plain stores into the mapping; the only system calls are the msync
+**    and dump I/O in MPU6050_RecorderService, once per cycle at most.
+** 2: After a crash the block being filled keeps the samples recorded up to the last
+**    msync.  Recording resumes in a new block after the newest one found.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Pragmas
+*/
+
+/*
+** Include Files
+*/
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "cfe.h"
+#include "cfe_evs.h"
+#include "cfe_msg.h"
+#include "cfe_time.h"
+#include "mpu6050_app.h"
+#include "mpu6050_conv.h"
+#include "mpu6050_recorder.h"
+
+/*
+** Local Defines
+*/
+
+/* Block headers a dump looks at per cycle, dumped or not */
+#define MPU6050_REC_DUMP_SCAN_PER_CYCLE  64
+
+/*
+** External Global Variables
+*/
+extern MPU6050_AppData_t  g_MPU6050_AppData;
+
+/*
+** Local Function Definitions
+*/
+
+static MPU6050_RecBlockHdr_t *MPU6050_RecBlock(uint32 Seq)
+{
+    MPU6050_Recorder_t *RecPtr = &g_MPU6050_AppData.Recorder;
+
+    return (MPU6050_RecBlockHdr_t*) (RecPtr->MapPtr +
+            (size_t) (1 + (Seq - 1) % RecPtr->uiBlockCnt) * MPU6050_REC_BLOCK_BYTES);
+}
+
+static void MPU6050_RecFillFileHdr(MPU6050_RecFileHdr_t *FileHdrPtr, uint32 BlockCnt)
+{
+    memset(FileHdrPtr, 0x00, sizeof(*FileHdrPtr));
+    FileHdrPtr->uiMagic       = MPU6050_REC_FILE_MAGIC;
+    FileHdrPtr->usVersion     = MPU6050_REC_VERSION;
+    FileHdrPtr->usByteOrder   = MPU6050_REC_BYTE_ORDER;
+    FileHdrPtr->uiBlockBytes  = MPU6050_REC_BLOCK_BYTES;
+    FileHdrPtr->uiBlockCnt    = BlockCnt;
+    FileHdrPtr->uiSampleBytes = sizeof(MPU6050_RawSample_t);
+}
+
+/* Newest valid block sequence number in the mapping, 0 if there is none */
+static uint32 MPU6050_RecRecover(void)
+{
+    MPU6050_Recorder_t          *RecPtr = &g_MPU6050_AppData.Recorder;
+    const MPU6050_RecBlockHdr_t *hdrPtr;
+    uint32                       newest = 0;
+    uint32                       i;
+
+    for (i = 0; i < RecPtr->uiBlockCnt; i++)
+    {
+        hdrPtr = (const MPU6050_RecBlockHdr_t*) (RecPtr->MapPtr + (size_t) (i + 1) * MPU6050_REC_BLOCK_BYTES);
+
+        if (hdrPtr->uiMagic == MPU6050_REC_BLOCK_MAGIC &&
+            hdrPtr->uiSeq != 0 && (hdrPtr->uiSeq - 1) % RecPtr->uiBlockCnt == i &&
+            hdrPtr->ucChannelMask != 0 &&
+            hdrPtr->usSampleCnt <= MPU6050_REC_BLOCK_SAMPLES(MPU6050_ChannelCnt(hdrPtr->ucChannelMask)) &&
+            hdrPtr->uiSeq > newest)
+        {
+            newest = hdrPtr->uiSeq;
+        }
+    }
+
+    return newest;
+}
+
+/* Claim the next block and start it with sample SampleNum of the last read */
+static void MPU6050_RecStartBlock(uint32 SampleNum)
+{
+    MPU6050_Recorder_t    *RecPtr = &g_MPU6050_AppData.Recorder;
+    MPU6050_RecBlockHdr_t *hdrPtr;
+
+    RecPtr->uiSeq++;
+    hdrPtr = MPU6050_RecBlock(RecPtr->uiSeq);
+
+    /* Invalidate the block being overwritten before its contents change */
+    hdrPtr->uiMagic        = 0;
+    hdrPtr->firstTime      = MPU6050_GetSampleTime(SampleNum);
+    hdrPtr->lastTime       = hdrPtr->firstTime;
+    hdrPtr->usSampleCnt    = 0;
+    hdrPtr->ucAccelScale   = g_MPU6050_AppData.ConfigTbl->initialAccelScale;
+    hdrPtr->ucGyroScale    = g_MPU6050_AppData.ConfigTbl->initialGyroScale;
+    hdrPtr->usTableVersion = g_MPU6050_AppData.ConfigTbl->tableVersion;
+    hdrPtr->ucRateProfile  = g_MPU6050_AppData.ucRateProfile;
+    hdrPtr->ucChannelMask  = g_MPU6050_AppData.ucChannelMask;
+    hdrPtr->uiSeq          = RecPtr->uiSeq;
+    hdrPtr->uiMagic        = MPU6050_REC_BLOCK_MAGIC;
+
+    RecPtr->CurPtr = hdrPtr;
+    g_MPU6050_AppData.HkTlm.uiRecBlockSeq = RecPtr->uiSeq;
+}
+
+/* Dump one block; false if it has to be retried next cycle */
+static bool MPU6050_RecDumpBlock(const MPU6050_RecBlockHdr_t *HdrPtr)
+{
+    MPU6050_Recorder_t    *RecPtr = &g_MPU6050_AppData.Recorder;
+    MPU6050_RecBlockTlm_t *tlmPtr;
+    CFE_SB_Buffer_t       *bufPtr;
+    size_t                 usedBytes = sizeof(MPU6050_RecBlockHdr_t) +
+                                       HdrPtr->usSampleCnt * MPU6050_ChannelCnt(HdrPtr->ucChannelMask) * sizeof(int16);
+
+    if (RecPtr->ucDumpMode == MPU6050_REC_DUMP_FILE)
+    {
+        /* Whole blocks, so a dump file has the same layout as the recorder file */
+        if (write(RecPtr->DumpFileID, HdrPtr, MPU6050_REC_BLOCK_BYTES) != MPU6050_REC_BLOCK_BYTES)
+        {
+            CFE_EVS_SendEvent(MPU6050_REC_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - Recorder dump write failed, dump stopped");
+            MPU6050_RecorderStopDump();
+            return false;
+        }
+        RecPtr->uiDumpCnt++;
+        return true;
+    }
+
+    bufPtr = MPU6050_AllocPacket(sizeof(MPU6050_RecBlockTlm_t));
+    if (bufPtr == NULL)
+    {
+        return false;
+    }
+
+    tlmPtr = (MPU6050_RecBlockTlm_t*) bufPtr;
+    CFE_MSG_Init((CFE_MSG_Message_t*) tlmPtr, CFE_SB_ValueToMsgId(MPU6050_REC_BLOCK_MID),
+                 offsetof(MPU6050_RecBlockTlm_t, aucBlock) + usedBytes);
+    tlmPtr->uiDumpCnt = ++RecPtr->uiDumpCnt;
+    tlmPtr->uiSpare   = 0;
+    memcpy(tlmPtr->aucBlock, HdrPtr, usedBytes);
+    CFE_MSG_SetMsgTime((CFE_MSG_Message_t*) tlmPtr, HdrPtr->firstTime);
+
+    MPU6050_TransmitPacket(bufPtr, true);
+    return true;
+}
+
+/*=====================================================================================
+** Name: MPU6050_RecorderOpen
+**
+** Purpose: To map the recorder file, creating and preallocating it if needed, and to
+**          recover the write cursor from its block headers
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    int32 iStatus - Status of initialization
+**
+** Routines Called:
+**    open, fstat, ftruncate, posix_fallocate, mmap, msync
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_InitApp
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->recorderPath
+**    g_MPU6050_AppData.ConfigTbl->recorderBlocks
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Recorder
+**    g_MPU6050_AppData.HkTlm.uiRecBlockSeq
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: A file written with another geometry or byte order is started over.
+** 2: The recorder is not needed to fly, so failures leave it off and return success.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_RecorderOpen(void)
+{
+    MPU6050_Recorder_t   *RecPtr = &g_MPU6050_AppData.Recorder;
+    MPU6050_RecFileHdr_t  expected;
+    struct stat           fileStat;
+    const char           *path   = g_MPU6050_AppData.ConfigTbl->recorderPath;
+
+    memset(RecPtr, 0x00, sizeof(*RecPtr));
+    RecPtr->FileID     = -1;
+    RecPtr->DumpFileID = -1;
+
+    if (path[0] == '\0' || g_MPU6050_AppData.ConfigTbl->recorderBlocks == 0)
+    {
+        return CFE_SUCCESS;
+    }
+
+    RecPtr->uiBlockCnt = g_MPU6050_AppData.ConfigTbl->recorderBlocks;
+    RecPtr->MapSize    = (size_t) (RecPtr->uiBlockCnt + 1) * MPU6050_REC_BLOCK_BYTES;
+
+    RecPtr->FileID = open(path, O_RDWR | O_CREAT, 0644);
+    if (RecPtr->FileID < 0 || fstat(RecPtr->FileID, &fileStat) != 0)
+    {
+        CFE_EVS_SendEvent(MPU6050_REC_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Failed to open recorder file %s, recorder off", path);
+        MPU6050_RecorderClose();
+        return CFE_SUCCESS;
+    }
+
+    /* Reserve every block now so recording can never run out of space */
+    if ((size_t) fileStat.st_size != RecPtr->MapSize &&
+        (ftruncate(RecPtr->FileID, (off_t) RecPtr->MapSize) != 0 ||
+         posix_fallocate(RecPtr->FileID, 0, (off_t) RecPtr->MapSize) != 0))
+    {
+        CFE_EVS_SendEvent(MPU6050_REC_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Failed to allocate %lu bytes for recorder file %s, recorder off",
+                (unsigned long) RecPtr->MapSize, path);
+        MPU6050_RecorderClose();
+        return CFE_SUCCESS;
+    }
+
+    RecPtr->MapPtr = mmap(NULL, RecPtr->MapSize, PROT_READ | PROT_WRITE, MAP_SHARED, RecPtr->FileID, 0);
+    if (RecPtr->MapPtr == MAP_FAILED)
+    {
+        RecPtr->MapPtr = NULL;
+        CFE_EVS_SendEvent(MPU6050_REC_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Failed to map recorder file %s, recorder off", path);
+        MPU6050_RecorderClose();
+        return CFE_SUCCESS;
+    }
+
+    MPU6050_RecFillFileHdr(&expected, RecPtr->uiBlockCnt);
+    if (memcmp(RecPtr->MapPtr, &expected, sizeof(expected)) != 0)
+    {
+        memset(RecPtr->MapPtr, 0x00, RecPtr->MapSize);
+        memcpy(RecPtr->MapPtr, &expected, sizeof(expected));
+        msync(RecPtr->MapPtr, RecPtr->MapSize, MS_SYNC);
+    }
+
+    RecPtr->uiSeq         = MPU6050_RecRecover();
+    RecPtr->CurPtr        = NULL;
+    RecPtr->dLastSyncTime = MPU6050_GetMonotonicTime();
+    g_MPU6050_AppData.HkTlm.uiRecBlockSeq = RecPtr->uiSeq;
+
+    CFE_EVS_SendEvent(MPU6050_REC_INF_EID, CFE_EVS_EventType_INFORMATION,
+            "MPU6050 - Recorder %s: %u blocks of %u full samples, resuming after block %u",
+            path, (unsigned int) RecPtr->uiBlockCnt,
+            (unsigned int) MPU6050_REC_BLOCK_SAMPLES(MPU6050_ChannelCnt(MPU6050_CHAN_ALL)),
+            (unsigned int) RecPtr->uiSeq);
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_RecordNewData
+**
+** Purpose: To append the raw samples of the last device read to the recorder
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    MPU6050_GetSampleTime
+**    MPU6050_PackRaw
+**
+** Called By:
+**    MPU6050_AppMain
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.InData
+**    g_MPU6050_AppData.ConfigTbl->useFifo
+**    g_MPU6050_AppData.ucChannelMask
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Recorder
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Samples are copied a block-sized run at a time; sample times are only worked out
+**    where a block starts and where a run ends.
+** 2: A gap in the sample index closes the current block, so every block holds evenly
+**    spaced samples.
+** 3: Samples are packed to the channels being sampled.  A change of channels closes
+**    the current block, so every block holds one layout.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_RecordNewData(void)
+{
+    MPU6050_Recorder_t     *RecPtr = &g_MPU6050_AppData.Recorder;
+    const MPU6050_InData_t *inData = &g_MPU6050_AppData.InData;
+    uint8                   channels     = g_MPU6050_AppData.ucChannelMask;
+    uint32                  chanCnt      = MPU6050_ChannelCnt(channels);
+    uint32                  blockSamples = MPU6050_REC_BLOCK_SAMPLES(chanCnt);
+    int16                  *dstPtr;
+    uint32                  runCnt;
+    uint32                  n;
+    uint32                  i = 0;
+
+    if (RecPtr->MapPtr == NULL || inData->uiSampleCnt == 0)
+    {
+        return;
+    }
+
+    if (RecPtr->CurPtr != NULL &&
+        ((g_MPU6050_AppData.ConfigTbl->useFifo && inData->uiFirstSampleIdx != RecPtr->uiNextIdx) ||
+         RecPtr->CurPtr->ucChannelMask != channels))
+    {
+        RecPtr->CurPtr = NULL;
+    }
+
+    while (i < inData->uiSampleCnt)
+    {
+        if (RecPtr->CurPtr == NULL || RecPtr->CurPtr->usSampleCnt >= blockSamples)
+        {
+            MPU6050_RecStartBlock(i);
+        }
+
+        runCnt = blockSamples - RecPtr->CurPtr->usSampleCnt;
+        if (runCnt > inData->uiSampleCnt - i)
+        {
+            runCnt = inData->uiSampleCnt - i;
+        }
+
+        dstPtr = (int16*) (RecPtr->CurPtr + 1) + (size_t) RecPtr->CurPtr->usSampleCnt * chanCnt;
+        for (n = 0; n < runCnt; n++)
+        {
+            dstPtr += MPU6050_PackRaw(&inData->Samples[i + n], channels, dstPtr);
+        }
+
+        i += runCnt;
+        RecPtr->CurPtr->lastTime     = MPU6050_GetSampleTime(i - 1);
+        RecPtr->CurPtr->usSampleCnt += runCnt;
+    }
+
+    RecPtr->uiNextIdx = inData->uiFirstSampleIdx + inData->uiSampleCnt;
+}
+
+/*=====================================================================================
+** Name: MPU6050_RecorderService
+**
+** Purpose: To flush the recorder file to storage when due, and to move a dump along
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    msync
+**    MPU6050_GetMonotonicTime
+**    MPU6050_RecorderStopDump
+**
+** Called By:
+**    MPU6050_AppMain
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->recorderSyncMsec
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Recorder
+**    g_MPU6050_AppData.HkTlm.uiRecSyncErrCnt
+**    g_MPU6050_AppData.HkTlm.uiRecDumpCnt
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The msync is asynchronous; it schedules write back without waiting for it.
+** 2: A dump sends at most MPU6050_REC_DUMP_BLOCKS_PER_CYCLE blocks per cycle so that
+**    it does not starve the rest of the loop or flood SB.  A block overwritten before
+**    the dump gets to it is skipped.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_RecorderService(void)
+{
+    MPU6050_Recorder_t          *RecPtr = &g_MPU6050_AppData.Recorder;
+    const MPU6050_RecBlockHdr_t *hdrPtr;
+    double                       now;
+    uint32                       dumped  = 0;
+    uint32                       scanned = 0;
+
+    if (RecPtr->MapPtr == NULL)
+    {
+        return;
+    }
+
+    now = MPU6050_GetMonotonicTime();
+    if ((now - RecPtr->dLastSyncTime) * 1000.0 >= g_MPU6050_AppData.ConfigTbl->recorderSyncMsec)
+    {
+        if (msync(RecPtr->MapPtr, RecPtr->MapSize, MS_ASYNC) != 0)
+        {
+            g_MPU6050_AppData.HkTlm.uiRecSyncErrCnt++;
+        }
+        RecPtr->dLastSyncTime = now;
+    }
+
+    while (RecPtr->ucDumpMode != MPU6050_REC_DUMP_NONE &&
+           dumped < MPU6050_REC_DUMP_BLOCKS_PER_CYCLE && scanned < MPU6050_REC_DUMP_SCAN_PER_CYCLE)
+    {
+        if (RecPtr->uiDumpSeq > RecPtr->uiDumpEndSeq)
+        {
+            MPU6050_RecorderStopDump();
+            break;
+        }
+
+        hdrPtr = MPU6050_RecBlock(RecPtr->uiDumpSeq);
+        scanned++;
+
+        if (hdrPtr->uiMagic == MPU6050_REC_BLOCK_MAGIC && hdrPtr->uiSeq == RecPtr->uiDumpSeq &&
+            hdrPtr->usSampleCnt > 0 &&
+            CFE_TIME_Compare(hdrPtr->lastTime, RecPtr->dumpStart) != CFE_TIME_A_LT_B &&
+            CFE_TIME_Compare(hdrPtr->firstTime, RecPtr->dumpEnd) != CFE_TIME_A_GT_B)
+        {
+            if (!MPU6050_RecDumpBlock(hdrPtr))
+            {
+                break;
+            }
+            dumped++;
+        }
+
+        RecPtr->uiDumpSeq++;
+    }
+
+    g_MPU6050_AppData.HkTlm.uiRecDumpCnt = RecPtr->uiDumpCnt;
+}
+
+/*=====================================================================================
+** Name: MPU6050_RecorderStartDump
+**
+** Purpose: To start dumping the recorded blocks that overlap a time window
+**
+** Arguments:
+**    const MPU6050_RecDumpCmd_t *CmdPtr - Time window and dump file
+**    uint8                       Mode   - MPU6050_REC_DUMP_FILE or MPU6050_REC_DUMP_TLM
+**
+** Returns:
+**    int32 iStatus - CFE_SUCCESS if the dump was started
+**
+** Routines Called:
+**    open, write
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_ProcessNewAppCmds
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Recorder
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Blocks are dumped whole, oldest first; the receiver trims them to the window.
+** 2: The block being filled is dumped as far as it has been filled.
+** 3: Only one dump runs at a time.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_RecorderStartDump(const MPU6050_RecDumpCmd_t *CmdPtr, uint8 Mode)
+{
+    MPU6050_Recorder_t *RecPtr = &g_MPU6050_AppData.Recorder;
+    uint8               fileHdr[MPU6050_REC_BLOCK_BYTES];
+    char                path[OS_MAX_PATH_LEN];
+
+    if (RecPtr->MapPtr == NULL)
+    {
+        CFE_EVS_SendEvent(MPU6050_REC_ERR_EID, CFE_EVS_EventType_ERROR, "MPU6050 - Recorder is off");
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    if (RecPtr->ucDumpMode != MPU6050_REC_DUMP_NONE)
+    {
+        CFE_EVS_SendEvent(MPU6050_REC_ERR_EID, CFE_EVS_EventType_ERROR,
+                "MPU6050 - Recorder dump already in progress");
+        return CFE_ES_RunStatus_APP_ERROR;
+    }
+
+    if (Mode == MPU6050_REC_DUMP_FILE)
+    {
+        strncpy(path, CmdPtr->dumpPath, sizeof(path) - 1);
+        path[sizeof(path) - 1] = '\0';
+
+        RecPtr->DumpFileID = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (RecPtr->DumpFileID < 0)
+        {
+            CFE_EVS_SendEvent(MPU6050_REC_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - Failed to create recorder dump file %s", path);
+            return CFE_ES_RunStatus_APP_ERROR;
+        }
+
+        /* The block count is filled in when the dump is done */
+        memset(fileHdr, 0x00, sizeof(fileHdr));
+        MPU6050_RecFillFileHdr((MPU6050_RecFileHdr_t*) fileHdr, 0);
+        if (write(RecPtr->DumpFileID, fileHdr, sizeof(fileHdr)) != sizeof(fileHdr))
+        {
+            CFE_EVS_SendEvent(MPU6050_REC_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - Failed to write recorder dump file %s", path);
+            close(RecPtr->DumpFileID);
+            RecPtr->DumpFileID = -1;
+            return CFE_ES_RunStatus_APP_ERROR;
+        }
+    }
+
+    RecPtr->ucDumpMode   = Mode;
+    RecPtr->uiDumpSeq    = (RecPtr->uiSeq > RecPtr->uiBlockCnt) ? RecPtr->uiSeq - RecPtr->uiBlockCnt + 1 : 1;
+    RecPtr->uiDumpEndSeq = RecPtr->uiSeq;
+    RecPtr->uiDumpCnt    = 0;
+    RecPtr->dumpStart    = CmdPtr->startTime;
+    RecPtr->dumpEnd      = CmdPtr->endTime;
+
+    CFE_EVS_SendEvent(MPU6050_REC_INF_EID, CFE_EVS_EventType_INFORMATION,
+            "MPU6050 - Recorder dump of blocks %u to %u started",
+            (unsigned int) RecPtr->uiDumpSeq, (unsigned int) RecPtr->uiDumpEndSeq);
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_RecorderStopDump
+**
+** Purpose: To finish (or abort) the dump in progress
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    pwrite, close
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_RecorderService
+**    MPU6050_ProcessNewAppCmds
+**    MPU6050_RecorderClose
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Recorder
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: A dump file stopped early is still well formed; it holds the blocks written.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_RecorderStopDump(void)
+{
+    MPU6050_Recorder_t  *RecPtr = &g_MPU6050_AppData.Recorder;
+    MPU6050_RecFileHdr_t fileHdr;
+
+    if (RecPtr->ucDumpMode == MPU6050_REC_DUMP_NONE)
+    {
+        return;
+    }
+
+    if (RecPtr->DumpFileID >= 0)
+    {
+        MPU6050_RecFillFileHdr(&fileHdr, RecPtr->uiDumpCnt);
+        if (pwrite(RecPtr->DumpFileID, &fileHdr, sizeof(fileHdr), 0) != sizeof(fileHdr))
+        {
+            CFE_EVS_SendEvent(MPU6050_REC_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - Failed to complete recorder dump file header");
+        }
+        close(RecPtr->DumpFileID);
+        RecPtr->DumpFileID = -1;
+    }
+
+    CFE_EVS_SendEvent(MPU6050_REC_INF_EID, CFE_EVS_EventType_INFORMATION,
+            "MPU6050 - Recorder dump stopped after %u blocks", (unsigned int) RecPtr->uiDumpCnt);
+
+    RecPtr->ucDumpMode = MPU6050_REC_DUMP_NONE;
+    g_MPU6050_AppData.HkTlm.uiRecDumpCnt = RecPtr->uiDumpCnt;
+}
+
+/*=====================================================================================
+** Name: MPU6050_RecorderClose
+**
+** Purpose: To write the recorder file back to storage and release it
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    msync, munmap, close
+**    MPU6050_RecorderStopDump
+**
+** Called By:
+**    MPU6050_RecorderOpen
+**    MPU6050_CleanupCallback
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Recorder
+**
+** Limitations, Assumptions, External Events, and Notes:
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_RecorderClose(void)
+{
+    MPU6050_Recorder_t *RecPtr = &g_MPU6050_AppData.Recorder;
+
+    MPU6050_RecorderStopDump();
+
+    if (RecPtr->MapPtr != NULL)
+    {
+        msync(RecPtr->MapPtr, RecPtr->MapSize, MS_SYNC);
+        munmap(RecPtr->MapPtr, RecPtr->MapSize);
+        RecPtr->MapPtr = NULL;
+    }
+
+    if (RecPtr->FileID >= 0)
+    {
+        close(RecPtr->FileID);
+        RecPtr->FileID = -1;
+    }
+
+    RecPtr->CurPtr = NULL;
+}
+
+/*=======================================================================================
+** End of file mpu6050_recorder.c
+**=====================================================================================*/
@@ -0,0 +1,143 @@
+/*=======================================================================================
+** File Name:  mpu6050_recorder.h
+**
+** Title:  Onboard Recorder Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the circular onboard recorder for the raw sample stream, its file
+**           layout, and the commands and telemetry used to dump it.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_RECORDER_H_
+#define _MPU6050_RECORDER_H_
+
+/*
+** Include Files
+*/
+#include <stddef.h>
+
+#include "cfe.h"
+#include "cfe_msg.h"
+#include "common_types.h"
+#include "mpu6050_platform_cfg.h"
+#include "mpu6050_private_types.h"
+
+/*
+** Local Defines
+*/
+#define MPU6050_REC_FILE_MAGIC   0x4D505246  /* "MPRF" */
+#define MPU6050_REC_BLOCK_MAGIC  0x4D505242  /* "MPRB" */
+#define MPU6050_REC_VERSION      2
+#define MPU6050_REC_BYTE_ORDER   0x0102      /* Reads 0x0201 on a host of the other byte order */
+
+/* Dump destinations */
+#define MPU6050_REC_DUMP_NONE    0
+#define MPU6050_REC_DUMP_FILE    1
+#define MPU6050_REC_DUMP_TLM     2
+
+/*
+** Local Structure Declarations
+*/
+
+/*
+** File layout: one MPU6050_REC_BLOCK_BYTES region holding MPU6050_RecFileHdr_t, then
+** uiBlockCnt blocks of MPU6050_REC_BLOCK_BYTES.  Block sequence number s lives in block
+** (s - 1) % uiBlockCnt, so the newest valid sequence number gives the write cursor.
+** Dump files use the same layout, holding only the dumped blocks in sequence order.
+*/
+typedef struct
+{
+    uint32  uiMagic;           /* MPU6050_REC_FILE_MAGIC */
+    uint16  usVersion;         /* MPU6050_REC_VERSION */
+    uint16  usByteOrder;       /* MPU6050_REC_BYTE_ORDER, as written by the host */
+    uint32  uiBlockBytes;      /* MPU6050_REC_BLOCK_BYTES */
+    uint32  uiBlockCnt;        /* Blocks following the file header */
+    uint32  uiSampleBytes;     /* sizeof(MPU6050_RawSample_t), a sample of every channel */
+    uint32  uiSpare;
+} MPU6050_RecFileHdr_t;
+
+/* Every block holds consecutive samples; sample n was latched at
+** firstTime + n * (lastTime - firstTime) / (usSampleCnt - 1).  Each sample is the
+** channels in ucChannelMask as int16's, packed as by MPU6050_PackRaw. */
+typedef struct
+{
+    uint32  uiMagic;           /* MPU6050_REC_BLOCK_MAGIC once the block is in use */
+    uint32  uiSeq;             /* Block sequence number, from 1 */
+    CFE_TIME_SysTime_t firstTime;
+    CFE_TIME_SysTime_t lastTime;
+    uint16  usSampleCnt;       /* Samples following the header */
+    uint8   ucAccelScale;      /* ACCEL_CONFIG scale code (MPU6050_AcceleormeterScale_t) */
+    uint8   ucGyroScale;       /* GYRO_CONFIG scale code (MPU6050_GyroScale_t) */
+    uint16  usTableVersion;    /* Config table (calibration) version */
+    uint8   ucRateProfile;     /* Rate profile of every sample, or MPU6050_RATE_PROFILE_FIXED */
+    uint8   ucChannelMask;     /* MPU6050_CHAN_* of every sample */
+} MPU6050_RecBlockHdr_t;
+
+/* Samples of ChanCnt channels a block holds */
+#define MPU6050_REC_BLOCK_SAMPLES(ChanCnt) \
+    ((MPU6050_REC_BLOCK_BYTES - sizeof(MPU6050_RecBlockHdr_t)) / ((ChanCnt) * sizeof(int16)))
+
+/* MPU6050_REC_DUMP_FILE_CC and MPU6050_REC_DUMP_TLM_CC: dump every recorded block whose
+** time range overlaps [startTime, endTime] */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t ucCmdHeader;
+    CFE_TIME_SysTime_t startTime;
+    CFE_TIME_SysTime_t endTime;
+    char    dumpPath[OS_MAX_PATH_LEN];  /* Ignored by MPU6050_REC_DUMP_TLM_CC */
+} MPU6050_RecDumpCmd_t;
+
+/* One dumped block; only the header and usSampleCnt samples of aucBlock are sent */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t ucTlmHeader;
+    uint32  uiDumpCnt;         /* Blocks sent by this dump, this one included */
+    uint32  uiSpare;
+    uint8   aucBlock[MPU6050_REC_BLOCK_BYTES];
+} MPU6050_RecBlockTlm_t;
+
+typedef struct
+{
+    int     FileID;            /* Recorder file, or -1 while recording is off */
+    uint8  *MapPtr;            /* Mapping of the whole file */
+    size_t  MapSize;
+    uint32  uiBlockCnt;
+    uint32  uiSeq;             /* Sequence number of the newest block */
+    MPU6050_RecBlockHdr_t *CurPtr; /* Block being filled, or NULL to start a new one */
+    uint64  uiNextIdx;         /* Sample index that continues the current block */
+    double  dLastSyncTime;     /* Monotonic time of the last msync */
+
+    /* Dump in progress */
+    uint8   ucDumpMode;        /* MPU6050_REC_DUMP_* */
+    int     DumpFileID;
+    uint32  uiDumpSeq;         /* Next block to look at */
+    uint32  uiDumpEndSeq;      /* Last block to look at */
+    uint32  uiDumpCnt;         /* Blocks dumped so far */
+    CFE_TIME_SysTime_t dumpStart;
+    CFE_TIME_SysTime_t dumpEnd;
+} MPU6050_Recorder_t;
+
+/*
+** Local Function Prototypes
+*/
+int32 MPU6050_RecorderOpen(void);
+void  MPU6050_RecordNewData(void);
+void  MPU6050_RecorderService(void);
+int32 MPU6050_RecorderStartDump(const MPU6050_RecDumpCmd_t*, uint8);
+void  MPU6050_RecorderStopDump(void);
+void  MPU6050_RecorderClose(void);
+
+#endif /* _MPU6050_RECORDER_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_recorder.h
+**=====================================================================================*/
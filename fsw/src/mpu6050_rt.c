@@ -0,0 +1,225 @@
+/*=======================================================================================
+** File Name:  mpu6050_rt.c
+**
+** Title:  Real-Time Configuration for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To put the calling task under a real-time scheduling policy, pin it to a
+**           set of CPUs and lock its memory, then read back what took effect.
+**
+** Functions Defined:
+**    MPU6050_Rt_Apply - Apply the settings to the calling thread
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Linux only.  The settings apply to the calling thread, which is the task that
+**    reads the device; OSAL's own task priority is overridden.
+** 2: SCHED_FIFO, SCHED_RR and mlockall need CAP_SYS_NICE and CAP_IPC_LOCK (or a
+**    large enough RLIMIT_MEMLOCK).  Settings that fail are flagged and the rest are
+**    still applied.
+** 3: A setting left at its default is not touched at startup, so the task keeps what
+**    OSAL gave it.  Once applied, clearing it in a later table undoes it: the task
+**    goes back to SCHED_OTHER, to every CPU, and its memory is unlocked.  Memory is
+**    locked per process, so munlockall also unlocks it for the other apps.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Pragmas
+*/
+#define _GNU_SOURCE  /* pthread_setaffinity_np */
+
+/*
+** Include Files
+*/
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "mpu6050_platform_cfg.h"
+#include "mpu6050_rt.h"
+
+/*
+** Local Variables
+*/
+
+/* Settings this module has changed, so clearing them later has something to undo */
+static bool MPU6050_Rt_SchedSet  = false;
+static bool MPU6050_Rt_CpusSet   = false;
+static bool MPU6050_Rt_MemLocked = false;
+
+/*
+** Local Function Definitions
+*/
+
+/* Touch the stack the task will use, so no page fault lands in a cycle later on.
+ * Each store goes through the volatile array, one per page, so none can be elided,
+ * and the function is kept out of line so the frame really is this deep. */
+static __attribute__((noinline)) void MPU6050_Rt_PrefaultStack(void)
+{
+    volatile uint8 stack[MPU6050_RT_STACK_PREFAULT_BYTES];
+    long           pageBytes = sysconf(_SC_PAGESIZE);
+    uint32         i;
+
+    if (pageBytes <= 0)
+    {
+        pageBytes = 4096;
+    }
+
+    for (i = 0; i < sizeof(stack); i += (uint32) pageBytes)
+    {
+        stack[i] = 0;
+    }
+    stack[sizeof(stack) - 1] = 0;
+}
+
+/* Whether any of the process's memory is locked, from VmLck in /proc/self/status */
+static bool MPU6050_Rt_MemoryLocked(void)
+{
+    FILE          *fp;
+    char           line[64];
+    unsigned long  lockedKb = 0;
+
+    fp = fopen("/proc/self/status", "r");
+    if (fp == NULL)
+    {
+        return MPU6050_Rt_MemLocked;
+    }
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        if (sscanf(line, "VmLck: %lu", &lockedKb) == 1)
+        {
+            break;
+        }
+    }
+
+    fclose(fp);
+    return lockedKb > 0;
+}
+
+int32 MPU6050_Rt_Apply(const MPU6050_RtCfg_t *CfgPtr, MPU6050_RtStatus_t *StatusPtr)
+{
+    struct sched_param param;
+    cpu_set_t          cpus;
+    int                policy;
+    uint32             cpu;
+
+    memset(StatusPtr, 0x00, sizeof(*StatusPtr));
+
+    memset(&param, 0x00, sizeof(param));
+    if (CfgPtr->policy == MPU6050_RT_POLICY_FIFO || CfgPtr->policy == MPU6050_RT_POLICY_RR)
+    {
+        param.sched_priority = CfgPtr->priority;
+        policy = (CfgPtr->policy == MPU6050_RT_POLICY_FIFO) ? SCHED_FIFO : SCHED_RR;
+    }
+    else
+    {
+        policy = SCHED_OTHER;
+    }
+
+    if (CfgPtr->policy != MPU6050_RT_POLICY_DEFAULT || MPU6050_Rt_SchedSet)
+    {
+        if (pthread_setschedparam(pthread_self(), policy, &param) == 0)
+        {
+            MPU6050_Rt_SchedSet = (CfgPtr->policy != MPU6050_RT_POLICY_DEFAULT);
+        }
+        else
+        {
+            StatusPtr->ucErrMask |= MPU6050_RT_ERR_SCHED;
+        }
+    }
+
+    if (CfgPtr->cpuMask != 0 || MPU6050_Rt_CpusSet)
+    {
+        CPU_ZERO(&cpus);
+        if (CfgPtr->cpuMask != 0)
+        {
+            for (cpu = 0; cpu < 32; cpu++)
+            {
+                if (CfgPtr->cpuMask & (1u << cpu))
+                {
+                    CPU_SET(cpu, &cpus);
+                }
+            }
+        }
+        else
+        {
+            /* The kernel keeps just the CPUs that are online */
+            for (cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            {
+                CPU_SET(cpu, &cpus);
+            }
+        }
+
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0)
+        {
+            MPU6050_Rt_CpusSet = (CfgPtr->cpuMask != 0);
+        }
+        else
+        {
+            StatusPtr->ucErrMask |= MPU6050_RT_ERR_AFFINITY;
+        }
+    }
+
+    if (CfgPtr->lockMemory)
+    {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) == 0)
+        {
+            MPU6050_Rt_PrefaultStack();
+            MPU6050_Rt_MemLocked = true;
+        }
+        else
+        {
+            StatusPtr->ucErrMask |= MPU6050_RT_ERR_MLOCK;
+        }
+    }
+    else if (MPU6050_Rt_MemLocked)
+    {
+        if (munlockall() == 0)
+        {
+            MPU6050_Rt_MemLocked = false;
+        }
+        else
+        {
+            StatusPtr->ucErrMask |= MPU6050_RT_ERR_MLOCK;
+        }
+    }
+
+    /* Report what the kernel says, not what was asked for */
+    if (pthread_getschedparam(pthread_self(), &policy, &param) == 0)
+    {
+        StatusPtr->ucPriority = (uint8) param.sched_priority;
+        StatusPtr->ucPolicy   = (policy == SCHED_FIFO) ? MPU6050_RT_POLICY_FIFO :
+                                (policy == SCHED_RR)   ? MPU6050_RT_POLICY_RR   : MPU6050_RT_POLICY_OTHER;
+    }
+
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0)
+    {
+        for (cpu = 0; cpu < 32; cpu++)
+        {
+            if (CPU_ISSET(cpu, &cpus))
+            {
+                StatusPtr->uiCpuMask |= 1u << cpu;
+            }
+        }
+    }
+
+    StatusPtr->ucMemLocked = MPU6050_Rt_MemoryLocked() ? 1 : 0;
+
+    return (StatusPtr->ucErrMask == 0) ? 0 : -1;
+}
+
+/*=======================================================================================
+** End of file mpu6050_rt.c
+**=====================================================================================*/
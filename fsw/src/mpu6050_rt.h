@@ -0,0 +1,78 @@
+/*=======================================================================================
+** File Name:  mpu6050_rt.h
+**
+** Title:  Real-Time Configuration Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the scheduling policy, CPU affinity and memory locking settings
+**           of the acquisition task, and the settings it actually got.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_RT_H_
+#define _MPU6050_RT_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*
+** Local Defines
+*/
+
+/* Scheduling policies */
+#define MPU6050_RT_POLICY_DEFAULT  0  /* Leave the task as OSAL created it; SCHED_OTHER
+                                      * if an earlier table changed it */
+#define MPU6050_RT_POLICY_FIFO     1  /* SCHED_FIFO at the configured priority */
+#define MPU6050_RT_POLICY_RR       2  /* SCHED_RR at the configured priority */
+#define MPU6050_RT_POLICY_OTHER    3  /* SCHED_OTHER; also reported for any other policy */
+
+/* Settings that could not be applied */
+#define MPU6050_RT_ERR_SCHED     0x01
+#define MPU6050_RT_ERR_AFFINITY  0x02
+#define MPU6050_RT_ERR_MLOCK     0x04
+
+/*
+** Local Structure Declarations
+*/
+
+/* Requested settings, from the configuration table */
+typedef struct
+{
+    uint8  policy;      /* MPU6050_RT_POLICY_* */
+    uint8  priority;    /* 1 (lowest) to 99 for SCHED_FIFO and SCHED_RR */
+    uint8  lockMemory;  /* mlockall and prefault the stack; 0 unlocks it if locked */
+    uint8  spare;
+    uint32 cpuMask;     /* Bit n allows CPU n; 0 leaves the affinity alone, or
+                         * restores every CPU if an earlier table set one */
+} MPU6050_RtCfg_t;
+
+/* Settings in effect, read back after applying them */
+typedef struct
+{
+    uint8  ucPolicy;    /* MPU6050_RT_POLICY_* */
+    uint8  ucPriority;
+    uint8  ucMemLocked; /* Process has locked memory, from /proc/self/status */
+    uint8  ucErrMask;   /* MPU6050_RT_ERR_* */
+    uint32 uiCpuMask;   /* First 32 CPUs the task may run on */
+} MPU6050_RtStatus_t;
+
+/*
+** Local Function Prototypes
+*/
+int32 MPU6050_Rt_Apply(const MPU6050_RtCfg_t *CfgPtr, MPU6050_RtStatus_t *StatusPtr);
+
+#endif /* _MPU6050_RT_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_rt.h
+**=====================================================================================*/
@@ -0,0 +1,146 @@
+/*=======================================================================================
+** File Name:  mpu6050_sched.c
+**
+** Title:  Acquisition Scheduler for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To pace device reads with a periodic timerfd armed on absolute
+**           CLOCK_MONOTONIC deadlines.
+**
+** Functions Defined:
+**    MPU6050_Sched_Init      - Mark a scheduler stopped
+**    MPU6050_Sched_Start     - Arm the tick, restarting it if it runs
+**    MPU6050_Sched_Wait      - Block until the next tick
+**    MPU6050_Sched_Remaining - Time left until the tick after the current one
+**    MPU6050_Sched_Stop      - Disarm the tick
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The kernel keeps the ticks on a fixed grid from the first deadline, so the rate
+**    does not drift with the time spent processing each tick.
+** 2: When a cycle overruns, the ticks it missed are counted and dropped; the next
+**    wait returns at the next tick on the grid instead of once per missed tick.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+#include "mpu6050_sched.h"
+
+/*
+** Local Function Definitions
+*/
+
+static uint64 MPU6050_Sched_Now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64) now.tv_sec * 1000000000ull + (uint64) now.tv_nsec;
+}
+
+void MPU6050_Sched_Init(MPU6050_Sched_t *SchedPtr)
+{
+    SchedPtr->iTimerFd       = -1;
+    SchedPtr->uiPeriodNsec   = 0;
+    SchedPtr->uiDeadlineNsec = 0;
+    SchedPtr->uiTickCnt      = 0;
+    SchedPtr->uiSkipCnt      = 0;
+}
+
+int32 MPU6050_Sched_Start(MPU6050_Sched_t *SchedPtr, uint32 PeriodNsec)
+{
+    struct itimerspec spec;
+    uint64            firstNsec;
+
+    if (PeriodNsec == 0)
+    {
+        return -1;
+    }
+
+    if (SchedPtr->iTimerFd < 0)
+    {
+        SchedPtr->iTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+        if (SchedPtr->iTimerFd < 0)
+        {
+            return -1;
+        }
+    }
+
+    /* The first tick is one period out, so the cycle in progress is not cut short */
+    firstNsec = MPU6050_Sched_Now() + PeriodNsec;
+
+    spec.it_value.tv_sec     = (time_t) (firstNsec / 1000000000ull);
+    spec.it_value.tv_nsec    = (long) (firstNsec % 1000000000ull);
+    spec.it_interval.tv_sec  = (time_t) (PeriodNsec / 1000000000u);
+    spec.it_interval.tv_nsec = (long) (PeriodNsec % 1000000000u);
+
+    if (timerfd_settime(SchedPtr->iTimerFd, TFD_TIMER_ABSTIME, &spec, NULL) != 0)
+    {
+        MPU6050_Sched_Stop(SchedPtr);
+        return -1;
+    }
+
+    SchedPtr->uiPeriodNsec   = PeriodNsec;
+    SchedPtr->uiDeadlineNsec = firstNsec - PeriodNsec;
+
+    return 0;
+}
+
+int32 MPU6050_Sched_Wait(MPU6050_Sched_t *SchedPtr)
+{
+    uint64  expirations = 0;
+    ssize_t bytes;
+
+    do
+    {
+        bytes = read(SchedPtr->iTimerFd, &expirations, sizeof(expirations));
+    } while (bytes < 0 && errno == EINTR);
+
+    if (bytes != sizeof(expirations) || expirations == 0)
+    {
+        return -1;
+    }
+
+    /* Act on the newest tick only; the ones before it are already late */
+    SchedPtr->uiDeadlineNsec += expirations * SchedPtr->uiPeriodNsec;
+    SchedPtr->uiSkipCnt      += (uint32) (expirations - 1);
+    SchedPtr->uiTickCnt++;
+
+    return (int32) (expirations - 1);
+}
+
+uint64 MPU6050_Sched_Remaining(const MPU6050_Sched_t *SchedPtr)
+{
+    uint64 nextNsec = SchedPtr->uiDeadlineNsec + SchedPtr->uiPeriodNsec;
+    uint64 nowNsec  = MPU6050_Sched_Now();
+
+    return (nextNsec > nowNsec) ? nextNsec - nowNsec : 0;
+}
+
+void MPU6050_Sched_Stop(MPU6050_Sched_t *SchedPtr)
+{
+    if (SchedPtr->iTimerFd >= 0)
+    {
+        close(SchedPtr->iTimerFd);
+        SchedPtr->iTimerFd = -1;
+    }
+}
+
+/*=======================================================================================
+** End of file mpu6050_sched.c
+**=====================================================================================*/
@@ -0,0 +1,53 @@
+/*=======================================================================================
+** File Name:  mpu6050_sched.h
+**
+** Title:  Acquisition Scheduler Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the fixed rate tick that paces device reads on absolute
+**           CLOCK_MONOTONIC deadlines.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_SCHED_H_
+#define _MPU6050_SCHED_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+
+/*
+** Local Structure Declarations
+*/
+typedef struct
+{
+    int     iTimerFd;        /* timerfd, -1 while stopped */
+    uint32  uiPeriodNsec;
+    uint64  uiDeadlineNsec;  /* CLOCK_MONOTONIC of the tick most recently waited for */
+    uint32  uiTickCnt;       /* Ticks acted on */
+    uint32  uiSkipCnt;       /* Ticks dropped because the previous cycle overran */
+} MPU6050_Sched_t;
+
+/*
+** Local Function Prototypes
+*/
+void   MPU6050_Sched_Init(MPU6050_Sched_t *SchedPtr);
+int32  MPU6050_Sched_Start(MPU6050_Sched_t *SchedPtr, uint32 PeriodNsec);
+int32  MPU6050_Sched_Wait(MPU6050_Sched_t *SchedPtr);
+uint64 MPU6050_Sched_Remaining(const MPU6050_Sched_t *SchedPtr);
+void   MPU6050_Sched_Stop(MPU6050_Sched_t *SchedPtr);
+
+#endif /* _MPU6050_SCHED_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_sched.h
+**=====================================================================================*/
@@ -0,0 +1,625 @@
+/*=======================================================================================
+** File Name:  mpu6050_sim.c
+**
+** Title:  Register-Map Simulator for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To stand in for an MPU6050 on the I2C bus: the registers the driver uses,
+**           the sample clock, the FIFO and a synthetic motion profile with bias and
+**           noise, all in process.
+**
+** Functions Defined:
+**    MPU6050_Sim_Open    - Power up a simulated device running a named profile
+**    MPU6050_Sim_Close   - Release a simulated device
+**    MPU6050_Sim_IsSim   - Whether a handle is a simulated device
+**    MPU6050_Sim_Get     - A simulated device's state and configuration
+**    MPU6050_Sim_Write   - An I2C write: register address, then data
+**    MPU6050_Sim_Read    - An I2C read from the current register address
+**    MPU6050_Sim_Advance - Run the device clock forward
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Transfers follow i2c-dev: a write's first byte selects the register, later bytes
+**    and reads auto-increment, except at FIFO_R_W which pops the FIFO and MEM_R_W
+**    which steps through a bank of DMP memory.
+** 2: The device only runs when it is accessed.  It catches up with the time elapsed
+**    since, but keeps no more than a full FIFO's worth of samples; any older are
+**    counted as FIFO overflow.
+** 3: With a time scale of 0 the clock only moves on MPU6050_Sim_Advance, so a harness
+**    can push samples through the pipeline as fast as it can take them.
+** 4: INT_STATUS bits are set whether or not INT_ENABLE enables them, and there is no
+**    interrupt pin.  Self test, the auxiliary bus and motion detection are not
+**    modelled; their registers read back what was written.  DMP memory is, so an
+**    image can be loaded and verified, but the DMP never runs or queues a packet.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+#include "mpu6050_diag.h"
+#include "mpu6050_sim.h"
+
+/*
+** Local Defines
+*/
+#define MPU6050_SIM_REG_PTR_MASK  (MPU6050_SIM_REG_CNT - 1)
+#define MPU6050_SIM_TEMP_OFFSET_C 36.53
+#define MPU6050_SIM_TEMP_LSB_C    340.0
+#define MPU6050_SIM_ACCEL_LSB_G   16384.0  /* At +-2 g, halving per scale step    */
+#define MPU6050_SIM_GYRO_LSB_DPS  131.0    /* At +-250 dps, halving per scale step */
+
+/*
+** Local Variables
+*/
+static MPU6050_Sim_t MPU6050_SimDev[MPU6050_SIM_MAX_DEVICES];
+
+static const char *const MPU6050_SimProfileName[MPU6050_SIM_PROFILE_CNT] =
+{
+    "static", "sine", "spin", "maneuver",
+};
+
+/* A bench unit at room temperature: small biases, datasheet noise at 1 kHz */
+static const MPU6050_SimCfg_t MPU6050_SimDefaultCfg =
+{
+    .ucProfile   = MPU6050_SIM_PROFILE_STATIC,
+    .uiSeed      = 0x2545F491,
+    .dTimeScale  = MPU6050_SIM_TIME_SCALE,
+    .dClockPpm   = 120.0,
+    .dGyroAmpDps = 90.0,
+    .dAccelAmpG  = 0.5,
+    .dFreqHz     = 2.0,
+    .adGyroBias  = {0.8, -1.2, 0.4},
+    .adAccelBias = {0.02, -0.01, 0.03},
+    .dGyroNoise  = 0.05,
+    .dAccelNoise = 0.004,
+    .dTempC      = 25.0,
+};
+
+/* Accel wake-ups per second in cycle mode, by LP_WAKE_CTRL */
+static const double MPU6050_SimWakeHz[4] = {1.25, 5.0, 20.0, 40.0};
+
+/*
+** Local Function Definitions
+*/
+
+static MPU6050_Sim_t *MPU6050_Sim_Lookup(int Fd)
+{
+    uint32 index = (uint32) Fd - MPU6050_SIM_FD_BASE;
+
+    if (Fd < MPU6050_SIM_FD_BASE || index >= MPU6050_SIM_MAX_DEVICES ||
+        !MPU6050_SimDev[index].bInUse)
+    {
+        errno = EBADF;
+        return NULL;
+    }
+
+    return &MPU6050_SimDev[index];
+}
+
+/* xorshift32, never 0 */
+static uint32 MPU6050_Sim_Rand(MPU6050_Sim_t *SimPtr)
+{
+    uint32 x = SimPtr->uiRng;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    SimPtr->uiRng = x;
+
+    return x;
+}
+
+/* Zero mean, unit variance (Box-Muller) */
+static double MPU6050_Sim_Gauss(MPU6050_Sim_t *SimPtr)
+{
+    double u1 = (MPU6050_Sim_Rand(SimPtr) + 1.0) / 4294967297.0;
+    double u2 = MPU6050_Sim_Rand(SimPtr) / 4294967296.0;
+
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+/* Power-on register values, as after DEVICE_RESET */
+static void MPU6050_Sim_ResetRegs(MPU6050_Sim_t *SimPtr)
+{
+    memset(SimPtr->aucReg, 0x00, sizeof(SimPtr->aucReg));
+    memset(SimPtr->aucDmpMem, 0x00, sizeof(SimPtr->aucDmpMem));
+    SimPtr->aucReg[RegPowerManagment1] = 1 << PwrMgmt1Sleep;
+    SimPtr->aucReg[RegWhoAmI]          = MPU6050_WHO_AM_I;
+    SimPtr->uiFifoHead = 0;
+    SimPtr->uiFifoCnt  = 0;
+}
+
+/* Device time between samples, 0 while nothing is sampled */
+static uint64 MPU6050_Sim_PeriodNsec(const MPU6050_Sim_t *SimPtr)
+{
+    uint8  pwr1 = SimPtr->aucReg[RegPowerManagment1];
+    uint8  dlpf = (SimPtr->aucReg[RegConfig] >> ConfigDlpf) & 0x07;
+    double rateHz;
+
+    if (pwr1 & (1 << PwrMgmt1Sleep))
+    {
+        return 0;
+    }
+
+    if (pwr1 & (1 << PwrMgmt1Cycle))
+    {
+        rateHz = MPU6050_SimWakeHz[SimPtr->aucReg[RegPowerManagment2] >> PwrMgmt2LPWakeCtrl];
+    }
+    else
+    {
+        rateHz = ((dlpf == 0 || dlpf == 7) ? 8000.0 : 1000.0) /
+                 (1.0 + SimPtr->aucReg[RegSampleRateDiv]);
+    }
+
+    /* A fast clock makes short periods */
+    return (uint64) (1e9 / (rateHz * (1.0 + SimPtr->Cfg.dClockPpm * 1e-6)));
+}
+
+/* Body rates (degs/sec) and specific force (g's) at device time Sec, without errors */
+static void MPU6050_Sim_Motion(const MPU6050_SimCfg_t *CfgPtr, double Sec,
+                               double *AccelPtr, double *GyroPtr)
+{
+    double w     = 2.0 * M_PI * CfgPtr->dFreqHz * Sec;
+    uint8  shape = CfgPtr->ucProfile;
+
+    if (shape == MPU6050_SIM_PROFILE_MANEUVER)
+    {
+        shape = (fmod(Sec, MPU6050_SIM_QUIET_SEC + MPU6050_SIM_BURST_SEC) < MPU6050_SIM_QUIET_SEC) ?
+                MPU6050_SIM_PROFILE_STATIC : MPU6050_SIM_PROFILE_SINE;
+    }
+
+    AccelPtr[0] = 0.0;
+    AccelPtr[1] = 0.0;
+    AccelPtr[2] = 1.0;
+    GyroPtr[0]  = 0.0;
+    GyroPtr[1]  = 0.0;
+    GyroPtr[2]  = 0.0;
+
+    if (shape == MPU6050_SIM_PROFILE_SINE)
+    {
+        AccelPtr[0] += CfgPtr->dAccelAmpG * sin(w);
+        AccelPtr[1] += CfgPtr->dAccelAmpG * cos(w);
+        AccelPtr[2] += CfgPtr->dAccelAmpG * sin(2.0 * w);
+        GyroPtr[0]   = CfgPtr->dGyroAmpDps * sin(w);
+        GyroPtr[1]   = CfgPtr->dGyroAmpDps * sin(w + 2.0 * M_PI / 3.0);
+        GyroPtr[2]   = CfgPtr->dGyroAmpDps * sin(w + 4.0 * M_PI / 3.0);
+    }
+    else if (shape == MPU6050_SIM_PROFILE_SPIN)
+    {
+        GyroPtr[2] = CfgPtr->dGyroAmpDps;
+    }
+}
+
+static void MPU6050_Sim_Put16(uint8 *RegPtr, double Counts)
+{
+    int32 value;
+
+    /* Saturate like the ADC */
+    if (Counts > 32767.0)
+    {
+        Counts = 32767.0;
+    }
+    else if (Counts < -32768.0)
+    {
+        Counts = -32768.0;
+    }
+
+    value = (int32) lround(Counts);
+
+    RegPtr[0] = (uint8) ((uint16) value >> 8);
+    RegPtr[1] = (uint8) value;
+}
+
+static void MPU6050_Sim_FifoPush(MPU6050_Sim_t *SimPtr, const uint8 *Bytes, uint32 Len)
+{
+    uint32 i;
+
+    for (i = 0; i < Len; i++)
+    {
+        /* A full FIFO drops its oldest byte */
+        if (SimPtr->uiFifoCnt == MPU6050_FIFO_SIZE)
+        {
+            SimPtr->uiFifoHead = (SimPtr->uiFifoHead + 1) % MPU6050_FIFO_SIZE;
+            SimPtr->uiFifoCnt--;
+            SimPtr->uiDropCnt++;
+            SimPtr->aucReg[RegIntStatus] |= 1 << IntStatusFifoOflow;
+        }
+
+        SimPtr->aucFifo[(SimPtr->uiFifoHead + SimPtr->uiFifoCnt) % MPU6050_FIFO_SIZE] = Bytes[i];
+        SimPtr->uiFifoCnt++;
+    }
+}
+
+/* Bytes FIFO_EN queues per sample */
+static uint32 MPU6050_Sim_FifoSampleBytes(const MPU6050_Sim_t *SimPtr)
+{
+    uint8 fifoEn = SimPtr->aucReg[RegFifoEnable];
+
+    return ((fifoEn & (1 << FifoEnAccel)) ? 6 : 0) +
+           ((fifoEn & (1 << FifoEnTemp))  ? 2 : 0) +
+           ((fifoEn & (1 << FifoEnXG))    ? 2 : 0) +
+           ((fifoEn & (1 << FifoEnYG))    ? 2 : 0) +
+           ((fifoEn & (1 << FifoEnZG))    ? 2 : 0);
+}
+
+/* Take a sample at device time Nsec into the data registers and the FIFO */
+static void MPU6050_Sim_Latch(MPU6050_Sim_t *SimPtr, uint64 Nsec)
+{
+    const MPU6050_SimCfg_t *cfgPtr = &SimPtr->Cfg;
+    uint8  *reg    = SimPtr->aucReg;
+    uint8   stby   = reg[RegPowerManagment2];
+    uint8   fifoEn = reg[RegFifoEnable];
+    double  accelLsb = MPU6050_SIM_ACCEL_LSB_G  / (1 << ((reg[RegAccelConfig] >> RegAccelConfigScale) & 0x03));
+    double  gyroLsb  = MPU6050_SIM_GYRO_LSB_DPS / (1 << ((reg[RegGyroConfig]  >> RegGyroConfigScale)  & 0x03));
+    double  accel[3];
+    double  gyro[3];
+    uint32  i;
+
+    MPU6050_Sim_Motion(cfgPtr, Nsec * 1e-9, accel, gyro);
+
+    /* Axes in standby read 0; the cycle wake-ups only sample the accelerometer */
+    for (i = 0; i < 3; i++)
+    {
+        accel[i] = (stby & (1 << (PwrMgmt2StbyXA - i))) ? 0.0 :
+                   (accel[i] + cfgPtr->adAccelBias[i] + cfgPtr->dAccelNoise * MPU6050_Sim_Gauss(SimPtr)) * accelLsb;
+        gyro[i]  = ((stby & (1 << (PwrMgmt2StbyXG - i))) || (reg[RegPowerManagment1] & (1 << PwrMgmt1Cycle))) ? 0.0 :
+                   (gyro[i] + cfgPtr->adGyroBias[i] + cfgPtr->dGyroNoise * MPU6050_Sim_Gauss(SimPtr)) * gyroLsb;
+    }
+
+    MPU6050_Sim_Put16(&reg[RegAccelX], accel[0]);
+    MPU6050_Sim_Put16(&reg[RegAccelY], accel[1]);
+    MPU6050_Sim_Put16(&reg[RegAccelZ], accel[2]);
+    MPU6050_Sim_Put16(&reg[RegTemp], (reg[RegPowerManagment1] & (1 << PwrMgmt1Temp_dis)) ? 0.0 :
+                      (cfgPtr->dTempC - MPU6050_SIM_TEMP_OFFSET_C) * MPU6050_SIM_TEMP_LSB_C);
+    MPU6050_Sim_Put16(&reg[RegGyroX], gyro[0]);
+    MPU6050_Sim_Put16(&reg[RegGyroY], gyro[1]);
+    MPU6050_Sim_Put16(&reg[RegGyroZ], gyro[2]);
+
+    /* The FIFO takes the enabled channels in register order */
+    if (reg[RegUserCtrl] & (1 << UserCtrlFifoEn))
+    {
+        if (fifoEn & (1 << FifoEnAccel))
+        {
+            MPU6050_Sim_FifoPush(SimPtr, &reg[RegAccelX], 6);
+        }
+        if (fifoEn & (1 << FifoEnTemp))
+        {
+            MPU6050_Sim_FifoPush(SimPtr, &reg[RegTemp], 2);
+        }
+        if (fifoEn & (1 << FifoEnXG))
+        {
+            MPU6050_Sim_FifoPush(SimPtr, &reg[RegGyroX], 2);
+        }
+        if (fifoEn & (1 << FifoEnYG))
+        {
+            MPU6050_Sim_FifoPush(SimPtr, &reg[RegGyroY], 2);
+        }
+        if (fifoEn & (1 << FifoEnZG))
+        {
+            MPU6050_Sim_FifoPush(SimPtr, &reg[RegGyroZ], 2);
+        }
+    }
+
+    reg[RegIntStatus] |= 1 << IntStatusDataRdy;
+    SimPtr->uiLatchCnt++;
+}
+
+/* Run the device up to device time TargetNsec */
+static void MPU6050_Sim_Run(MPU6050_Sim_t *SimPtr, uint64 TargetNsec)
+{
+    uint64 period = MPU6050_Sim_PeriodNsec(SimPtr);
+    uint64 due;
+    uint64 skip;
+
+    if (TargetNsec < SimPtr->uiDevNsec)
+    {
+        return;
+    }
+
+    if (period == 0)
+    {
+        /* Asleep: the first sample after waking is a period after the wake-up */
+        SimPtr->uiDevNsec       = TargetNsec;
+        SimPtr->uiNextLatchNsec = 0;
+        return;
+    }
+
+    if (SimPtr->uiNextLatchNsec <= SimPtr->uiDevNsec)
+    {
+        SimPtr->uiNextLatchNsec = SimPtr->uiDevNsec + period;
+    }
+
+    /* Only the samples a full FIFO could still hold are worth making */
+    if (SimPtr->uiNextLatchNsec <= TargetNsec)
+    {
+        due = (TargetNsec - SimPtr->uiNextLatchNsec) / period + 1;
+        if (due > MPU6050_FIFO_MAX_SAMPLES)
+        {
+            skip = due - MPU6050_FIFO_MAX_SAMPLES;
+            SimPtr->uiNextLatchNsec += skip * period;
+            SimPtr->uiLatchCnt      += skip;
+            if ((SimPtr->aucReg[RegUserCtrl] & (1 << UserCtrlFifoEn)) &&
+                MPU6050_Sim_FifoSampleBytes(SimPtr) > 0)
+            {
+                SimPtr->uiDropCnt += skip * MPU6050_Sim_FifoSampleBytes(SimPtr);
+                SimPtr->aucReg[RegIntStatus] |= 1 << IntStatusFifoOflow;
+            }
+        }
+    }
+
+    while (SimPtr->uiNextLatchNsec <= TargetNsec)
+    {
+        MPU6050_Sim_Latch(SimPtr, SimPtr->uiNextLatchNsec);
+        SimPtr->uiNextLatchNsec += period;
+    }
+
+    SimPtr->uiDevNsec = TargetNsec;
+}
+
+/* Bring a free-running device up to the present */
+static void MPU6050_Sim_Sync(MPU6050_Sim_t *SimPtr)
+{
+    if (SimPtr->Cfg.dTimeScale > 0.0)
+    {
+        MPU6050_Sim_Run(SimPtr, (uint64) ((MPU6050_DiagNow() - SimPtr->uiRealStartNsec) *
+                                          SimPtr->Cfg.dTimeScale));
+    }
+}
+
+/* DMP memory byte MEM_R_W reaches, moving on within the bank */
+static uint8 *MPU6050_Sim_DmpByte(MPU6050_Sim_t *SimPtr)
+{
+    uint32 addr = ((uint32) SimPtr->aucReg[RegBankSel] << 8 | SimPtr->aucReg[RegMemStartAddr]) %
+                  MPU6050_DMP_MEM_SIZE;
+
+    SimPtr->aucReg[RegMemStartAddr]++;
+
+    return &SimPtr->aucDmpMem[addr];
+}
+
+static void MPU6050_Sim_WriteReg(MPU6050_Sim_t *SimPtr, uint8 Reg, uint8 Val)
+{
+    switch (Reg)
+    {
+        case RegPowerManagment1:
+            if (Val & (1 << PwrMgmt1DeviceReset))
+            {
+                /* Done at once; the bit reads back clear */
+                MPU6050_Sim_ResetRegs(SimPtr);
+                return;
+            }
+            SimPtr->aucReg[Reg] = Val;
+            break;
+
+        case RegUserCtrl:
+            if (Val & (1 << UserCtrlFifoReset))
+            {
+                SimPtr->uiFifoHead = 0;
+                SimPtr->uiFifoCnt  = 0;
+            }
+            SimPtr->aucReg[Reg] = Val & ~((1 << UserCtrlFifoReset) | (1 << UserCtrlDmpReset));
+            break;
+
+        case RegFifoRW:
+            MPU6050_Sim_FifoPush(SimPtr, &Val, 1);
+            break;
+
+        case RegMemRW:
+            *MPU6050_Sim_DmpByte(SimPtr) = Val;
+            break;
+
+        /* Read only */
+        case RegIntStatus:
+        case RegAccelX:     case RegAccelX + 1:
+        case RegAccelY:     case RegAccelY + 1:
+        case RegAccelZ:     case RegAccelZ + 1:
+        case RegTemp:       case RegTemp + 1:
+        case RegGyroX:      case RegGyroX + 1:
+        case RegGyroY:      case RegGyroY + 1:
+        case RegGyroZ:      case RegGyroZ + 1:
+        case RegFifoCount:  case RegFifoCount + 1:
+        case RegWhoAmI:
+            break;
+
+        default:
+            SimPtr->aucReg[Reg] = Val;
+            break;
+    }
+}
+
+static uint8 MPU6050_Sim_ReadReg(MPU6050_Sim_t *SimPtr, uint8 Reg)
+{
+    uint8 val;
+
+    switch (Reg)
+    {
+        case RegFifoCount:
+            return (uint8) (SimPtr->uiFifoCnt >> 8);
+
+        case RegFifoCount + 1:
+            return (uint8) SimPtr->uiFifoCnt;
+
+        case RegFifoRW:
+            if (SimPtr->uiFifoCnt == 0)
+            {
+                return 0;
+            }
+            val = SimPtr->aucFifo[SimPtr->uiFifoHead];
+            SimPtr->uiFifoHead = (SimPtr->uiFifoHead + 1) % MPU6050_FIFO_SIZE;
+            SimPtr->uiFifoCnt--;
+            return val;
+
+        case RegMemRW:
+            return *MPU6050_Sim_DmpByte(SimPtr);
+
+        case RegIntStatus:
+            /* Cleared by reading */
+            val = SimPtr->aucReg[Reg];
+            SimPtr->aucReg[Reg] = 0;
+            return val;
+
+        default:
+            return SimPtr->aucReg[Reg];
+    }
+}
+
+/*
+** Function Definitions
+*/
+
+/* Power up a simulated device running the named profile; -1 if it is unknown or all
+ * devices are in use */
+int MPU6050_Sim_Open(const char *Profile)
+{
+    MPU6050_Sim_t *simPtr;
+    uint32 profile;
+    uint32 i;
+
+    for (profile = 0; profile < MPU6050_SIM_PROFILE_CNT; profile++)
+    {
+        if (strcmp(Profile, MPU6050_SimProfileName[profile]) == 0)
+        {
+            break;
+        }
+    }
+
+    if (profile == MPU6050_SIM_PROFILE_CNT)
+    {
+        errno = ENOENT;
+        return -1;
+    }
+
+    for (i = 0; i < MPU6050_SIM_MAX_DEVICES; i++)
+    {
+        if (!MPU6050_SimDev[i].bInUse)
+        {
+            break;
+        }
+    }
+
+    if (i == MPU6050_SIM_MAX_DEVICES)
+    {
+        errno = EMFILE;
+        return -1;
+    }
+
+    simPtr = &MPU6050_SimDev[i];
+    memset(simPtr, 0x00, sizeof(*simPtr));
+    simPtr->bInUse          = true;
+    simPtr->Cfg             = MPU6050_SimDefaultCfg;
+    simPtr->Cfg.ucProfile   = (uint8) profile;
+    simPtr->uiRng           = (simPtr->Cfg.uiSeed + i) | 1;
+    simPtr->uiRealStartNsec = MPU6050_DiagNow();
+    MPU6050_Sim_ResetRegs(simPtr);
+
+    return MPU6050_SIM_FD_BASE + (int) i;
+}
+
+void MPU6050_Sim_Close(int Fd)
+{
+    MPU6050_Sim_t *simPtr = MPU6050_Sim_Lookup(Fd);
+
+    if (simPtr != NULL)
+    {
+        simPtr->bInUse = false;
+    }
+}
+
+bool MPU6050_Sim_IsSim(int Fd)
+{
+    return Fd >= MPU6050_SIM_FD_BASE && Fd < MPU6050_SIM_FD_BASE + MPU6050_SIM_MAX_DEVICES;
+}
+
+/* A simulated device's state; its configuration can be changed any time after open,
+ * a new seed takes effect by setting uiRng (never 0) as well */
+MPU6050_Sim_t *MPU6050_Sim_Get(int Fd)
+{
+    return MPU6050_Sim_Lookup(Fd);
+}
+
+int32 MPU6050_Sim_Write(int Fd, const uint8 *Buf, uint32 Len)
+{
+    MPU6050_Sim_t *simPtr = MPU6050_Sim_Lookup(Fd);
+    uint32 i;
+
+    if (simPtr == NULL)
+    {
+        return -1;
+    }
+
+    if (Len == 0)
+    {
+        return 0;
+    }
+
+    /* Samples due before the write were taken with the old settings */
+    MPU6050_Sim_Sync(simPtr);
+
+    simPtr->ucRegPtr = Buf[0] & MPU6050_SIM_REG_PTR_MASK;
+    for (i = 1; i < Len; i++)
+    {
+        MPU6050_Sim_WriteReg(simPtr, simPtr->ucRegPtr, Buf[i]);
+        if (simPtr->ucRegPtr != RegFifoRW && simPtr->ucRegPtr != RegMemRW)
+        {
+            simPtr->ucRegPtr = (simPtr->ucRegPtr + 1) & MPU6050_SIM_REG_PTR_MASK;
+        }
+    }
+
+    simPtr->uiBusBytes += Len;
+
+    return (int32) Len;
+}
+
+int32 MPU6050_Sim_Read(int Fd, uint8 *Buf, uint32 Len)
+{
+    MPU6050_Sim_t *simPtr = MPU6050_Sim_Lookup(Fd);
+    uint32 i;
+
+    if (simPtr == NULL)
+    {
+        return -1;
+    }
+
+    MPU6050_Sim_Sync(simPtr);
+
+    for (i = 0; i < Len; i++)
+    {
+        Buf[i] = MPU6050_Sim_ReadReg(simPtr, simPtr->ucRegPtr);
+        if (simPtr->ucRegPtr != RegFifoRW && simPtr->ucRegPtr != RegMemRW)
+        {
+            simPtr->ucRegPtr = (simPtr->ucRegPtr + 1) & MPU6050_SIM_REG_PTR_MASK;
+        }
+    }
+
+    simPtr->uiBusBytes += Len;
+
+    return (int32) Len;
+}
+
+/* Run the device clock forward Nsec of device time, on top of any free running */
+void MPU6050_Sim_Advance(int Fd, uint64 Nsec)
+{
+    MPU6050_Sim_t *simPtr = MPU6050_Sim_Lookup(Fd);
+
+    if (simPtr != NULL)
+    {
+        MPU6050_Sim_Sync(simPtr);
+        MPU6050_Sim_Run(simPtr, simPtr->uiDevNsec + Nsec);
+    }
+}
+
+/*=======================================================================================
+** End of file mpu6050_sim.c
+**=====================================================================================*/
@@ -0,0 +1,111 @@
+/*=======================================================================================
+** File Name:  mpu6050_sim.h
+**
+** Title:  Register-Map Simulator Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the in-process MPU6050 model the bus driver can run on in place
+**           of an I2C device.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_SIM_H_
+#define _MPU6050_SIM_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "mpu6050_platform_cfg.h"
+#include "mpu6050_registers.h"
+
+/*
+** Local Defines
+*/
+
+/* Handles given out by MPU6050_Sim_Open, far above any real file descriptor */
+#define MPU6050_SIM_FD_BASE       0x53494D00
+
+#define MPU6050_SIM_REG_CNT       128
+
+/* Motion profiles, named after the prefix in a simulated device path */
+#define MPU6050_SIM_PROFILE_STATIC    0  /* "static":   at rest, Z up                      */
+#define MPU6050_SIM_PROFILE_SINE      1  /* "sine":     rates and accel swinging at FreqHz  */
+#define MPU6050_SIM_PROFILE_SPIN      2  /* "spin":     constant rate about Z               */
+#define MPU6050_SIM_PROFILE_MANEUVER  3  /* "maneuver": at rest, then a burst of "sine"     */
+#define MPU6050_SIM_PROFILE_CNT       4
+
+/* Maneuver profile: MPU6050_SIM_QUIET_SEC at rest, then MPU6050_SIM_BURST_SEC moving */
+#define MPU6050_SIM_QUIET_SEC     10.0
+#define MPU6050_SIM_BURST_SEC     5.0
+
+/*
+** Local Structure Declarations
+*/
+
+/* What the simulated sensor experiences, and how its clock runs */
+typedef struct
+{
+    uint8   ucProfile;         /* MPU6050_SIM_PROFILE_* */
+    uint8   aucSpare[3];
+    uint32  uiSeed;            /* Noise generator seed                      */
+    double  dTimeScale;        /* Device seconds per CLOCK_MONOTONIC second; 0 runs the
+                                  device clock only on MPU6050_Sim_Advance */
+    double  dClockPpm;         /* Error of the device's sample clock */
+    double  dGyroAmpDps;       /* Rate amplitude of the profile (degs/sec) */
+    double  dAccelAmpG;        /* Accel amplitude of the profile on top of gravity (g's) */
+    double  dFreqHz;           /* Frequency of the sine and maneuver motion */
+    double  adGyroBias[3];     /* Constant rate error (degs/sec) */
+    double  adAccelBias[3];    /* Constant accel error (g's) */
+    double  dGyroNoise;        /* White noise per sample, 1 sigma (degs/sec) */
+    double  dAccelNoise;       /* White noise per sample, 1 sigma (g's) */
+    double  dTempC;            /* Die temperature */
+} MPU6050_SimCfg_t;
+
+/* One simulated device */
+typedef struct
+{
+    bool    bInUse;
+    uint8   ucRegPtr;          /* Register the next transfer starts at */
+    uint8   aucReg[MPU6050_SIM_REG_CNT];
+    MPU6050_SimCfg_t Cfg;
+
+    uint8   aucFifo[MPU6050_FIFO_SIZE];
+    uint32  uiFifoHead;        /* Oldest byte */
+    uint32  uiFifoCnt;         /* Bytes queued */
+
+    uint8   aucDmpMem[MPU6050_DMP_MEM_SIZE];
+
+    uint64  uiRealStartNsec;   /* CLOCK_MONOTONIC at device time 0 */
+    uint64  uiDevNsec;         /* Device time the registers are up to date with */
+    uint64  uiNextLatchNsec;   /* Device time of the next sample */
+    uint64  uiLatchCnt;        /* Samples latched since open */
+    uint64  uiDropCnt;         /* FIFO bytes lost to overflow */
+    uint64  uiBusBytes;        /* Bytes moved over the simulated bus, both ways */
+    uint32  uiRng;             /* Noise generator state */
+} MPU6050_Sim_t;
+
+/*
+** Local Function Prototypes
+*/
+int            MPU6050_Sim_Open(const char *Profile);
+void           MPU6050_Sim_Close(int Fd);
+bool           MPU6050_Sim_IsSim(int Fd);
+MPU6050_Sim_t *MPU6050_Sim_Get(int Fd);
+int32          MPU6050_Sim_Write(int Fd, const uint8 *Buf, uint32 Len);
+int32          MPU6050_Sim_Read(int Fd, uint8 *Buf, uint32 Len);
+void           MPU6050_Sim_Advance(int Fd, uint64 Nsec);
+
+#endif /* _MPU6050_SIM_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_sim.h
+**=====================================================================================*/
@@ -0,0 +1,282 @@
+/*=======================================================================================
+** File Name:  mpu6050_spi.c
+**
+** Title:  SPI Transport for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To carry the bus driver's register transfers over Linux spidev, for the
+**           MPU-6000 and the MPU-6500 family.
+**
+** Functions Defined:
+**    MPU6050_Spi_Open  - Open and set up a spidev device
+**    MPU6050_Spi_Close - Close it
+**    MPU6050_Spi_IsSpi - Whether a handle is an SPI device
+**    MPU6050_Spi_Write - Write registers
+**    MPU6050_Spi_Read  - Read registers
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The bus driver speaks in i2c-dev transfers: select a register with a one byte
+**    write, then read.  Here the selection is only remembered, and the read is one
+**    SPI_IOC_MESSAGE with chip select held: the register with MPU6050_SPI_READ set,
+**    then the data clocked in full duplex.  A read costs one ioctl instead of two
+**    syscalls, and captures and replays stay the same for either bus.
+** 2: Every register takes MPU6050_SPI_CLOCK_HZ.  Reads of the interrupt and sensor
+**    registers run at MPU6050_SPI_DATA_CLOCK_HZ, the only ones the data sheets allow
+**    20 MHz for.  FIFO_COUNT and FIFO_R_W are read at MPU6050_SPI_FIFO_CLOCK_HZ,
+**    MPU6050_SPI_CLOCK_HZ unless a platform takes the risk of going past spec.
+** 3: The chip's I2C interface must stay off on SPI, so every USER_CTRL write sets
+**    I2C_IF_DIS; the bus driver's other users need not know which bus they are on.
+** 4: SPI mode 3, 8 bit words, as the MPU-6000 and MPU-6500 data sheets give.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
+
+#include "mpu6050_spi.h"
+#include "mpu6050_registers.h"
+
+/*
+** Local Defines
+*/
+#define MPU6050_SPI_MODE  SPI_MODE_3
+#define MPU6050_SPI_BITS  8
+
+/*
+** Local Structure Declarations
+*/
+typedef struct
+{
+    bool    bInUse;
+    int     iFd;
+    uint8   ucRegPtr;          /* Register the next read starts at */
+} MPU6050_SpiDev_t;
+
+/*
+** Local Variables
+*/
+static MPU6050_SpiDev_t MPU6050_SpiDev[MPU6050_SPI_MAX_DEVICES];
+
+/*
+** Local Function Definitions
+*/
+
+static MPU6050_SpiDev_t *MPU6050_Spi_Lookup(int Fd)
+{
+    uint32 i;
+
+    for (i = 0; i < MPU6050_SPI_MAX_DEVICES; i++)
+    {
+        if (MPU6050_SpiDev[i].bInUse && MPU6050_SpiDev[i].iFd == Fd)
+        {
+            return &MPU6050_SpiDev[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Clock a read starting at Reg may run at */
+static uint32 MPU6050_Spi_ReadClockHz(uint8 Reg, uint32 Len)
+{
+    if (Reg >= RegIntStatus && Reg + Len <= RegGyroZ + 2)
+    {
+        return MPU6050_SPI_DATA_CLOCK_HZ;
+    }
+
+    if (Reg >= RegFifoCount && Reg <= RegFifoRW)
+    {
+        return MPU6050_SPI_FIFO_CLOCK_HZ;
+    }
+
+    return MPU6050_SPI_CLOCK_HZ;
+}
+
+/* One message, chip select held: the address byte, then Len bytes out of TxPtr or
+ * into RxPtr */
+static int32 MPU6050_Spi_Transfer(int Fd, uint8 Addr, const uint8 *TxPtr, uint8 *RxPtr,
+                                  uint32 Len, uint32 ClockHz)
+{
+    struct spi_ioc_transfer xfer[2];
+
+    memset(xfer, 0x00, sizeof(xfer));
+    xfer[0].tx_buf        = (uintptr_t) &Addr;
+    xfer[0].len           = 1;
+    xfer[0].speed_hz      = ClockHz;
+    xfer[0].bits_per_word = MPU6050_SPI_BITS;
+    xfer[1].tx_buf        = (uintptr_t) TxPtr;
+    xfer[1].rx_buf        = (uintptr_t) RxPtr;
+    xfer[1].len           = Len;
+    xfer[1].speed_hz      = ClockHz;
+    xfer[1].bits_per_word = MPU6050_SPI_BITS;
+
+    if (ioctl(Fd, SPI_IOC_MESSAGE(2), xfer) < 0)
+    {
+        return -1;
+    }
+
+    return (int32) Len;
+}
+
+/*
+** Function Definitions
+*/
+
+int MPU6050_Spi_Open(const char *Path)
+{
+    uint8  mode     = MPU6050_SPI_MODE;
+    uint8  bits     = MPU6050_SPI_BITS;
+    uint32 speedHz  = (MPU6050_SPI_FIFO_CLOCK_HZ > MPU6050_SPI_DATA_CLOCK_HZ) ?
+                      MPU6050_SPI_FIFO_CLOCK_HZ : MPU6050_SPI_DATA_CLOCK_HZ;
+    uint8  userCtrl = 1 << UserCtrlI2cIfDis;
+    int    fd;
+    int    err;
+    uint32 i;
+
+    for (i = 0; i < MPU6050_SPI_MAX_DEVICES; i++)
+    {
+        if (!MPU6050_SpiDev[i].bInUse)
+        {
+            break;
+        }
+    }
+
+    if (i == MPU6050_SPI_MAX_DEVICES)
+    {
+        errno = EMFILE;
+        return -1;
+    }
+
+    fd = open(Path, O_RDWR);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    if (ioctl(fd, SPI_IOC_WR_MODE, &mode) < 0 ||
+        ioctl(fd, SPI_IOC_WR_BITS_PER_WORD, &bits) < 0 ||
+        ioctl(fd, SPI_IOC_WR_MAX_SPEED_HZ, &speedHz) < 0 ||
+        MPU6050_Spi_Transfer(fd, RegUserCtrl, &userCtrl, NULL, 1, MPU6050_SPI_CLOCK_HZ) < 0)
+    {
+        err = errno;
+        close(fd);
+        errno = err;
+        return -1;
+    }
+
+    MPU6050_SpiDev[i].bInUse   = true;
+    MPU6050_SpiDev[i].iFd      = fd;
+    MPU6050_SpiDev[i].ucRegPtr = 0;
+
+    return fd;
+}
+
+void MPU6050_Spi_Close(int Fd)
+{
+    MPU6050_SpiDev_t *devPtr = MPU6050_Spi_Lookup(Fd);
+
+    if (devPtr != NULL)
+    {
+        devPtr->bInUse = false;
+        close(Fd);
+    }
+}
+
+bool MPU6050_Spi_IsSpi(int Fd)
+{
+    return MPU6050_Spi_Lookup(Fd) != NULL;
+}
+
+int32 MPU6050_Spi_Write(int Fd, const uint8 *Buf, uint32 Len)
+{
+    MPU6050_SpiDev_t *devPtr = MPU6050_Spi_Lookup(Fd);
+    uint8 userCtrl;
+
+    if (devPtr == NULL)
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    if (Len == 0)
+    {
+        return 0;
+    }
+
+    /* Selecting the register to read from costs nothing until the read */
+    devPtr->ucRegPtr = Buf[0] & ~MPU6050_SPI_READ;
+    if (Len == 1)
+    {
+        return 1;
+    }
+
+    if (devPtr->ucRegPtr == RegUserCtrl)
+    {
+        userCtrl = Buf[1] | (1 << UserCtrlI2cIfDis);
+        if (MPU6050_Spi_Transfer(Fd, RegUserCtrl, &userCtrl, NULL, 1, MPU6050_SPI_CLOCK_HZ) < 0 ||
+            (Len > 2 && MPU6050_Spi_Transfer(Fd, RegUserCtrl + 1, &Buf[2], NULL, Len - 2,
+                                             MPU6050_SPI_CLOCK_HZ) < 0))
+        {
+            return -1;
+        }
+        return (int32) Len;
+    }
+
+    if (MPU6050_Spi_Transfer(Fd, devPtr->ucRegPtr, &Buf[1], NULL, Len - 1, MPU6050_SPI_CLOCK_HZ) < 0)
+    {
+        return -1;
+    }
+
+    return (int32) Len;
+}
+
+int32 MPU6050_Spi_Read(int Fd, uint8 *Buf, uint32 Len)
+{
+    MPU6050_SpiDev_t *devPtr = MPU6050_Spi_Lookup(Fd);
+    uint8 reg;
+
+    if (devPtr == NULL)
+    {
+        errno = EBADF;
+        return -1;
+    }
+
+    if (Len == 0)
+    {
+        return 0;
+    }
+
+    reg = devPtr->ucRegPtr;
+    if (MPU6050_Spi_Transfer(Fd, reg | MPU6050_SPI_READ, NULL, Buf, Len, MPU6050_Spi_ReadClockHz(reg, Len)) < 0)
+    {
+        return -1;
+    }
+
+    /* As on I2C, a further read goes on where this one stopped */
+    if (reg != RegFifoRW && reg != RegMemRW)
+    {
+        devPtr->ucRegPtr = (uint8) (reg + Len);
+    }
+
+    return (int32) Len;
+}
+
+/*=======================================================================================
+** End of file mpu6050_spi.c
+**=====================================================================================*/
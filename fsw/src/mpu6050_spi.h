@@ -0,0 +1,48 @@
+/*=======================================================================================
+** File Name:  mpu6050_spi.h
+**
+** Title:  SPI Transport Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the spidev transport the bus driver uses for the SPI-capable
+**           siblings of the MPU6050 (MPU-6000, MPU-6500, MPU-9250).
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_SPI_H_
+#define _MPU6050_SPI_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "mpu6050_platform_cfg.h"
+
+/*
+** Local Function Prototypes
+*/
+
+/* Open a spidev device and turn the chip's I2C interface off; -1 with errno set if
+ * the device cannot be opened or set up, or all handles are in use */
+int   MPU6050_Spi_Open(const char *Path);
+void  MPU6050_Spi_Close(int Fd);
+bool  MPU6050_Spi_IsSpi(int Fd);
+
+/* Transfers with i2c-dev semantics: a write's first byte selects the register and a
+ * read goes on from there, so the bus driver treats both buses alike */
+int32 MPU6050_Spi_Write(int Fd, const uint8 *Buf, uint32 Len);
+int32 MPU6050_Spi_Read(int Fd, uint8 *Buf, uint32 Len);
+
+#endif /* _MPU6050_SPI_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_spi.h
+**=====================================================================================*/
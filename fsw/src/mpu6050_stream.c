@@ -0,0 +1,1013 @@
+/*=======================================================================================
+** File Name:  mpu6050_stream.c
+**
+** Title:  Output Streams for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To build and publish the output streams described by the stream table in
+**           MPU6050_ConfigTbl_t.  Each stream has its own MID, content, decimation and
+**           batch size, and only does work for the samples or cycles it takes.
+**
+** Functions Defined:
+**    MPU6050_InitStreams       - Reset stream schedules, e.g. after a table update
+**    MPU6050_FlushStreams      - Send what every stream has collected and restart it
+**    MPU6050_StreamContentUsed - Whether any stream carries a content type
+**    MPU6050_StreamNewData     - Feed the samples of the last device read to the streams
+**    MPU6050_StreamCycle       - Feed the once per cycle streams
+**    MPU6050_StreamFused       - Feed the fused samples of the cycle to the fused streams
+**    MPU6050_StartStream       - Get a packet to collect stream entries in
+**    MPU6050_SendStream        - Publish the entries collected for a stream
+**    MPU6050_CleanupStreams    - Give back SB buffers held by the streams
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Sample streams (calibrated, raw, compressed, summary) see every sample drained
+**    from the device.  Once per cycle streams (latest, attitude) see the newest one.
+** 2: Raw and calibrated entries carry only the channels being sampled.  The other
+**    streams keep their fixed layouts, with 0 in the channels not sampled; a channel
+**    that is always 0 costs the compressed stream about a bit per sample.
+** 3: Fused streams see the samples of this device once they have been voted on with
+**    the peers', which can be a cycle or more after they were read.
+** 4: Quaternion streams take the DMP's quaternion of every sample, and only while the
+**    DMP sends one.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Pragmas
+*/
+
+/*
+** Include Files
+*/
+#include <string.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "cfe.h"
+#include "cfe_evs.h"
+#include "cfe_msg.h"
+#include "cfe_time.h"
+#include "mpu6050_app.h"
+#include "mpu6050_conv.h"
+#include "mpu6050_timing.h"
+#include "mpu6050_compress.h"
+#include "mpu6050_trace.h"
+
+/*
+** Local Defines
+*/
+
+/*
+** Local Structure Declarations
+*/
+
+/* Packet layout per content type.  Entries follow the header back to back. */
+typedef struct
+{
+    CFE_MSG_Size_t PktSize;    /* Largest packet */
+    CFE_MSG_Size_t HdrSize;    /* Offset of the first entry */
+    CFE_MSG_Size_t EntrySize;  /* 0 when the entries are not sent as is */
+} MPU6050_StreamLayout_t;
+
+/*
+** External Global Variables
+*/
+extern MPU6050_AppData_t  g_MPU6050_AppData;
+
+/*
+** Global Variables
+*/
+
+/*
+** Local Variables
+*/
+static const MPU6050_StreamLayout_t MPU6050_StreamLayout[MPU6050_STREAM_CONTENT_CNT] =
+{
+    [MPU6050_STREAM_LATEST]     = {sizeof(MPU6050_OutData_t), sizeof(MPU6050_OutData_t), 0},
+    [MPU6050_STREAM_CALIBRATED] = {sizeof(MPU6050_OutBatch_t), offsetof(MPU6050_OutBatch_t, Samples),
+                                   sizeof(MPU6050_Sample_t)},
+    [MPU6050_STREAM_RAW]        = {sizeof(MPU6050_OutRawBatch_t), offsetof(MPU6050_OutRawBatch_t, Samples),
+                                   sizeof(MPU6050_RawSample_t)},
+    [MPU6050_STREAM_COMPRESSED] = {sizeof(MPU6050_OutCompBatch_t), offsetof(MPU6050_OutCompBatch_t, aucBlock), 0},
+    [MPU6050_STREAM_ATTITUDE]   = {sizeof(MPU6050_OutAttBatch_t), offsetof(MPU6050_OutAttBatch_t, Attitude),
+                                   sizeof(MPU6050_Attitude_t)},
+    [MPU6050_STREAM_SUMMARY]    = {sizeof(MPU6050_OutSummary_t), offsetof(MPU6050_OutSummary_t, Summary),
+                                   sizeof(MPU6050_Summary_t)},
+    [MPU6050_STREAM_FUSED]      = {sizeof(MPU6050_OutFusedBatch_t), offsetof(MPU6050_OutFusedBatch_t, Fused),
+                                   sizeof(MPU6050_FusedSample_t)},
+    [MPU6050_STREAM_QUATERNION] = {sizeof(MPU6050_OutQuatBatch_t), offsetof(MPU6050_OutQuatBatch_t, Quat),
+                                   sizeof(MPU6050_DmpQuat_t)},
+};
+
+/*
+** Local Function Definitions
+*/
+
+static bool MPU6050_StreamActive(const MPU6050_StreamCfg_t *CfgPtr)
+{
+    return CfgPtr->msgId != 0 && CfgPtr->contentType < MPU6050_STREAM_CONTENT_CNT;
+}
+
+static bool MPU6050_StreamPerCycle(uint8 ContentType)
+{
+    return ContentType == MPU6050_STREAM_LATEST || ContentType == MPU6050_STREAM_ATTITUDE;
+}
+
+/* Table decimation, times the extra decimation of the rate profile in effect */
+static uint16 MPU6050_StreamDecimation(const MPU6050_StreamCfg_t *CfgPtr)
+{
+    uint32 decimation = ((CfgPtr->decimation == 0) ? 1 : CfgPtr->decimation) *
+                        (uint32) g_MPU6050_AppData.usPublishDecimation;
+
+    return (decimation > 0xFFFF) ? 0xFFFF : (uint16) decimation;
+}
+
+/* Bytes of one entry as sent; raw and calibrated entries shrink to the channels sampled */
+static CFE_MSG_Size_t MPU6050_StreamEntrySize(uint8 ContentType)
+{
+    switch (ContentType)
+    {
+        case MPU6050_STREAM_CALIBRATED:
+            return MPU6050_ChannelCnt(g_MPU6050_AppData.ucChannelMask & ~MPU6050_CHAN_TEMP) * sizeof(double);
+
+        case MPU6050_STREAM_RAW:
+            return MPU6050_ChannelCnt(g_MPU6050_AppData.ucChannelMask) * sizeof(int16);
+
+        default:
+            return MPU6050_StreamLayout[ContentType].EntrySize;
+    }
+}
+
+static uint16 MPU6050_StreamBatchSize(const MPU6050_StreamCfg_t *CfgPtr)
+{
+    if (CfgPtr->batchSize == 0)
+    {
+        return 1;
+    }
+
+    if (CfgPtr->batchSize > MPU6050_MAX_BATCH_SAMPLES)
+    {
+        return MPU6050_MAX_BATCH_SAMPLES;
+    }
+
+    return CfgPtr->batchSize;
+}
+
+/* Add a sample to the summary window; true once the window is complete */
+static bool MPU6050_StreamAccumulate(MPU6050_Stream_t *StreamPtr, uint32 SampleNum, uint16 Window)
+{
+    const MPU6050_InData_t *inData = &g_MPU6050_AppData.InData;
+    /* MPU6050_RawSample_t is exactly MPU6050_COMP_CHANNELS int16's */
+    const int16 *ch    = (const int16*) &inData->Samples[SampleNum];
+    int16       *minCh = (int16*) &StreamPtr->WinMin;
+    int16       *maxCh = (int16*) &StreamPtr->WinMax;
+    uint32       c;
+
+    if (StreamPtr->usWinCnt == 0)
+    {
+        StreamPtr->uiWinIdx = inData->uiFirstSampleIdx + SampleNum;
+        StreamPtr->winTime  = MPU6050_GetSampleTime(SampleNum);
+        StreamPtr->WinMin   = inData->Samples[SampleNum];
+        StreamPtr->WinMax   = inData->Samples[SampleNum];
+        memset(StreamPtr->aiWinSum, 0x00, sizeof(StreamPtr->aiWinSum));
+    }
+
+    for (c = 0; c < MPU6050_COMP_CHANNELS; c++)
+    {
+        StreamPtr->aiWinSum[c] += ch[c];
+        if (ch[c] < minCh[c])
+        {
+            minCh[c] = ch[c];
+        }
+        if (ch[c] > maxCh[c])
+        {
+            maxCh[c] = ch[c];
+        }
+    }
+
+    StreamPtr->usWinCnt++;
+
+    return StreamPtr->usWinCnt >= Window;
+}
+
+/* Close the summary window into an entry */
+static void MPU6050_StreamSummarize(MPU6050_Stream_t *StreamPtr, MPU6050_Summary_t *SumPtr)
+{
+    MPU6050_RawSample_t mean;
+    int16              *meanCh = (int16*) &mean;
+    uint32              c;
+
+    for (c = 0; c < MPU6050_COMP_CHANNELS; c++)
+    {
+        meanCh[c] = (int16) llround((double) StreamPtr->aiWinSum[c] / StreamPtr->usWinCnt);
+    }
+
+    /* Conversion is linear, so converting the mean costs one conversion per window */
+    MPU6050_Core_Convert(&g_MPU6050_AppData.Core, &mean, &SumPtr->mean);
+    SumPtr->minRaw      = StreamPtr->WinMin;
+    SumPtr->maxRaw      = StreamPtr->WinMax;
+    SumPtr->usSampleCnt = StreamPtr->usWinCnt;
+    SumPtr->usSpare     = 0;
+
+    StreamPtr->usWinCnt = 0;
+}
+
+/* Append sample SampleNum of the last read (or the summary window it closed) to a stream */
+static void MPU6050_StreamSample(uint32 StreamNum, uint32 SampleNum)
+{
+    const MPU6050_InData_t    *inData    = &g_MPU6050_AppData.InData;
+    const MPU6050_StreamCfg_t *CfgPtr    = &g_MPU6050_AppData.ConfigTbl->streams[StreamNum];
+    MPU6050_Stream_t          *StreamPtr = &g_MPU6050_AppData.Streams[StreamNum];
+    bool                       isSummary = (CfgPtr->contentType == MPU6050_STREAM_SUMMARY);
+    uint64                     sampleIdx = isSummary ? StreamPtr->uiWinIdx : inData->uiFirstSampleIdx + SampleNum;
+    uint8                      channels  = g_MPU6050_AppData.ucChannelMask;
+    MPU6050_Sample_t           calibrated;
+    uint16                     n;
+
+    /* A packet only holds evenly spaced entries */
+    if (StreamPtr->usCnt > 0 && g_MPU6050_AppData.ConfigTbl->useFifo && sampleIdx != StreamPtr->uiNextIdx)
+    {
+        MPU6050_SendStream(StreamNum);
+    }
+
+    if (StreamPtr->usCnt == 0)
+    {
+        MPU6050_StartStream(StreamNum);
+        StreamPtr->dStartTime = inData->dReadTime;
+        StreamPtr->baseTime   = isSummary ? StreamPtr->winTime : MPU6050_GetSampleTime(SampleNum);
+    }
+
+    n = StreamPtr->usCnt;
+    switch (StreamPtr->ucContent)
+    {
+        case MPU6050_STREAM_CALIBRATED:
+            if ((channels | MPU6050_CHAN_TEMP) == MPU6050_CHAN_ALL)
+            {
+                MPU6050_Core_Convert(&g_MPU6050_AppData.Core, &inData->Samples[SampleNum],
+                                     &StreamPtr->PktPtr->Cal.Samples[n]);
+            }
+            else
+            {
+                MPU6050_Core_Convert(&g_MPU6050_AppData.Core, &inData->Samples[SampleNum], &calibrated);
+                MPU6050_PackCalibrated(&calibrated, channels, (double*) StreamPtr->PktPtr->Cal.Samples +
+                                       (size_t) n * MPU6050_ChannelCnt(channels & ~MPU6050_CHAN_TEMP));
+            }
+            break;
+
+        case MPU6050_STREAM_RAW:
+            MPU6050_PackRaw(&inData->Samples[SampleNum], channels,
+                            (int16*) StreamPtr->PktPtr->Raw.Samples + (size_t) n * MPU6050_ChannelCnt(channels));
+            break;
+
+        case MPU6050_STREAM_COMPRESSED:
+            StreamPtr->Staging[n] = inData->Samples[SampleNum];
+            break;
+
+        case MPU6050_STREAM_SUMMARY:
+            StreamPtr->lastTime = StreamPtr->winTime;
+            MPU6050_StreamSummarize(StreamPtr, &StreamPtr->PktPtr->Sum.Summary[n]);
+            break;
+
+        case MPU6050_STREAM_QUATERNION:
+            StreamPtr->PktPtr->Quat.Quat[n] = inData->Quats[SampleNum];
+            break;
+
+        default:
+            break;
+    }
+
+    StreamPtr->usCnt++;
+    StreamPtr->uiNextIdx = sampleIdx + MPU6050_StreamDecimation(CfgPtr);
+
+    if (StreamPtr->usCnt >= MPU6050_StreamBatchSize(CfgPtr))
+    {
+        if (!isSummary)
+        {
+            StreamPtr->lastTime = MPU6050_GetSampleTime(SampleNum);
+        }
+        MPU6050_SendStream(StreamNum);
+    }
+}
+
+/* Don't hold old entries back waiting for a packet to fill */
+static void MPU6050_StreamCheckTimeout(uint32 StreamNum)
+{
+    const MPU6050_StreamCfg_t *CfgPtr    = &g_MPU6050_AppData.ConfigTbl->streams[StreamNum];
+    const MPU6050_Stream_t    *StreamPtr = &g_MPU6050_AppData.Streams[StreamNum];
+
+    if (StreamPtr->usCnt > 0 &&
+        (MPU6050_GetMonotonicTime() - StreamPtr->dStartTime) * 1000.0 >= CfgPtr->batchTimeoutMsec)
+    {
+        MPU6050_SendStream(StreamNum);
+    }
+}
+
+/*=====================================================================================
+** Name: MPU6050_InitStreams
+**
+** Purpose: To start every output stream on a fresh schedule
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    int32 iStatus - Status of initialization
+**
+** Routines Called:
+**    MPU6050_FlushStreams
+**    CFE_EVS_SendEvent
+**
+** Called By:
+**    MPU6050_InitApp
+**    MPU6050_ProcessSendHk
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->streams
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Streams
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Called again after a table update.  Packets in progress are sent first so that
+**    no packet mixes entries taken under two configurations.
+** 2: Entries with an unknown content type are reported and left unused.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+int32 MPU6050_InitStreams(void)
+{
+    const MPU6050_StreamCfg_t *CfgPtr;
+    uint32                     i;
+
+    MPU6050_FlushStreams();
+
+    for (i = 0; i < MPU6050_MAX_STREAMS; i++)
+    {
+        CfgPtr = &g_MPU6050_AppData.ConfigTbl->streams[i];
+
+        if (CfgPtr->msgId != 0 && CfgPtr->contentType >= MPU6050_STREAM_CONTENT_CNT)
+        {
+            CFE_EVS_SendEvent(MPU6050_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "MPU6050 - Stream %u has unknown content type %u, not used",
+                    (unsigned int) i, (unsigned int) CfgPtr->contentType);
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*=====================================================================================
+** Name: MPU6050_FlushStreams
+**
+** Purpose: To send what every stream has collected and start it on a fresh schedule
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    MPU6050_SendStream
+**
+** Called By:
+**    MPU6050_InitStreams
+**    MPU6050_ApplyRateProfile
+**    MPU6050_SetScale
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Streams
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: A summary window in progress is dropped rather than sent short.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_FlushStreams(void)
+{
+    uint32 i;
+
+    for (i = 0; i < MPU6050_MAX_STREAMS; i++)
+    {
+        MPU6050_SendStream(i);
+
+        g_MPU6050_AppData.Streams[i].usSkipCnt = 0;
+        g_MPU6050_AppData.Streams[i].usWinCnt  = 0;
+    }
+}
+
+/*=====================================================================================
+** Name: MPU6050_StreamContentUsed
+**
+** Purpose: To tell whether any output stream carries a content type
+**
+** Arguments:
+**    uint8 ContentType - MPU6050_STREAM_*
+**
+** Returns:
+**    bool - True if at least one active stream has that content
+**
+** Routines Called:
+**    None
+**
+** Called By:
+**    MPU6050_ReadDevice
+**    MPU6050_AppMain
+**    MPU6050_InitFusion
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->streams
+**
+** Global Outputs/Writes:
+**    None
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Lets the app skip computing content that no stream publishes.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+bool MPU6050_StreamContentUsed(uint8 ContentType)
+{
+    const MPU6050_StreamCfg_t *CfgPtr;
+    uint32                     i;
+
+    for (i = 0; i < MPU6050_MAX_STREAMS; i++)
+    {
+        CfgPtr = &g_MPU6050_AppData.ConfigTbl->streams[i];
+        if (MPU6050_StreamActive(CfgPtr) && CfgPtr->contentType == ContentType)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*=====================================================================================
+** Name: MPU6050_StreamNewData
+**
+** Purpose: To hand the samples of the last device read to the sample streams, each
+**          taking only the samples its decimation selects
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    MPU6050_StreamSample
+**    MPU6050_GetSampleTime
+**    MPU6050_SendStream
+**
+** Called By:
+**    MPU6050_AppMain
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.InData
+**    g_MPU6050_AppData.ConfigTbl->streams
+**    g_MPU6050_AppData.ucDmpFeatures
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Streams
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Dropped samples cost one counter decrement.  Samples are converted or copied
+**    only by the streams that take them, and a summary stream converts once per
+**    window.
+** 2: A gap in the sample index (e.g. after a FIFO overflow) sends what a stream has
+**    collected so far and starts a new packet.
+** 3: Timeouts are checked once per call, so a partial packet is sent at most one
+**    cycle after it expires.
+** 4: Quaternion streams are idle while the DMP sends no quaternion.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_StreamNewData(void)
+{
+    const MPU6050_InData_t    *inData = &g_MPU6050_AppData.InData;
+    const MPU6050_StreamCfg_t *CfgPtr;
+    MPU6050_Stream_t          *StreamPtr;
+    uint16                     decimation;
+    int32                      lastTaken;
+    uint32                     s;
+    uint32                     i;
+
+    for (s = 0; s < MPU6050_MAX_STREAMS; s++)
+    {
+        CfgPtr    = &g_MPU6050_AppData.ConfigTbl->streams[s];
+        StreamPtr = &g_MPU6050_AppData.Streams[s];
+
+        if (!MPU6050_StreamActive(CfgPtr) || MPU6050_StreamPerCycle(CfgPtr->contentType) ||
+            CfgPtr->contentType == MPU6050_STREAM_FUSED ||
+            (CfgPtr->contentType == MPU6050_STREAM_QUATERNION &&
+             !(g_MPU6050_AppData.ucDmpFeatures & MPU6050_DMP_FEAT_QUAT)))
+        {
+            continue;
+        }
+
+        decimation = MPU6050_StreamDecimation(CfgPtr);
+        lastTaken  = -1;
+
+        for (i = 0; i < inData->uiSampleCnt; i++)
+        {
+            if (CfgPtr->contentType == MPU6050_STREAM_SUMMARY)
+            {
+                if (!MPU6050_StreamAccumulate(StreamPtr, i, decimation))
+                {
+                    continue;
+                }
+            }
+            else if (StreamPtr->usSkipCnt > 0)
+            {
+                StreamPtr->usSkipCnt--;
+                continue;
+            }
+            else
+            {
+                StreamPtr->usSkipCnt = decimation - 1;
+                lastTaken = (int32) i;
+            }
+
+            MPU6050_StreamSample(s, i);
+        }
+
+        if (StreamPtr->usCnt > 0 && lastTaken >= 0)
+        {
+            StreamPtr->lastTime = MPU6050_GetSampleTime((uint32) lastTaken);
+        }
+
+        MPU6050_StreamCheckTimeout(s);
+    }
+}
+
+/*=====================================================================================
+** Name: MPU6050_StreamCycle
+**
+** Purpose: To feed the once per cycle streams (latest sample and attitude)
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    MPU6050_SendOutData
+**    MPU6050_StartStream
+**    MPU6050_SendStream
+**    MPU6050_GetMonotonicTime
+**
+** Called By:
+**    MPU6050_AppMain
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.OutData
+**    g_MPU6050_AppData.Core.Attitude
+**    g_MPU6050_AppData.ConfigTbl->streams
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Streams
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The decimation of these streams counts cycles, not samples.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_StreamCycle(void)
+{
+    const MPU6050_StreamCfg_t *CfgPtr;
+    MPU6050_Stream_t          *StreamPtr;
+    uint32                     s;
+
+    for (s = 0; s < MPU6050_MAX_STREAMS; s++)
+    {
+        CfgPtr    = &g_MPU6050_AppData.ConfigTbl->streams[s];
+        StreamPtr = &g_MPU6050_AppData.Streams[s];
+
+        if (!MPU6050_StreamActive(CfgPtr) || !MPU6050_StreamPerCycle(CfgPtr->contentType))
+        {
+            continue;
+        }
+
+        if (StreamPtr->usSkipCnt > 0)
+        {
+            StreamPtr->usSkipCnt--;
+        }
+        else
+        {
+            StreamPtr->usSkipCnt = MPU6050_StreamDecimation(CfgPtr) - 1;
+
+            if (CfgPtr->contentType == MPU6050_STREAM_LATEST)
+            {
+                MPU6050_SendOutData(CFE_SB_ValueToMsgId(CfgPtr->msgId));
+                continue;
+            }
+
+            if (StreamPtr->usCnt == 0)
+            {
+                MPU6050_StartStream(s);
+                StreamPtr->dStartTime = MPU6050_GetMonotonicTime();
+                StreamPtr->baseTime   = g_MPU6050_AppData.OutData.timeTag;
+            }
+
+            StreamPtr->PktPtr->Att.Attitude[StreamPtr->usCnt] = g_MPU6050_AppData.Core.Attitude;
+            StreamPtr->lastTime = g_MPU6050_AppData.OutData.timeTag;
+            StreamPtr->usCnt++;
+
+            if (StreamPtr->usCnt >= MPU6050_StreamBatchSize(CfgPtr))
+            {
+                MPU6050_SendStream(s);
+            }
+        }
+
+        MPU6050_StreamCheckTimeout(s);
+    }
+}
+
+/*=====================================================================================
+** Name: MPU6050_StreamFused
+**
+** Purpose: To hand the samples fused in this cycle to the fused streams, each taking
+**          only the samples its decimation selects
+**
+** Arguments:
+**    const MPU6050_VoteOut_t* Out - Fused samples, oldest first
+**    uint32 Cnt                   - Number of them, possibly 0
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    MPU6050_StartStream
+**    MPU6050_SendStream
+**    MPU6050_NsecToTime
+**    MPU6050_GetMonotonicTime
+**
+** Called By:
+**    MPU6050_FusionNewData
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->streams
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Streams
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Called every cycle, with or without samples, so that timeouts are checked.
+** 2: A sample of this device lost before it could be fused leaves a gap; what a
+**    stream has collected so far is sent and a new packet started.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_StreamFused(const MPU6050_VoteOut_t *Out, uint32 Cnt)
+{
+    const MPU6050_StreamCfg_t *CfgPtr;
+    MPU6050_Stream_t          *StreamPtr;
+    uint16                     decimation;
+    uint32                     s;
+    uint32                     i;
+
+    for (s = 0; s < MPU6050_MAX_STREAMS; s++)
+    {
+        CfgPtr    = &g_MPU6050_AppData.ConfigTbl->streams[s];
+        StreamPtr = &g_MPU6050_AppData.Streams[s];
+
+        if (!MPU6050_StreamActive(CfgPtr) || CfgPtr->contentType != MPU6050_STREAM_FUSED)
+        {
+            continue;
+        }
+
+        decimation = MPU6050_StreamDecimation(CfgPtr);
+
+        for (i = 0; i < Cnt; i++)
+        {
+            if (StreamPtr->usSkipCnt > 0)
+            {
+                StreamPtr->usSkipCnt--;
+                continue;
+            }
+            StreamPtr->usSkipCnt = decimation - 1;
+
+            if (StreamPtr->usCnt > 0 && Out[i].uiSeq != (uint32) StreamPtr->uiNextIdx)
+            {
+                MPU6050_SendStream(s);
+            }
+
+            if (StreamPtr->usCnt == 0)
+            {
+                MPU6050_StartStream(s);
+                StreamPtr->dStartTime = MPU6050_GetMonotonicTime();
+                StreamPtr->baseTime   = MPU6050_NsecToTime(Out[i].uiTimeNsec);
+            }
+
+            StreamPtr->PktPtr->Fus.Fused[StreamPtr->usCnt] = Out[i].Fused;
+            StreamPtr->lastTime  = MPU6050_NsecToTime(Out[i].uiTimeNsec);
+            StreamPtr->uiNextIdx = Out[i].uiSeq + decimation;
+            StreamPtr->usCnt++;
+
+            if (StreamPtr->usCnt >= MPU6050_StreamBatchSize(CfgPtr))
+            {
+                MPU6050_SendStream(s);
+            }
+        }
+
+        MPU6050_StreamCheckTimeout(s);
+    }
+}
+
+/*=====================================================================================
+** Name: MPU6050_StartStream
+**
+** Purpose: To get a packet to collect the entries of a stream in
+**
+** Arguments:
+**    uint32 StreamNum - Stream table entry
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    MPU6050_AllocPacket
+**    CFE_MSG_Init
+**
+** Called By:
+**    MPU6050_StreamNewData
+**    MPU6050_StreamCycle
+**    MPU6050_StreamFused
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.ConfigTbl->streams
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Streams[StreamNum]
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The packet is collected directly in an SB buffer, which is handed to SB as is
+**    when it is sent.  If SB has no buffer to give, it is collected in the stream's
+**    own packet and copied by SB instead.
+** 2: Only the header part of the packet is initialized; the length is set on send.
+** 3: Compressed streams are staged raw; the coder writes into an SB buffer on send.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_StartStream(uint32 StreamNum)
+{
+    const MPU6050_StreamCfg_t *CfgPtr    = &g_MPU6050_AppData.ConfigTbl->streams[StreamNum];
+    MPU6050_Stream_t          *StreamPtr = &g_MPU6050_AppData.Streams[StreamNum];
+
+    StreamPtr->ucContent = CfgPtr->contentType;
+    StreamPtr->MsgId     = CFE_SB_ValueToMsgId(CfgPtr->msgId);
+    StreamPtr->BufPtr    = NULL;
+    StreamPtr->PktPtr    = &StreamPtr->Fallback;
+
+    if (StreamPtr->ucContent == MPU6050_STREAM_COMPRESSED)
+    {
+        return;
+    }
+
+    StreamPtr->BufPtr = MPU6050_AllocPacket(MPU6050_StreamLayout[StreamPtr->ucContent].PktSize);
+    if (StreamPtr->BufPtr != NULL)
+    {
+        StreamPtr->PktPtr = (MPU6050_StreamPkt_t*) StreamPtr->BufPtr;
+    }
+
+    CFE_MSG_Init((CFE_MSG_Message_t*) StreamPtr->PktPtr, StreamPtr->MsgId,
+                 MPU6050_StreamLayout[StreamPtr->ucContent].HdrSize);
+}
+
+/*=====================================================================================
+** Name: MPU6050_SendStream
+**
+** Purpose: To publish the entries collected for a stream
+**
+** Arguments:
+**    uint32 StreamNum - Stream table entry
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_MSG_Init
+**    CFE_MSG_SetSize
+**    CFE_MSG_SetMsgTime
+**    CFE_SB_TransmitMsg
+**    MPU6050_AllocPacket
+**    MPU6050_TransmitPacket
+**    MPU6050_CompressBlock
+**
+** Called By:
+**    MPU6050_FlushStreams
+**    MPU6050_StreamNewData
+**    MPU6050_StreamCycle
+**    MPU6050_StreamFused
+**
+** Global Inputs/Reads:
+**    g_MPU6050_AppData.Core.TimeModel
+**    g_MPU6050_AppData.ConfigTbl
+**    g_MPU6050_AppData.Sched
+**    g_MPU6050_AppData.ucRateProfile
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Streams[StreamNum]
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The entry period is taken from the first and last entry times of the packet,
+**    so it is the fitted period in FIFO mode and the mean read period otherwise.
+** 2: Only the used part of the entries (or of the coded block) is sent.
+** 3: Coding a compressed packet is bounded by its sample count; see mpu6050_compress.c.
+** 4: The rate profile in the header is the one in effect; a profile switch flushes
+**    every stream first, so no packet spans two profiles.  The same holds for the
+**    channel mask, which sets the size of raw and calibrated entries.
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_SendStream(uint32 StreamNum)
+{
+    MPU6050_Stream_t    *StreamPtr = &g_MPU6050_AppData.Streams[StreamNum];
+    uint16               entryCnt  = StreamPtr->usCnt;
+    uint16               decimation;
+    CFE_SB_Buffer_t     *bufPtr    = StreamPtr->BufPtr;
+    MPU6050_StreamPkt_t *pktPtr    = StreamPtr->PktPtr;
+    MPU6050_BatchHdr_t  *hdrPtr;
+    CFE_TIME_SysTime_t   span;
+    CFE_MSG_Size_t       pktSize;
+    uint32               periodNsec;
+
+    if (entryCnt == 0)
+    {
+        return;
+    }
+
+    decimation = MPU6050_StreamDecimation(&g_MPU6050_AppData.ConfigTbl->streams[StreamNum]);
+
+    if (entryCnt > 1)
+    {
+        span = CFE_TIME_Subtract(StreamPtr->lastTime, StreamPtr->baseTime);
+        periodNsec = (uint32) ((((double) span.Seconds) + ((double) span.Subseconds) / 4294967296.0)
+                               * 1e9 / (entryCnt - 1));
+    }
+    else if (MPU6050_StreamPerCycle(StreamPtr->ucContent))
+    {
+        /* Cycles follow the acquisition tick while it runs */
+        periodNsec = (g_MPU6050_AppData.Sched.iTimerFd >= 0) ?
+                     decimation * g_MPU6050_AppData.Sched.uiPeriodNsec :
+                     (uint32) (decimation * 1e9 / MPU6050_SAMPLE_RATE_HZ);
+    }
+    else
+    {
+        periodNsec = (uint32) (decimation * g_MPU6050_AppData.Core.TimeModel.Period * 1e9);
+    }
+
+    if (StreamPtr->ucContent == MPU6050_STREAM_COMPRESSED)
+    {
+        bufPtr = MPU6050_AllocPacket(sizeof(MPU6050_OutCompBatch_t));
+        pktPtr = (bufPtr != NULL) ? (MPU6050_StreamPkt_t*) bufPtr : &StreamPtr->Fallback;
+        CFE_MSG_Init((CFE_MSG_Message_t*) pktPtr, StreamPtr->MsgId, offsetof(MPU6050_OutCompBatch_t, aucBlock));
+
+        /* MPU6050_RawSample_t is exactly MPU6050_COMP_CHANNELS int16's in coder order */
+        pktPtr->Comp.usBlockBytes = (uint16) MPU6050_CompressBlock(
+                (const int16 (*)[MPU6050_COMP_CHANNELS]) StreamPtr->Staging,
+                entryCnt, pktPtr->Comp.aucBlock, sizeof(pktPtr->Comp.aucBlock));
+        pktPtr->Comp.usSpare = 0;
+
+        pktSize = offsetof(MPU6050_OutCompBatch_t, aucBlock) + pktPtr->Comp.usBlockBytes;
+    }
+    else
+    {
+        pktSize = MPU6050_StreamLayout[StreamPtr->ucContent].HdrSize +
+                  entryCnt * MPU6050_StreamEntrySize(StreamPtr->ucContent);
+    }
+
+    hdrPtr = &pktPtr->Hdr.Batch;
+    hdrPtr->uiCounter          = ++StreamPtr->uiCounter;
+    hdrPtr->usSampleCnt        = entryCnt;
+    hdrPtr->ucAccelScale       = g_MPU6050_AppData.ConfigTbl->initialAccelScale;
+    hdrPtr->ucGyroScale        = g_MPU6050_AppData.ConfigTbl->initialGyroScale;
+    hdrPtr->baseTime           = StreamPtr->baseTime;
+    hdrPtr->uiSamplePeriodNsec = periodNsec;
+    hdrPtr->usTableVersion     = g_MPU6050_AppData.ConfigTbl->tableVersion;
+    hdrPtr->ucStreamNum        = (uint8) StreamNum;
+    hdrPtr->ucRateProfile      = g_MPU6050_AppData.ucRateProfile;
+    hdrPtr->ucChannelMask      = g_MPU6050_AppData.ucChannelMask;
+    memset(hdrPtr->aucSpare, 0x00, sizeof(hdrPtr->aucSpare));
+
+    MPU6050_TRACE_DEBUG(&g_MPU6050_AppData.TraceRing, MPU6050_TRACE_STREAM_SEND, StreamNum, entryCnt);
+
+    CFE_MSG_SetSize((CFE_MSG_Message_t*) pktPtr, pktSize);
+    CFE_MSG_SetMsgTime((CFE_MSG_Message_t*) pktPtr, StreamPtr->baseTime);
+
+    if (bufPtr != NULL)
+    {
+        MPU6050_TransmitPacket(bufPtr, true);
+    }
+    else
+    {
+        CFE_SB_TransmitMsg((CFE_MSG_Message_t*) pktPtr, true);
+    }
+
+    StreamPtr->BufPtr = NULL;
+    StreamPtr->usCnt  = 0;
+}
+
+/*=====================================================================================
+** Name: MPU6050_CleanupStreams
+**
+** Purpose: To give back the SB buffers of packets still being collected
+**
+** Arguments:
+**    None
+**
+** Returns:
+**    None
+**
+** Routines Called:
+**    CFE_SB_ReleaseMessageBuffer
+**
+** Called By:
+**    MPU6050_CleanupCallback
+**
+** Global Inputs/Reads:
+**    None
+**
+** Global Outputs/Writes:
+**    g_MPU6050_AppData.Streams
+**
+** Limitations, Assumptions, External Events, and Notes:
+**
+** Algorithm:
+**
+** Author(s):  Jacob Killelea
+**
+** History:  Date Written  2026-10-19
+**           Unit Tested   yyyy-mm-dd
+**=====================================================================================*/
+void MPU6050_CleanupStreams(void)
+{
+    uint32 i;
+
+    for (i = 0; i < MPU6050_MAX_STREAMS; i++)
+    {
+        if (g_MPU6050_AppData.Streams[i].BufPtr != NULL)
+        {
+            CFE_SB_ReleaseMessageBuffer(g_MPU6050_AppData.Streams[i].BufPtr);
+            g_MPU6050_AppData.Streams[i].BufPtr = NULL;
+        }
+        g_MPU6050_AppData.Streams[i].usCnt = 0;
+    }
+}
+
+/*=======================================================================================
+** End of file mpu6050_stream.c
+**=====================================================================================*/
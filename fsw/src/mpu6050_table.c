@@ -2,8 +2,87 @@
 #include "mpu6050_app.h"
 
 MPU6050_ConfigTbl_t MPU6050_Configuration_Table = {
+    .tableVersion      = 1,
     .initialAccelScale = MPU6050_ACCELSCALE_2G, // initial accelerometer sensitivity
     .initialGyroScale  = MPU6050_GYROSCALE_250DPS, // initial gyro sensitivity
+    .sampleRateDiv     = 9, // 1 kHz / (1 + 9) = 100 Hz output data rate
+    .dlpfConfig        = 3, // 44 Hz bandwidth, 1 kHz gyro rate
+    .useFifo           = 1, // drain every sample from the FIFO each cycle
+    .axisEnable        = MPU6050_CHAN_ALL, // e.g. MPU6050_CHAN_GYRO for a gyro-only payload
+    .acqRateHz         = MPU6050_SAMPLE_RATE_HZ, // read on a fixed rate timer, not on SCH wakeups
+    .realtime          = {
+        .policy     = MPU6050_RT_POLICY_FIFO,
+        .priority   = 80,  // above the logging and network daemons
+        .lockMemory = 1,
+        .cpuMask    = 0,   // set to an isolated core (isolcpus) where there is one
+    },
+    .adaptiveRate      = 1, // follow the motion between the profiles below
+    .rateProfileCnt    = 3,
+    .motionWindowMsec  = 250,
+    .motionHoldMsec    = 3000,
+    .rateProfiles      = {
+        /* Parked: 20 Hz output data rate, 10 Hz bandwidth, drained twice a second */
+        {.sampleRateDiv = 49, .dlpfConfig = 5, .acqRateHz = 2,  .publishDecimation = 1},
+        /* Nominal: the fixed rate above */
+        {.sampleRateDiv = 9,  .dlpfConfig = 3, .acqRateHz = 10, .publishDecimation = 1,
+         .enterGyroDps = 3.0f,  .enterAccelMg = 30.0f,  .exitGyroDps = 1.5f,  .exitAccelMg = 15.0f},
+        /* Maneuvering: 500 Hz output data rate, 94 Hz bandwidth, 25 samples per read */
+        {.sampleRateDiv = 1,  .dlpfConfig = 2, .acqRateHz = 20, .publishDecimation = 1,
+         .enterGyroDps = 45.0f, .enterAccelMg = 300.0f, .exitGyroDps = 20.0f, .exitAccelMg = 150.0f},
+    },
+    .powerState        = MPU6050_POWER_ACTIVE, // startup power state, changed by command
+    .cycleWakeRate     = LPWake5Hz, // accelerometer wake-ups in MPU6050_POWER_CYCLE
+    .streams           = {
+        /* Newest sample every cycle, as before batching */
+        {.msgId = MPU6050_OUT_DATA_MID,  .contentType = MPU6050_STREAM_LATEST,
+         .decimation = 1,   .batchSize = 1,  .batchTimeoutMsec = 0},
+        /* Every sample, 100 Hz / 20 = 5 packets per second */
+        {.msgId = MPU6050_OUT_BATCH_MID, .contentType = MPU6050_STREAM_CALIBRATED,
+         .decimation = 1,   .batchSize = 20, .batchTimeoutMsec = 500},
+        /* Every sample, compressed for the recorder */
+        {.msgId = MPU6050_OUT_COMP_MID,  .contentType = MPU6050_STREAM_COMPRESSED,
+         .decimation = 1,   .batchSize = 50, .batchTimeoutMsec = 1000},
+        /* 1 Hz summaries for the ground */
+        {.msgId = MPU6050_OUT_SUM_MID,   .contentType = MPU6050_STREAM_SUMMARY,
+         .decimation = 100, .batchSize = 1,  .batchTimeoutMsec = 0},
+        /* Attitude every cycle, 10 cycles per packet */
+        {.msgId = MPU6050_OUT_ATT_MID,   .contentType = MPU6050_STREAM_ATTITUDE,
+         .decimation = 1,   .batchSize = 10, .batchTimeoutMsec = 2000},
+        /* Entries with msgId 0 are unused */
+    },
+    .fusion            = {
+        /* Calibrated streams of the other MPU6050 instances to fuse with, none by default;
+           used once a stream carries MPU6050_STREAM_FUSED */
+        .peerMsgIds     = {0},
+        .accelTolMg     = 50.0f,  // well clear of sensor noise and cross-device misalignment
+        .gyroTolDps     = 2.0f,
+        .maxGapMsec     = 100,    // twice the longest sample period of any profile
+        .latencyMsec    = 200,
+        .faultPersist   = 10,
+        .recoverPersist = 100,
+    },
+    .dmp               = {
+        /* Off until an image is named.  These suit the Motion Driver 6.12 image, built for
+           200 Hz sampling, so naming it needs sampleRateDiv = 4 above (1 kHz / 5); the
+           memory writes that switch its features on go in patches */
+        .imagePath  = "",
+        .startAddr  = 0x0400,
+        .chunkBytes = 0,      // whole banks; lower for adapters with short messages
+        .rateAddr   = 0x0216, // D_0_22
+        .rateDiv    = 0,      // a packet per sample
+        .features   = MPU6050_DMP_FEAT_QUAT | MPU6050_DMP_FEAT_ACCEL | MPU6050_DMP_FEAT_GYRO,
+        .sampleRateHz = 200,  // refused at any other rate, as its quaternion would be off
+        .patches    = {{0}},
+    },
+    .calibration       = {
+        .accelBias   = {0.0, 0.0, 0.0},
+        .accelMatrix = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
+        .gyroBias    = {0.0, 0.0, 0.0},
+        .gyroMatrix  = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
+    },
+    .recorderPath      = "/cf/mpu6050.rec",
+    .recorderBlocks    = 1024, // 4 MiB, about 48 minutes of 100 Hz samples
+    .recorderSyncMsec  = 1000,
     .deviceI2CAddr     = MPU6050_DEVICE_ADDR,
 
 /* Linux path to I2C bus */
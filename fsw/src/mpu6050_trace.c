@@ -0,0 +1,225 @@
+/*=======================================================================================
+** File Name:  mpu6050_trace.c
+**
+** Title:  Binary Trace for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To keep fixed-size binary trace records in a per-task ring, and to write
+**           the ring to a file as records or as decoded text on command.
+**
+** Functions Defined:
+**    MPU6050_TraceInit  - Empty a ring
+**    MPU6050_TraceWrite - Append a record to a ring
+**    MPU6050_TraceDump  - Write a ring to a file, raw or decoded
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: A ring has a single writer, the task that owns it.  Writes are a handful of
+**    stores and a clock read; nothing is formatted until the ring is dumped.
+** 2: Nothing here is built when MPU6050_TRACE_LEVEL is MPU6050_TRACE_LEVEL_OFF.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "mpu6050_trace.h"
+
+#if MPU6050_TRACE_LEVEL > MPU6050_TRACE_LEVEL_OFF
+
+/*
+** Local Structure Declarations
+*/
+typedef struct
+{
+    uint16      usEventId;
+    const char *pcName;
+    const char *apcArgNames[MPU6050_TRACE_MAX_ARGS];
+} MPU6050_TraceName_t;
+
+/*
+** Local Variables
+*/
+static const MPU6050_TraceName_t MPU6050_TraceNames[] =
+{
+    {MPU6050_TRACE_ATTITUDE,     "ATTITUDE",     {"dt", "phi", "theta", "psi", "dphi", "dtheta", "dpsi"}},
+    {MPU6050_TRACE_READ,         "READ",         {"samples"}},
+    {MPU6050_TRACE_FIFO_OFLOW,   "FIFO_OFLOW",   {NULL}},
+    {MPU6050_TRACE_STREAM_SEND,  "STREAM_SEND",  {"stream", "entries"}},
+    {MPU6050_TRACE_TBL_UPDATE,   "TBL_UPDATE",   {NULL}},
+    {MPU6050_TRACE_RATE_PROFILE, "RATE_PROFILE", {"profile", "gyro_dps", "accel_mg"}},
+};
+
+/*
+** Local Function Definitions
+*/
+
+/* Copy record Seq out of the ring; false if it is not (or no longer) there */
+static bool MPU6050_TraceRead(const MPU6050_TraceRing_t *RingPtr, uint32 Seq, MPU6050_TraceRec_t *RecPtr)
+{
+    const MPU6050_TraceRec_t *slotPtr = &RingPtr->Recs[(Seq - 1) % MPU6050_TRACE_RING_SIZE];
+
+    if (__atomic_load_n(&slotPtr->uiSeq, __ATOMIC_ACQUIRE) != Seq)
+    {
+        return false;
+    }
+
+    memcpy(RecPtr, slotPtr, sizeof(*RecPtr));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    return __atomic_load_n(&slotPtr->uiSeq, __ATOMIC_RELAXED) == Seq && RecPtr->uiSeq == Seq;
+}
+
+static const MPU6050_TraceName_t *MPU6050_TraceLookup(uint16 EventId)
+{
+    uint32 i;
+
+    for (i = 0; i < sizeof(MPU6050_TraceNames) / sizeof(MPU6050_TraceNames[0]); i++)
+    {
+        if (MPU6050_TraceNames[i].usEventId == EventId)
+        {
+            return &MPU6050_TraceNames[i];
+        }
+    }
+
+    return NULL;
+}
+
+void MPU6050_TraceInit(MPU6050_TraceRing_t *RingPtr)
+{
+    memset(RingPtr, 0x00, sizeof(*RingPtr));
+}
+
+void MPU6050_TraceWrite(MPU6050_TraceRing_t *RingPtr, uint16 EventId, const float *Args, uint32 ArgCnt)
+{
+    uint32              seq    = RingPtr->uiHead + 1;
+    MPU6050_TraceRec_t *recPtr = &RingPtr->Recs[(seq - 1) % MPU6050_TRACE_RING_SIZE];
+    struct timespec     now;
+
+    if (seq == 0)
+    {
+        seq = 1;  /* 0 marks a record being written */
+    }
+
+    if (ArgCnt > MPU6050_TRACE_MAX_ARGS)
+    {
+        ArgCnt = MPU6050_TRACE_MAX_ARGS;
+    }
+
+    /* Readers must see the slot as invalid before any of it changes */
+    __atomic_store_n(&recPtr->uiSeq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    recPtr->uiTimeNsec = (uint64) now.tv_sec * 1000000000ull + (uint64) now.tv_nsec;
+    recPtr->usEventId  = EventId;
+    recPtr->usArgCnt   = (uint16) ArgCnt;
+    memcpy(recPtr->afArg, Args, ArgCnt * sizeof(float));
+
+    __atomic_store_n(&recPtr->uiSeq, seq, __ATOMIC_RELEASE);
+    __atomic_store_n(&RingPtr->uiHead, seq, __ATOMIC_RELEASE);
+}
+
+int32 MPU6050_TraceDump(const MPU6050_TraceRing_t *RingPtr, const char *Path, bool Decode)
+{
+    const MPU6050_TraceName_t *namePtr;
+    MPU6050_TraceRec_t         rec;
+    MPU6050_TraceFileHdr_t     fileHdr;
+    FILE                      *filePtr;
+    uint32                     head = __atomic_load_n(&RingPtr->uiHead, __ATOMIC_ACQUIRE);
+    uint32                     seq  = (head > MPU6050_TRACE_RING_SIZE) ? head - MPU6050_TRACE_RING_SIZE + 1 : 1;
+    uint32                     a;
+    int32                      recCnt = 0;
+
+    filePtr = fopen(Path, Decode ? "w" : "wb");
+    if (filePtr == NULL)
+    {
+        return -1;
+    }
+
+    /* The record count is filled in once it is known */
+    memset(&fileHdr, 0x00, sizeof(fileHdr));
+    fileHdr.uiMagic    = MPU6050_TRACE_FILE_MAGIC;
+    fileHdr.uiRecBytes = sizeof(MPU6050_TraceRec_t);
+    if (!Decode)
+    {
+        fwrite(&fileHdr, sizeof(fileHdr), 1, filePtr);
+    }
+
+    for (; head != 0 && seq <= head; seq++)
+    {
+        if (!MPU6050_TraceRead(RingPtr, seq, &rec))
+        {
+            continue;
+        }
+
+        if (!Decode)
+        {
+            fwrite(&rec, sizeof(rec), 1, filePtr);
+        }
+        else
+        {
+            namePtr = MPU6050_TraceLookup(rec.usEventId);
+
+            fprintf(filePtr, "%llu.%09llu %10u ",
+                    (unsigned long long) (rec.uiTimeNsec / 1000000000ull),
+                    (unsigned long long) (rec.uiTimeNsec % 1000000000ull), (unsigned int) rec.uiSeq);
+
+            if (namePtr != NULL)
+            {
+                fprintf(filePtr, "%-12s", namePtr->pcName);
+            }
+            else
+            {
+                fprintf(filePtr, "EVENT_%-6u", (unsigned int) rec.usEventId);
+            }
+
+            for (a = 0; a < rec.usArgCnt && a < MPU6050_TRACE_MAX_ARGS; a++)
+            {
+                if (namePtr != NULL && namePtr->apcArgNames[a] != NULL)
+                {
+                    fprintf(filePtr, " %s=%g", namePtr->apcArgNames[a], rec.afArg[a]);
+                }
+                else
+                {
+                    fprintf(filePtr, " %g", rec.afArg[a]);
+                }
+            }
+
+            fprintf(filePtr, "\n");
+        }
+
+        recCnt++;
+    }
+
+    if (!Decode)
+    {
+        fileHdr.uiRecCnt = (uint32) recCnt;
+        fseek(filePtr, 0, SEEK_SET);
+        fwrite(&fileHdr, sizeof(fileHdr), 1, filePtr);
+    }
+
+    if (fclose(filePtr) != 0)
+    {
+        return -1;
+    }
+
+    return recCnt;
+}
+
+#endif /* MPU6050_TRACE_LEVEL > MPU6050_TRACE_LEVEL_OFF */
+
+/*=======================================================================================
+** End of file mpu6050_trace.c
+**=====================================================================================*/
@@ -0,0 +1,114 @@
+/*=======================================================================================
+** File Name:  mpu6050_trace.h
+**
+** Title:  Binary Trace Header File for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To declare the in-memory trace ring that replaces console output on the
+**           processing loop, and the macros used to write to it.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_TRACE_H_
+#define _MPU6050_TRACE_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "mpu6050_platform_cfg.h"
+
+/*
+** Local Defines
+*/
+
+/* Trace levels; MPU6050_TRACE_LEVEL (see mpu6050_platform_cfg.h) selects what is built */
+#define MPU6050_TRACE_LEVEL_OFF    0  /* No trace code or ring at all          */
+#define MPU6050_TRACE_LEVEL_EVENT  1  /* Occasional events (overflows, resets) */
+#define MPU6050_TRACE_LEVEL_DEBUG  2  /* Per cycle and per packet records      */
+
+/* Trace event IDs */
+#define MPU6050_TRACE_ATTITUDE     1  /* dt, phi, theta, psi, dphi, dtheta, dpsi */
+#define MPU6050_TRACE_READ         2  /* samples read                            */
+#define MPU6050_TRACE_FIFO_OFLOW   3  /* (none)                                  */
+#define MPU6050_TRACE_STREAM_SEND  4  /* stream, entries                         */
+#define MPU6050_TRACE_TBL_UPDATE   5  /* (none)                                  */
+#define MPU6050_TRACE_RATE_PROFILE 6  /* profile, gyro RMS, accel std-dev        */
+
+#define MPU6050_TRACE_MAX_ARGS     7
+
+#define MPU6050_TRACE_FILE_MAGIC   0x4D505454  /* "MPTT" */
+
+/*
+** Local Structure Declarations
+*/
+
+/* One trace record.  uiSeq is 0 while the record is being written. */
+typedef struct
+{
+    uint64  uiTimeNsec;        /* CLOCK_MONOTONIC when the record was written */
+    uint32  uiSeq;             /* Record number in its ring, from 1 */
+    uint16  usEventId;         /* MPU6050_TRACE_* */
+    uint16  usArgCnt;
+    float   afArg[MPU6050_TRACE_MAX_ARGS];
+} MPU6050_TraceRec_t;
+
+/* Ring of the newest MPU6050_TRACE_RING_SIZE records.  Each task writes only to its
+** own ring, so writing needs no lock; readers check uiSeq to drop records that were
+** overwritten while they were being copied. */
+typedef struct
+{
+    uint32              uiHead;  /* Sequence number of the newest record */
+    MPU6050_TraceRec_t  Recs[MPU6050_TRACE_RING_SIZE];
+} MPU6050_TraceRing_t;
+
+/* Binary dump file header, followed by uiRecCnt MPU6050_TraceRec_t oldest first */
+typedef struct
+{
+    uint32  uiMagic;           /* MPU6050_TRACE_FILE_MAGIC */
+    uint32  uiRecBytes;        /* sizeof(MPU6050_TraceRec_t) */
+    uint32  uiRecCnt;
+    uint32  uiSpare;
+} MPU6050_TraceFileHdr_t;
+
+/*
+** Trace macros.  Arguments are stored as floats, without formatting.
+*/
+#if MPU6050_TRACE_LEVEL >= MPU6050_TRACE_LEVEL_EVENT
+#define MPU6050_TRACE_EVENT(RingPtr, EventId, ...) \
+    MPU6050_TraceWrite((RingPtr), (EventId), (const float[]){0, ##__VA_ARGS__} + 1, \
+                       sizeof((const float[]){0, ##__VA_ARGS__}) / sizeof(float) - 1)
+#else
+#define MPU6050_TRACE_EVENT(RingPtr, EventId, ...) ((void) 0)
+#endif
+
+#if MPU6050_TRACE_LEVEL >= MPU6050_TRACE_LEVEL_DEBUG
+#define MPU6050_TRACE_DEBUG(RingPtr, EventId, ...) \
+    MPU6050_TraceWrite((RingPtr), (EventId), (const float[]){0, ##__VA_ARGS__} + 1, \
+                       sizeof((const float[]){0, ##__VA_ARGS__}) / sizeof(float) - 1)
+#else
+#define MPU6050_TRACE_DEBUG(RingPtr, EventId, ...) ((void) 0)
+#endif
+
+/*
+** Local Function Prototypes
+*/
+#if MPU6050_TRACE_LEVEL > MPU6050_TRACE_LEVEL_OFF
+void  MPU6050_TraceInit(MPU6050_TraceRing_t *RingPtr);
+void  MPU6050_TraceWrite(MPU6050_TraceRing_t *RingPtr, uint16 EventId, const float *Args, uint32 ArgCnt);
+int32 MPU6050_TraceDump(const MPU6050_TraceRing_t *RingPtr, const char *Path, bool Decode);
+#endif
+
+#endif /* _MPU6050_TRACE_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_trace.h
+**=====================================================================================*/
@@ -0,0 +1,361 @@
+/*=======================================================================================
+** File Name:  mpu6050_capdiff.c
+**
+** Title:  Replay Output Comparison for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To compare what two builds computed from the same capture, bit for bit or
+**           within a tolerance, and show where they part.
+**
+** Usage:
+**    mpu6050_capdiff [-n max] [-t tol] a.bin b.bin
+**
+**    -n  Differing samples to print (default 10); all are counted
+**    -t  Let floating point fields differ by up to tol, and print the largest
+**        difference of each; for comparing a fixed point build with the reference
+**
+**    Exits 0 if the files are identical (within tol), 1 if they differ, 2 if either
+**    cannot be read.
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: Inputs are mpu6050_replay output.  Floating point fields are compared by their
+**    bits, so a -0.0 against a 0.0 counts as a difference.  With -t, angles are
+**    compared modulo 2 pi and integer fields must still match exactly.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "mpu6050_replay.h"
+
+/*
+** Local Defines
+*/
+#define MPU6050_DIFF_FIELD(name, member, type) {name, offsetof(MPU6050_ReplayOutRec_t, member), type}
+
+/*
+** Local Structure Declarations
+*/
+typedef enum
+{
+    MPU6050_DIFF_U64,
+    MPU6050_DIFF_U32,
+    MPU6050_DIFF_U16,
+    MPU6050_DIFF_U8,
+    MPU6050_DIFF_I16,
+    MPU6050_DIFF_F64,
+    MPU6050_DIFF_F32,
+    MPU6050_DIFF_A64          /* Angle (rad), double */
+} MPU6050_DiffType_t;
+
+typedef struct
+{
+    const char        *Name;
+    size_t             Offset;
+    MPU6050_DiffType_t Type;
+} MPU6050_DiffField_t;
+
+/*
+** Local Variables
+*/
+static const MPU6050_DiffField_t MPU6050_DiffFields[] =
+{
+    MPU6050_DIFF_FIELD("sample_idx",  uiSampleIdx,      MPU6050_DIFF_U64),
+    MPU6050_DIFF_FIELD("sample_time", dSampleTime,      MPU6050_DIFF_F64),
+    MPU6050_DIFF_FIELD("raw.accel_x", Raw.accel[0],     MPU6050_DIFF_I16),
+    MPU6050_DIFF_FIELD("raw.accel_y", Raw.accel[1],     MPU6050_DIFF_I16),
+    MPU6050_DIFF_FIELD("raw.accel_z", Raw.accel[2],     MPU6050_DIFF_I16),
+    MPU6050_DIFF_FIELD("raw.temp",    Raw.temp,         MPU6050_DIFF_I16),
+    MPU6050_DIFF_FIELD("raw.gyro_x",  Raw.gyro[0],      MPU6050_DIFF_I16),
+    MPU6050_DIFF_FIELD("raw.gyro_y",  Raw.gyro[1],      MPU6050_DIFF_I16),
+    MPU6050_DIFF_FIELD("raw.gyro_z",  Raw.gyro[2],      MPU6050_DIFF_I16),
+    MPU6050_DIFF_FIELD("channels",    ucChannels,       MPU6050_DIFF_U8),
+    MPU6050_DIFF_FIELD("accel_x",     Cal.accelXGees,   MPU6050_DIFF_F64),
+    MPU6050_DIFF_FIELD("accel_y",     Cal.accelYGees,   MPU6050_DIFF_F64),
+    MPU6050_DIFF_FIELD("accel_z",     Cal.accelZGees,   MPU6050_DIFF_F64),
+    MPU6050_DIFF_FIELD("gyro_x",      Cal.gyroXDegsSec, MPU6050_DIFF_F64),
+    MPU6050_DIFF_FIELD("gyro_y",      Cal.gyroYDegsSec, MPU6050_DIFF_F64),
+    MPU6050_DIFF_FIELD("gyro_z",      Cal.gyroZDegsSec, MPU6050_DIFF_F64),
+    MPU6050_DIFF_FIELD("phi",         Att.phi,          MPU6050_DIFF_A64),
+    MPU6050_DIFF_FIELD("theta",       Att.theta,        MPU6050_DIFF_A64),
+    MPU6050_DIFF_FIELD("psi",         Att.psi,          MPU6050_DIFF_A64),
+    MPU6050_DIFF_FIELD("gyro_rms",    fGyroRmsDps,      MPU6050_DIFF_F32),
+    MPU6050_DIFF_FIELD("accel_std",   fAccelStdMg,      MPU6050_DIFF_F32),
+    MPU6050_DIFF_FIELD("read_num",    uiReadNum,        MPU6050_DIFF_U32),
+    MPU6050_DIFF_FIELD("block_bytes", usBlockBytes,     MPU6050_DIFF_U16),
+    MPU6050_DIFF_FIELD("block_crc",   uiBlockCrc,       MPU6050_DIFF_U32)
+};
+
+#define MPU6050_DIFF_FIELD_CNT  (sizeof(MPU6050_DiffFields) / sizeof(MPU6050_DiffFields[0]))
+
+static const size_t MPU6050_DiffTypeSize[] = {8, 4, 2, 1, 2, 8, 4, 8};
+
+/* Largest difference of each field, with -t */
+static double MPU6050_DiffMaxErr[MPU6050_DIFF_FIELD_CNT];
+
+/*
+** Local Function Definitions
+*/
+
+static void MPU6050_Diff_Print(const MPU6050_DiffField_t *FieldPtr, const uint8 *RecPtr)
+{
+    const void *valPtr = RecPtr + FieldPtr->Offset;
+    uint64 u64;
+    uint32 u32;
+    uint16 u16;
+    int16  i16;
+    double f64;
+    float  f32;
+
+    switch (FieldPtr->Type)
+    {
+        case MPU6050_DIFF_U64:
+            memcpy(&u64, valPtr, sizeof(u64));
+            printf("%llu", (unsigned long long) u64);
+            break;
+        case MPU6050_DIFF_U32:
+            memcpy(&u32, valPtr, sizeof(u32));
+            printf("0x%08X", (unsigned int) u32);
+            break;
+        case MPU6050_DIFF_U16:
+            memcpy(&u16, valPtr, sizeof(u16));
+            printf("%u", (unsigned int) u16);
+            break;
+        case MPU6050_DIFF_U8:
+            printf("0x%02X", (unsigned int) *(const uint8*) valPtr);
+            break;
+        case MPU6050_DIFF_I16:
+            memcpy(&i16, valPtr, sizeof(i16));
+            printf("%d", (int) i16);
+            break;
+        case MPU6050_DIFF_F64:
+        case MPU6050_DIFF_A64:
+            memcpy(&f64, valPtr, sizeof(f64));
+            printf("%.17g", f64);
+            break;
+        case MPU6050_DIFF_F32:
+            memcpy(&f32, valPtr, sizeof(f32));
+            printf("%.9g", (double) f32);
+            break;
+    }
+}
+
+/* Whether a field differs: by its bits, or with Tol >= 0 by more than Tol if it is
+ * floating point.  The difference of a floating point field goes to ErrPtr. */
+static bool MPU6050_Diff_Field(const MPU6050_DiffField_t *FieldPtr, const uint8 *APtr, const uint8 *BPtr,
+                               double Tol, double *ErrPtr)
+{
+    double a64;
+    double b64;
+    float  a32;
+    float  b32;
+
+    *ErrPtr = 0.0;
+    if (memcmp(APtr + FieldPtr->Offset, BPtr + FieldPtr->Offset, MPU6050_DiffTypeSize[FieldPtr->Type]) == 0)
+    {
+        return false;
+    }
+
+    switch (FieldPtr->Type)
+    {
+        case MPU6050_DIFF_F64:
+        case MPU6050_DIFF_A64:
+            memcpy(&a64, APtr + FieldPtr->Offset, sizeof(a64));
+            memcpy(&b64, BPtr + FieldPtr->Offset, sizeof(b64));
+            *ErrPtr = fabs(a64 - b64);
+            if (FieldPtr->Type == MPU6050_DIFF_A64)
+            {
+                *ErrPtr = fmod(*ErrPtr, 2.0 * M_PI);
+                *ErrPtr = fmin(*ErrPtr, 2.0 * M_PI - *ErrPtr);
+            }
+            break;
+        case MPU6050_DIFF_F32:
+            memcpy(&a32, APtr + FieldPtr->Offset, sizeof(a32));
+            memcpy(&b32, BPtr + FieldPtr->Offset, sizeof(b32));
+            *ErrPtr = fabs((double) a32 - (double) b32);
+            break;
+        default:
+            return true;
+    }
+
+    /* NaN against anything differs */
+    return Tol < 0.0 || !(*ErrPtr <= Tol);
+}
+
+/* Compare two records, printing the fields that differ if Show.  Returns whether any do. */
+static bool MPU6050_Diff_Compare(uint64 RecNum, const MPU6050_ReplayOutRec_t *APtr,
+                                 const MPU6050_ReplayOutRec_t *BPtr, double Tol, bool Show)
+{
+    const MPU6050_DiffField_t *fieldPtr;
+    bool   differs = false;
+    double err;
+    uint32 f;
+
+    for (f = 0; f < MPU6050_DIFF_FIELD_CNT; f++)
+    {
+        fieldPtr = &MPU6050_DiffFields[f];
+        if (!MPU6050_Diff_Field(fieldPtr, (const uint8*) APtr, (const uint8*) BPtr, Tol, &err))
+        {
+            MPU6050_DiffMaxErr[f] = fmax(MPU6050_DiffMaxErr[f], err);
+            continue;
+        }
+        if (!(err <= MPU6050_DiffMaxErr[f]))
+        {
+            MPU6050_DiffMaxErr[f] = err;
+        }
+
+        if (Show && !differs)
+        {
+            printf("sample %llu (read %u):\n", (unsigned long long) RecNum, (unsigned int) APtr->uiReadNum);
+        }
+        differs = true;
+
+        if (Show)
+        {
+            printf("  %-12s ", fieldPtr->Name);
+            MPU6050_Diff_Print(fieldPtr, (const uint8*) APtr);
+            printf(" -> ");
+            MPU6050_Diff_Print(fieldPtr, (const uint8*) BPtr);
+            printf("\n");
+        }
+    }
+
+    return differs;
+}
+
+static FILE *MPU6050_Diff_Open(const char *Path)
+{
+    MPU6050_ReplayOutHdr_t hdr;
+    FILE *filePtr = fopen(Path, "rb");
+
+    if (filePtr == NULL || fread(&hdr, sizeof(hdr), 1, filePtr) != 1 ||
+        hdr.uiMagic != MPU6050_REPLAY_OUT_MAGIC || hdr.usVersion != MPU6050_REPLAY_OUT_VERSION ||
+        hdr.usRecBytes != sizeof(MPU6050_ReplayOutRec_t))
+    {
+        fprintf(stderr, "%s is not mpu6050_replay output of this version\n", Path);
+        if (filePtr != NULL)
+        {
+            fclose(filePtr);
+        }
+        return NULL;
+    }
+
+    return filePtr;
+}
+
+/*
+** Function Definitions
+*/
+
+int main(int argc, char *argv[])
+{
+    MPU6050_ReplayOutRec_t a;
+    MPU6050_ReplayOutRec_t b;
+    FILE  *aPtr;
+    FILE  *bPtr;
+    uint64 recNum  = 0;
+    uint64 diffCnt = 0;
+    long   maxShow = 10;
+    double tol     = -1.0;    /* Below 0 compares bits */
+    bool   haveTol = false;
+    size_t aGot;
+    size_t bGot;
+    int    opt;
+    uint32 f;
+
+    while ((opt = getopt(argc, argv, "n:t:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                maxShow = atol(optarg);
+                break;
+            case 't':
+                tol     = atof(optarg);
+                haveTol = true;
+                break;
+            default:
+                maxShow = -1;
+                break;
+        }
+    }
+
+    if (maxShow < 0 || (haveTol && tol < 0.0) || argc - optind != 2)
+    {
+        fprintf(stderr, "usage: %s [-n max] [-t tol] a.bin b.bin\n", argv[0]);
+        return 2;
+    }
+
+    aPtr = MPU6050_Diff_Open(argv[optind]);
+    bPtr = MPU6050_Diff_Open(argv[optind + 1]);
+    if (aPtr == NULL || bPtr == NULL)
+    {
+        return 2;
+    }
+
+    for (;;)
+    {
+        aGot = fread(&a, sizeof(a), 1, aPtr);
+        bGot = fread(&b, sizeof(b), 1, bPtr);
+        if (aGot != 1 || bGot != 1)
+        {
+            break;
+        }
+
+        if (memcmp(&a, &b, sizeof(a)) != 0 && MPU6050_Diff_Compare(recNum, &a, &b, tol, diffCnt < (uint64) maxShow))
+        {
+            diffCnt++;
+        }
+        recNum++;
+    }
+
+    if (tol >= 0.0)
+    {
+        printf("largest differences:\n");
+        for (f = 0; f < MPU6050_DIFF_FIELD_CNT; f++)
+        {
+            if (MPU6050_DiffFields[f].Type >= MPU6050_DIFF_F64)
+            {
+                printf("  %-12s %.3g\n", MPU6050_DiffFields[f].Name, MPU6050_DiffMaxErr[f]);
+            }
+        }
+    }
+
+    if (aGot != bGot)
+    {
+        printf("%s ends after %llu samples\n", argv[optind + (aGot == 1)], (unsigned long long) recNum);
+        diffCnt++;
+    }
+
+    fclose(aPtr);
+    fclose(bPtr);
+
+    if (diffCnt == 0)
+    {
+        printf("%s: %llu samples\n", (tol >= 0.0) ? "within tolerance" : "identical", (unsigned long long) recNum);
+        return 0;
+    }
+
+    printf("%llu of %llu samples differ\n", (unsigned long long) diffCnt, (unsigned long long) recNum);
+    return 1;
+}
+
+/*=======================================================================================
+** End of file mpu6050_capdiff.c
+**=====================================================================================*/
@@ -0,0 +1,481 @@
+/*=======================================================================================
+** File Name:  mpu6050_replay.c
+**
+** Title:  Offline Capture Replay for MPU6050 Application
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To run the samples of a bus capture through the processing of the app,
+**           as fast as the host allows, and write every intermediate result, so two
+**           builds can be compared with mpu6050_capdiff.
+**
+** Usage:
+**    mpu6050_replay [-w window] [-k cal.txt] capture.bin out.bin
+**
+**    -w  Samples per motion window (default 100)
+**    -k  Calibration: 24 numbers, accel bias[3], accel matrix[3][3], gyro bias[3],
+**        gyro matrix[3][3], row major.  Default is no correction.
+**
+** Limitations, Assumptions, External Events, and Notes:
+** 1: The device is followed through its registers.  The configuration at the start
+**    of the capture is in its header, and every write after it is applied, so the
+**    channels, full scale ranges and sample rate are whatever the app had set.
+** 2: A FIFO_COUNT read times the FIFO_R_W read that follows it, as in
+**    MPU6050_ReadDevice; a read of the data registers is one polled sample timed when
+**    it completed.  INT_STATUS with FIFO_OFLOW set resyncs the time model.
+** 3: The time model starts fresh with the capture, so sample times are the same on
+**    every run but are not those the app estimated live.  Attitude is propagated
+**    over every sample with the time between samples.
+** 4: Each read is packed and compressed as the compressed stream would send it; the
+**    size and CRC-32 of that block go with each of its samples.
+** 5: A build with MPU6050_FIXED_POINT set replays through the fixed point path;
+**    "mpu6050_capdiff -t" against the output of a default build shows how far it is
+**    from the reference (see mpu6050_fixed.c for the bounds).
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+/*
+** Include Files
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "mpu6050_capture.h"
+#include "mpu6050_core.h"
+#include "mpu6050_diag.h"
+#include "mpu6050_registers.h"
+#include "mpu6050_replay.h"
+
+/*
+** Local Defines
+*/
+#define MPU6050_REPLAY_DEFAULT_WINDOW  100
+
+/*
+** Local Structure Declarations
+*/
+typedef struct
+{
+    uint8   aucReg[MPU6050_CAP_REG_CNT];  /* What the device registers hold */
+    uint8   ucRegPtr;          /* Register the next read starts at */
+    bool    bTimed;            /* A FIFO_COUNT read has set dCountTime */
+    double  dCountTime;
+    double  dPeriod;           /* Sample period the time model was given */
+    uint64  uiPollIdx;         /* Polled samples so far */
+    uint32  uiReadNum;         /* Sample reads so far */
+    double  dLastTime;         /* Time of the last sample, for attitude */
+    bool    bHaveLast;
+
+    MPU6050_Calibration_t Cal;
+    MPU6050_Core_t        Core;
+
+    FILE   *OutPtr;
+    uint64  uiSampleCnt;
+} MPU6050_Replayer_t;
+
+/*
+** Local Function Definitions
+*/
+
+/* Reflected CRC-32 (IEEE 802.3) */
+static uint32 MPU6050_Replay_Crc32(const uint8 *Buf, uint32 Len)
+{
+    uint32 crc = 0xFFFFFFFF;
+    uint32 i;
+    uint32 b;
+
+    for (i = 0; i < Len; i++)
+    {
+        crc ^= Buf[i];
+        for (b = 0; b < 8; b++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+
+    return ~crc;
+}
+
+/* Channels the registers have the device sample */
+static uint8 MPU6050_Replay_Enabled(const uint8 *Reg)
+{
+    uint8 stby = Reg[RegPowerManagment2];
+    uint8 chans = MPU6050_CHAN_ALL;
+
+    if (stby & (1 << PwrMgmt2StbyXA)) chans &= ~MPU6050_CHAN_ACCEL_X;
+    if (stby & (1 << PwrMgmt2StbyYA)) chans &= ~MPU6050_CHAN_ACCEL_Y;
+    if (stby & (1 << PwrMgmt2StbyZA)) chans &= ~MPU6050_CHAN_ACCEL_Z;
+    if (stby & (1 << PwrMgmt2StbyXG)) chans &= ~MPU6050_CHAN_GYRO_X;
+    if (stby & (1 << PwrMgmt2StbyYG)) chans &= ~MPU6050_CHAN_GYRO_Y;
+    if (stby & (1 << PwrMgmt2StbyZG)) chans &= ~MPU6050_CHAN_GYRO_Z;
+    if (Reg[RegPowerManagment1] & (1 << PwrMgmt1Temp_dis)) chans &= ~MPU6050_CHAN_TEMP;
+
+    return chans;
+}
+
+/* Channels FIFO_EN has the FIFO queue, in MPU6050_RawSample_t order */
+static uint8 MPU6050_Replay_FifoChannels(const uint8 *Reg)
+{
+    uint8 fifoEn = Reg[RegFifoEnable];
+    uint8 chans  = 0;
+
+    if (fifoEn & (1 << FifoEnAccel)) chans |= MPU6050_CHAN_ACCEL;
+    if (fifoEn & (1 << FifoEnTemp))  chans |= MPU6050_CHAN_TEMP;
+    if (fifoEn & (1 << FifoEnXG))    chans |= MPU6050_CHAN_GYRO_X;
+    if (fifoEn & (1 << FifoEnYG))    chans |= MPU6050_CHAN_GYRO_Y;
+    if (fifoEn & (1 << FifoEnZG))    chans |= MPU6050_CHAN_GYRO_Z;
+
+    return chans;
+}
+
+static double MPU6050_Replay_Period(const uint8 *Reg)
+{
+    return 1.0 / MPU6050_GetSampleRateHz(Reg[RegSampleRateDiv], Reg[RegConfig] & 0x07);
+}
+
+/* Apply a write to the register copy */
+static void MPU6050_Replay_ApplyWrite(MPU6050_Replayer_t *RepPtr, const uint8 *Buf, uint32 Len)
+{
+    uint8  reg = Buf[0];
+    uint32 i;
+
+    RepPtr->ucRegPtr = reg;
+
+    for (i = 1; i < Len; i++, reg++)
+    {
+        if (reg >= MPU6050_CAP_REG_CNT || reg == RegFifoRW)
+        {
+            continue;
+        }
+
+        if (reg == RegPowerManagment1 && (Buf[i] & (1 << PwrMgmt1DeviceReset)))
+        {
+            memset(RepPtr->aucReg, 0x00, sizeof(RepPtr->aucReg));
+            RepPtr->aucReg[RegPowerManagment1] = 1 << PwrMgmt1Sleep;
+            continue;
+        }
+
+        RepPtr->aucReg[reg] = Buf[i];
+    }
+
+    if (MPU6050_Replay_Period(RepPtr->aucReg) != RepPtr->dPeriod)
+    {
+        RepPtr->dPeriod = MPU6050_Replay_Period(RepPtr->aucReg);
+        MPU6050_TimeModel_SetPeriod(&RepPtr->Core.TimeModel, RepPtr->dPeriod);
+    }
+}
+
+/* Run the samples of one read through the processing and write them out */
+static int32 MPU6050_Replay_Samples(MPU6050_Replayer_t *RepPtr, const uint8 *Buf, uint32 SampleCnt,
+                                    uint8 Present, bool Fifo, double ReadTime)
+{
+    static int16 packed[MPU6050_FIFO_MAX_SAMPLES][MPU6050_COMP_CHANNELS];
+    static uint8 block[MPU6050_COMP_MAX_BLOCK_BYTES(MPU6050_COMP_MAX_SAMPLES)];
+    static MPU6050_ReplayOutRec_t recs[MPU6050_FIFO_MAX_SAMPLES];
+    uint8  keep       = Present & MPU6050_Replay_Enabled(RepPtr->aucReg);
+    uint32 sampleBytes = MPU6050_ChannelCnt(Present) * MPU6050_CHANNEL_BYTES;
+    uint64 firstIdx;
+    uint32 blockBytes = 0;
+    uint32 blockCrc   = 0;
+    uint32 n;
+    uint32 i;
+
+    MPU6050_Core_Configure(&RepPtr->Core, keep, RepPtr->aucReg[RegAccelConfig] & (3 << RegAccelConfigScale),
+                           RepPtr->aucReg[RegGyroConfig] & (3 << RegGyroConfigScale), &RepPtr->Cal);
+
+    if (Fifo)
+    {
+        firstIdx = MPU6050_Core_TimeRead(&RepPtr->Core, SampleCnt, ReadTime);
+    }
+    else
+    {
+        firstIdx = RepPtr->uiPollIdx;
+        RepPtr->uiPollIdx += SampleCnt;
+    }
+
+    memset(recs, 0x00, SampleCnt * sizeof(recs[0]));
+
+    for (i = 0; i < SampleCnt; i++)
+    {
+        MPU6050_ReplayOutRec_t *recPtr = &recs[i];
+        double gyro[3];
+
+        MPU6050_UnpackSample(&Buf[i * sampleBytes], Present, keep, &recPtr->Raw);
+        MPU6050_Core_Convert(&RepPtr->Core, &recPtr->Raw, &recPtr->Cal);
+        memcpy(packed[i], &recPtr->Raw, sizeof(packed[i]));
+
+        recPtr->uiSampleIdx = firstIdx + i;
+        recPtr->dSampleTime = Fifo ? MPU6050_Core_SampleTime(&RepPtr->Core, firstIdx + i) : ReadTime;
+        recPtr->ucChannels  = keep;
+        recPtr->uiReadNum   = RepPtr->uiReadNum;
+
+        MPU6050_Core_AddMotion(&RepPtr->Core, &recPtr->Raw);
+        recPtr->fGyroRmsDps = RepPtr->Core.Motion.fGyroRmsDps;
+        recPtr->fAccelStdMg = RepPtr->Core.Motion.fAccelStdMg;
+
+        gyro[0] = recPtr->Cal.gyroXDegsSec;
+        gyro[1] = recPtr->Cal.gyroYDegsSec;
+        gyro[2] = recPtr->Cal.gyroZDegsSec;
+
+        if (RepPtr->bHaveLast && recPtr->dSampleTime > RepPtr->dLastTime)
+        {
+            MPU6050_Core_Propagate(&RepPtr->Core, gyro, recPtr->dSampleTime - RepPtr->dLastTime, NULL);
+        }
+        RepPtr->dLastTime = recPtr->dSampleTime;
+        RepPtr->bHaveLast = true;
+        recPtr->Att       = RepPtr->Core.Attitude;
+    }
+
+    /* MPU6050_RawSample_t is exactly MPU6050_COMP_CHANNELS int16's in coder order.  One
+     * block per MPU6050_COMP_MAX_SAMPLES, as the compressed stream splits a read. */
+    for (i = 0; i < SampleCnt; i += n)
+    {
+        uint32 j;
+
+        n = SampleCnt - i;
+        if (n > MPU6050_COMP_MAX_SAMPLES)
+        {
+            n = MPU6050_COMP_MAX_SAMPLES;
+        }
+
+        blockBytes = MPU6050_CompressBlock((const int16 (*)[MPU6050_COMP_CHANNELS]) packed[i], n,
+                                           block, sizeof(block));
+        blockCrc   = MPU6050_Replay_Crc32(block, blockBytes);
+
+        for (j = i; j < i + n; j++)
+        {
+            recs[j].usBlockBytes = (uint16) blockBytes;
+            recs[j].uiBlockCrc   = blockCrc;
+        }
+    }
+
+    RepPtr->uiReadNum++;
+    RepPtr->uiSampleCnt += SampleCnt;
+
+    return (fwrite(recs, sizeof(recs[0]), SampleCnt, RepPtr->OutPtr) == SampleCnt) ? 0 : -1;
+}
+
+/* Follow one read: register state, timing, and any samples it returned */
+static int32 MPU6050_Replay_FollowRead(MPU6050_Replayer_t *RepPtr, const uint8 *Buf, uint32 Len, double Time)
+{
+    uint8  reg = RepPtr->ucRegPtr;
+    uint8  present;
+    uint32 sampleBytes;
+    uint32 sampleCnt;
+
+    if (reg == RegIntStatus)
+    {
+        if (Buf[0] & (1 << IntStatusFifoOflow))
+        {
+            MPU6050_TimeModel_Resync(&RepPtr->Core.TimeModel);
+            RepPtr->bTimed = false;
+        }
+        return 0;
+    }
+
+    if (reg == RegFifoCount)
+    {
+        RepPtr->dCountTime = Time;
+        RepPtr->bTimed     = true;
+        return 0;
+    }
+
+    if (reg == RegFifoRW)
+    {
+        present     = MPU6050_Replay_FifoChannels(RepPtr->aucReg);
+        sampleBytes = MPU6050_ChannelCnt(present) * MPU6050_CHANNEL_BYTES;
+        if (sampleBytes == 0 || !RepPtr->bTimed)
+        {
+            return 0;
+        }
+
+        sampleCnt = Len / sampleBytes;
+        if (sampleCnt > MPU6050_FIFO_MAX_SAMPLES)
+        {
+            sampleCnt = MPU6050_FIFO_MAX_SAMPLES;
+        }
+
+        RepPtr->bTimed = false;
+        return MPU6050_Replay_Samples(RepPtr, Buf, sampleCnt, present, true, RepPtr->dCountTime);
+    }
+
+    /* A burst of the data registers, starting on a channel */
+    if (reg >= RegAccelX && reg < RegAccelX + MPU6050_SAMPLE_BYTES &&
+        (reg - RegAccelX) % MPU6050_CHANNEL_BYTES == 0 && Len % MPU6050_CHANNEL_BYTES == 0 &&
+        reg + Len <= RegAccelX + MPU6050_SAMPLE_BYTES)
+    {
+        present = (uint8) (((1u << (Len / MPU6050_CHANNEL_BYTES)) - 1) <<
+                           ((reg - RegAccelX) / MPU6050_CHANNEL_BYTES));
+        return MPU6050_Replay_Samples(RepPtr, Buf, 1, present, false, Time);
+    }
+
+    return 0;
+}
+
+static int32 MPU6050_Replay_LoadCal(const char *Path, MPU6050_Calibration_t *CalPtr)
+{
+    double *vals[24];
+    FILE   *filePtr;
+    uint32  i;
+
+    for (i = 0; i < 3; i++)
+    {
+        vals[i]      = &CalPtr->accelBias[i];
+        vals[12 + i] = &CalPtr->gyroBias[i];
+    }
+    for (i = 0; i < 9; i++)
+    {
+        vals[3 + i]  = &CalPtr->accelMatrix[i / 3][i % 3];
+        vals[15 + i] = &CalPtr->gyroMatrix[i / 3][i % 3];
+    }
+
+    filePtr = fopen(Path, "r");
+    if (filePtr == NULL)
+    {
+        return -1;
+    }
+
+    for (i = 0; i < 24; i++)
+    {
+        if (fscanf(filePtr, "%lf", vals[i]) != 1)
+        {
+            fclose(filePtr);
+            return -1;
+        }
+    }
+
+    fclose(filePtr);
+    return 0;
+}
+
+/*
+** Function Definitions
+*/
+
+int main(int argc, char *argv[])
+{
+    static MPU6050_Replayer_t rep;
+    MPU6050_CapFileHdr_t   capHdr;
+    MPU6050_CapRecHdr_t    rec;
+    MPU6050_ReplayOutHdr_t outHdr;
+    uint8  buf[UINT16_MAX + 1];
+    uint32 window  = MPU6050_REPLAY_DEFAULT_WINDOW;
+    const char *calPath = NULL;
+    FILE  *inPtr;
+    uint64 startNsec;
+    uint64 recCnt = 0;
+    double elapsed;
+    int32  status = 0;
+    int    opt;
+    int    i;
+
+    while ((opt = getopt(argc, argv, "w:k:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'w':
+                window = (uint32) atoi(optarg);
+                break;
+            case 'k':
+                calPath = optarg;
+                break;
+            default:
+                window = 0;
+                break;
+        }
+    }
+
+    if (window == 0 || argc - optind != 2)
+    {
+        fprintf(stderr, "usage: %s [-w window] [-k cal.txt] capture.bin out.bin\n", argv[0]);
+        return 2;
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        rep.Cal.accelMatrix[i][i] = 1.0;
+        rep.Cal.gyroMatrix[i][i]  = 1.0;
+    }
+    if (calPath != NULL && MPU6050_Replay_LoadCal(calPath, &rep.Cal) != 0)
+    {
+        fprintf(stderr, "%s: cannot read 24 calibration values from %s\n", argv[0], calPath);
+        return 2;
+    }
+
+    inPtr = fopen(argv[optind], "rb");
+    if (inPtr == NULL || fread(&capHdr, sizeof(capHdr), 1, inPtr) != 1 ||
+        capHdr.uiMagic != MPU6050_CAP_MAGIC || capHdr.usVersion != MPU6050_CAP_VERSION ||
+        capHdr.usHdrBytes != sizeof(capHdr))
+    {
+        fprintf(stderr, "%s: %s is not a capture\n", argv[0], argv[optind]);
+        return 2;
+    }
+
+    rep.OutPtr = fopen(argv[optind + 1], "wb");
+    if (rep.OutPtr == NULL)
+    {
+        perror(argv[optind + 1]);
+        return 2;
+    }
+
+    memset(&outHdr, 0x00, sizeof(outHdr));
+    outHdr.uiMagic            = MPU6050_REPLAY_OUT_MAGIC;
+    outHdr.usVersion          = MPU6050_REPLAY_OUT_VERSION;
+    outHdr.usRecBytes         = sizeof(MPU6050_ReplayOutRec_t);
+    outHdr.uiCaptureStartNsec = capHdr.uiStartNsec;
+    fwrite(&outHdr, sizeof(outHdr), 1, rep.OutPtr);
+
+    memcpy(rep.aucReg, capHdr.aucReg, sizeof(rep.aucReg));
+    rep.dPeriod = MPU6050_Replay_Period(rep.aucReg);
+    MPU6050_Core_Init(&rep.Core, rep.dPeriod, window);
+
+    startNsec = MPU6050_DiagNow();
+
+    while (status == 0 && fread(&rec, sizeof(rec), 1, inPtr) == 1)
+    {
+        if (fread(buf, 1, rec.usLen, inPtr) != rec.usLen)
+        {
+            fprintf(stderr, "%s: capture ends inside a transfer\n", argv[0]);
+            break;
+        }
+        recCnt++;
+
+        if (rec.ucDir == MPU6050_CAP_DIR_WRITE)
+        {
+            MPU6050_Replay_ApplyWrite(&rep, buf, rec.usLen);
+        }
+        else
+        {
+            status = MPU6050_Replay_FollowRead(&rep, buf, rec.usLen, rec.uiTimeNsec * 1e-9);
+        }
+    }
+
+    elapsed = (MPU6050_DiagNow() - startNsec) * 1e-9;
+    fclose(inPtr);
+
+    if (fclose(rep.OutPtr) != 0 || status != 0)
+    {
+        fprintf(stderr, "%s: failed writing %s\n", argv[0], argv[optind + 1]);
+        return 2;
+    }
+
+    printf("%llu transfers, %u reads, %llu samples in %.3f s (%.0f samples/s)\n",
+           (unsigned long long) recCnt, (unsigned int) rep.uiReadNum,
+           (unsigned long long) rep.uiSampleCnt, elapsed,
+           (elapsed > 0.0) ? rep.uiSampleCnt / elapsed : 0.0);
+
+    return 0;
+}
+
+/*=======================================================================================
+** End of file mpu6050_replay.c
+**=====================================================================================*/
@@ -0,0 +1,72 @@
+/*=======================================================================================
+** File Name:  mpu6050_replay.h
+**
+** Title:  Replay Output Format for MPU6050 Tools
+**
+** $Author:    Jacob Killelea
+** $Revision: 1.1 $
+** $Date:      2026-10-19
+**
+** Purpose:  To define what mpu6050_replay writes for each sample of a capture, and
+**           mpu6050_capdiff compares.
+**
+** Modification History:
+**   Date | Author | Description
+**   ---------------------------
+**   2026-10-19 | Jacob Killelea | Build #: Code Started
+**
+**=====================================================================================*/
+
+#ifndef _MPU6050_REPLAY_H_
+#define _MPU6050_REPLAY_H_
+
+/*
+** Include Files
+*/
+#include "common_types.h"
+#include "mpu6050_private_types.h"
+
+/*
+** Local Defines
+*/
+#define MPU6050_REPLAY_OUT_MAGIC    0x4F50524D  /* "MRPO" */
+#define MPU6050_REPLAY_OUT_VERSION  1
+
+/*
+** Local Structure Declarations
+*/
+
+/* Start of a replay output file, followed by one MPU6050_ReplayOutRec_t per sample */
+typedef struct
+{
+    uint32  uiMagic;           /* MPU6050_REPLAY_OUT_MAGIC */
+    uint16  usVersion;         /* MPU6050_REPLAY_OUT_VERSION */
+    uint16  usRecBytes;        /* sizeof(MPU6050_ReplayOutRec_t) */
+    uint64  uiCaptureStartNsec;
+} MPU6050_ReplayOutHdr_t;
+
+/* One sample and everything computed from it.  No padding, so records compare with
+** memcmp. */
+typedef struct
+{
+    uint64  uiSampleIdx;       /* Time model index; for polled reads, the read number */
+    double  dSampleTime;       /* Estimated latch time (monotonic seconds) */
+    MPU6050_RawSample_t Raw;   /* Decoded as read; channels not kept are 0 */
+    uint8   ucChannels;        /* MPU6050_CHAN_* kept */
+    uint8   ucSpare;
+    MPU6050_Sample_t   Cal;    /* Converted and calibrated */
+    MPU6050_Attitude_t Att;    /* Attitude after this sample */
+    float   fGyroRmsDps;       /* Motion metrics of the last complete window */
+    float   fAccelStdMg;
+    uint32  uiReadNum;         /* Device read the sample came in */
+    uint16  usBlockBytes;      /* Compressed block of that read: size and CRC-32 */
+    uint16  usSpare;
+    uint32  uiBlockCrc;
+    uint32  uiSpare;
+} MPU6050_ReplayOutRec_t;
+
+#endif /* _MPU6050_REPLAY_H_ */
+
+/*=======================================================================================
+** End of file mpu6050_replay.h
+**=====================================================================================*/